@@ -3,16 +3,71 @@ set(SRC_FILES
     ${CMAKE_SOURCE_DIR}/src/common/Logging.cpp
     ${CMAKE_SOURCE_DIR}/src/common/Utils.cpp
     ${CMAKE_SOURCE_DIR}/src/common/Configurable.cpp
+    ${CMAKE_SOURCE_DIR}/src/common/LoggingConfig.cpp
+    ${CMAKE_SOURCE_DIR}/src/common/Param.cpp
+    ${CMAKE_SOURCE_DIR}/src/common/ConfigWatcher.cpp
+    ${CMAKE_SOURCE_DIR}/src/common/ConfigSnapshot.cpp
+    ${CMAKE_SOURCE_DIR}/src/common/ConfigStore.cpp
+    ${CMAKE_SOURCE_DIR}/src/common/MessageBus.cpp
+    ${CMAKE_SOURCE_DIR}/src/common/Watchdog.cpp
 
     # Sim
     ${CMAKE_SOURCE_DIR}/src/sim/PhysicsBackend.cpp
     ${CMAKE_SOURCE_DIR}/src/sim/JSONBackend.cpp
+    ${CMAKE_SOURCE_DIR}/src/sim/TelemetryHistory.cpp
+
+    # Nav
+    ${CMAKE_SOURCE_DIR}/src/nav/AttitudeEstimator.cpp
+    ${CMAKE_SOURCE_DIR}/src/nav/NavFilter.cpp
+    ${CMAKE_SOURCE_DIR}/src/nav/NavPredictor.cpp
+
+    # Control
+    ${CMAKE_SOURCE_DIR}/src/control/PidBank.cpp
+    ${CMAKE_SOURCE_DIR}/src/control/Mixer.cpp
+    ${CMAKE_SOURCE_DIR}/src/control/ControlAllocator.cpp
+    ${CMAKE_SOURCE_DIR}/src/control/EffectivenessEstimator.cpp
+    ${CMAKE_SOURCE_DIR}/src/control/MracController.cpp
+    ${CMAKE_SOURCE_DIR}/src/control/IndiController.cpp
+
+    # Log
+    ${CMAKE_SOURCE_DIR}/src/log/FlightRecorder.cpp
+    ${CMAKE_SOURCE_DIR}/src/log/FlightLogReader.cpp
+    ${CMAKE_SOURCE_DIR}/src/log/FlightLogExporter.cpp
+    ${CMAKE_SOURCE_DIR}/src/log/TelemetryCompressor.cpp
 )
 
 set(TEST_FILES
     # Common
+    ${CMAKE_SOURCE_DIR}/test/common/Logging.cpp
     ${CMAKE_SOURCE_DIR}/test/common/Configurable.cpp
+    ${CMAKE_SOURCE_DIR}/test/common/ConfigWatcher.cpp
+    ${CMAKE_SOURCE_DIR}/test/common/ConfigSnapshot.cpp
+    ${CMAKE_SOURCE_DIR}/test/common/ConfigStore.cpp
+    ${CMAKE_SOURCE_DIR}/test/common/MessageBus.cpp
+    ${CMAKE_SOURCE_DIR}/test/common/Matrix.cpp
+    ${CMAKE_SOURCE_DIR}/test/common/Pipeline.cpp
+    ${CMAKE_SOURCE_DIR}/test/common/RecursiveLeastSquares.cpp
+    ${CMAKE_SOURCE_DIR}/test/common/Watchdog.cpp
 
     # Sim
     ${CMAKE_SOURCE_DIR}/test/sim/JSONBackend.cpp
+    ${CMAKE_SOURCE_DIR}/test/sim/TelemetryHistory.cpp
+
+    # Nav
+    ${CMAKE_SOURCE_DIR}/test/nav/AttitudeEstimator.cpp
+    ${CMAKE_SOURCE_DIR}/test/nav/NavFilter.cpp
+    ${CMAKE_SOURCE_DIR}/test/nav/NavPredictor.cpp
+
+    # Control
+    ${CMAKE_SOURCE_DIR}/test/control/PidBank.cpp
+    ${CMAKE_SOURCE_DIR}/test/control/Mixer.cpp
+    ${CMAKE_SOURCE_DIR}/test/control/ControlAllocator.cpp
+    ${CMAKE_SOURCE_DIR}/test/control/EffectivenessEstimator.cpp
+    ${CMAKE_SOURCE_DIR}/test/control/MracController.cpp
+    ${CMAKE_SOURCE_DIR}/test/control/IndiController.cpp
+
+    # Log
+    ${CMAKE_SOURCE_DIR}/test/log/FlightRecorder.cpp
+    ${CMAKE_SOURCE_DIR}/test/log/FlightLogExporter.cpp
+    ${CMAKE_SOURCE_DIR}/test/log/TelemetryCompressor.cpp
 )
\ No newline at end of file
@@ -0,0 +1,250 @@
+/**
+ * @file ConfigSnapshot.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the ConfigSnapshot class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <json.h>
+
+namespace Dae {
+
+/**
+ * @brief Memory mapped, precompiled binary form of a JSON configuration.
+ *
+ * A snapshot holds every scalar value of the configuration, keyed by
+ * "<object key>.<key>" (or "<key>" for top level scalars), in an open
+ * addressed hash index. Values are stored typed, so reading one needs no
+ * parsing. Nested arrays and objects are not stored.
+ *
+ * Each snapshot records the checksum of the JSON file it was built from, and
+ * is only used while that file is unchanged. Snapshots are built with the
+ * `daedalus_config` tool, and are little endian.
+ *
+ * Layout, every section 8 byte aligned:
+ *
+ * | Section | Contents                                          |
+ * |---------|---------------------------------------------------|
+ * | Header  | `Header`                                          |
+ * | Index   | `slots` entry indices, `EMPTY` for an empty slot  |
+ * | Entries | `entries` `Entry` records                         |
+ * | Strings | Key names and string values, not NULL terminated  |
+ */
+class ConfigSnapshot {
+public:
+    /**
+     * @brief Status codes for the ConfigSnapshot class.
+     */
+    enum Status {
+        ST_GOOD = 0,
+        ST_FOPEN_FAIL,
+        ST_MMAP_FAIL,
+        ST_BAD_FORMAT,
+        ST_STALE,
+        ST_WRITE_FAIL
+    };
+
+    /**
+     * @brief Type of a stored value.
+     */
+    enum Type : uint8_t { TY_NULL = 0, TY_BOOL, TY_NUMBER, TY_STRING };
+
+    /// @brief Snapshot format version.
+    static constexpr uint32_t VERSION = 1;
+
+    /// @brief Index value of an empty slot.
+    static constexpr uint32_t EMPTY = UINT32_MAX;
+
+    /**
+     * @brief Snapshot file header.
+     */
+    struct Header {
+        /// @brief "DAECFG" followed by two NULLs.
+        char magic[8];
+        /// @brief Format version.
+        uint32_t version;
+        /// @brief Number of entries.
+        uint32_t entries;
+        /// @brief Checksum of the source JSON file.
+        uint64_t checksum;
+        /// @brief Number of index slots, a power of two.
+        uint32_t slots;
+        /// @brief Padding.
+        uint32_t reserved;
+        /// @brief Total size of the snapshot (bytes).
+        uint64_t size;
+    };
+
+    /**
+     * @brief A stored value.
+     */
+    struct Entry {
+        /// @brief Hash of the key name.
+        uint64_t hash;
+        /// @brief Offset of the key name in the strings.
+        uint32_t name;
+        /// @brief Length of the key name.
+        uint32_t nameLength;
+        /// @brief Offset of a string value in the strings.
+        uint32_t string;
+        /// @brief Length of a string value.
+        uint32_t stringLength;
+        /// @brief Value type.
+        Type type;
+        /// @brief Padding.
+        uint8_t reserved[7];
+        /// @brief Number or boolean value.
+        double number;
+    };
+
+    ConfigSnapshot() = default;
+
+    /**
+     * @brief Destroy the ConfigSnapshot object, unmapping it.
+     */
+    ~ConfigSnapshot();
+
+    ConfigSnapshot(const ConfigSnapshot& other)            = delete;
+    ConfigSnapshot& operator=(const ConfigSnapshot& other) = delete;
+
+    /**
+     * @brief Map a snapshot, and check that it matches its source.
+     *
+     * @param filepath Path to the snapshot.
+     * @param checksum Checksum of the source JSON file.
+     * @return int Status code. 0 for success.
+     */
+    int open(const std::string& filepath, uint64_t checksum);
+
+    /**
+     * @brief Unmap the snapshot.
+     */
+    void close(void);
+
+    /**
+     * @brief Check whether a snapshot is mapped.
+     *
+     * @return bool True if a snapshot is mapped.
+     */
+    bool isOpen(void) const { return header != nullptr; }
+
+    /**
+     * @brief Find a value.
+     *
+     * @param object Object key, empty for a top level value.
+     * @param key Key within the object.
+     * @return const Entry* The value, or nullptr if it is not found.
+     */
+    const Entry* find(std::string_view object, std::string_view key) const;
+
+    /**
+     * @brief Read a number or boolean value.
+     *
+     * @param object Object key.
+     * @param key Key within the object.
+     * @param value Set to the value if it is found.
+     * @return bool True if a number or boolean was found.
+     */
+    bool number(std::string_view object, std::string_view key,
+                double& value) const;
+
+    /**
+     * @brief Read a string value.
+     *
+     * @param object Object key.
+     * @param key Key within the object.
+     * @param value Set to the value if it is found.
+     * @return bool True if a string was found.
+     */
+    bool string(std::string_view object, std::string_view key,
+                std::string& value) const;
+
+    /**
+     * @brief Get the keys of every value in an object. This scans every
+     * entry, so it is meant for startup and reloads only.
+     *
+     * @param object Object key.
+     * @return std::vector<std::string> The keys within the object.
+     */
+    std::vector<std::string> keys(std::string_view object) const;
+
+    /**
+     * @brief Build a snapshot of a configuration.
+     *
+     * @param config The configuration.
+     * @param checksum Checksum of the source JSON file.
+     * @param filepath Path to write the snapshot to.
+     * @return int Status code. 0 for success.
+     */
+    static int build(const nlohmann::json& config, uint64_t checksum,
+                     const std::string& filepath);
+
+    /**
+     * @brief Compute the checksum of a file.
+     *
+     * @param filepath Path to the file.
+     * @param checksum Set to the checksum.
+     * @return int Status code. 0 for success.
+     */
+    static int checksum(const std::string& filepath, uint64_t& checksum);
+
+    /**
+     * @brief Get the snapshot path used for a JSON configuration file.
+     *
+     * @param filepath Path to the JSON file.
+     * @return std::string Path to its snapshot.
+     */
+    static std::string pathFor(const std::string& filepath) {
+        return filepath + ".bin";
+    }
+
+    /**
+     * @brief 64 bit FNV-1a hash, which can be continued across calls.
+     *
+     * @param data Bytes to hash.
+     * @param size Number of bytes.
+     * @param hash Hash so far.
+     * @return uint64_t The hash.
+     */
+    static uint64_t hash(const void* data, size_t size,
+                         uint64_t hash = 0xcbf29ce484222325ull) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+private:
+    /// @brief Mapped header.
+    const Header* header = nullptr;
+
+    /// @brief Mapped index.
+    const uint32_t* slots = nullptr;
+
+    /// @brief Mapped entries.
+    const Entry* entries = nullptr;
+
+    /// @brief Mapped strings.
+    const char* strings = nullptr;
+
+    /// @brief Size of the strings (bytes).
+    size_t stringsSize = 0;
+
+    /// @brief Size of the mapping (bytes).
+    size_t mapped = 0;
+};
+
+static_assert(sizeof(ConfigSnapshot::Header) == 40);
+static_assert(sizeof(ConfigSnapshot::Entry) == 40);
+
+} // namespace Dae
@@ -0,0 +1,108 @@
+/**
+ * @file ConfigStore.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the ConfigStore class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <json.h>
+
+#include "common/ConfigSnapshot.h"
+
+namespace Dae {
+
+/**
+ * @brief Versioned, immutable store of the global configuration.
+ *
+ * Each configuration is published as a new `Version`, which is never
+ * modified once published. Readers pin the current version with a `Reader`,
+ * which takes no lock, and may read it from any thread. Replaced versions are
+ * retired, and freed with epoch based reclamation once no reader that could
+ * have seen them is still active.
+ *
+ * Every thread that reads claims one of `MAX_READERS` reader slots on its
+ * first read, and releases it when it exits. Threads past that take the
+ * publishing lock to read instead.
+ */
+class ConfigStore {
+public:
+    /// @brief Number of threads that can read without a lock.
+    static constexpr size_t MAX_READERS = 64;
+
+    /**
+     * @brief A published configuration.
+     */
+    struct Version {
+        /// @brief The parsed configuration, null when a snapshot is mapped.
+        nlohmann::json config;
+        /// @brief Mapped snapshot, used instead of `config` when it is open.
+        ConfigSnapshot snapshot;
+        /// @brief Version number, counting up from 0 for the empty version.
+        uint64_t number = 0;
+    };
+
+    /**
+     * @brief Pins the current version while it is alive. Readers can be
+     * nested, and must not be passed between threads.
+     */
+    class Reader {
+    public:
+        /**
+         * @brief Construct a new Reader object, pinning the current version.
+         */
+        Reader();
+
+        /**
+         * @brief Destroy the Reader object, unpinning the version.
+         */
+        ~Reader();
+
+        Reader(const Reader& other)            = delete;
+        Reader& operator=(const Reader& other) = delete;
+
+        /// @brief Get the pinned version.
+        const Version& operator*() const { return *version; }
+
+        /// @brief Get the pinned version.
+        const Version* operator->() const { return version; }
+
+    private:
+        /// @brief The pinned version.
+        const Version* version;
+
+        /// @brief Set if the publishing lock is held instead of a slot.
+        bool locked;
+    };
+
+    /**
+     * @brief Publish a configuration, replacing the current version. The
+     * replaced version is freed once every reader has released it.
+     *
+     * @param version The new configuration. Its number is set here.
+     * @return uint64_t The new version number.
+     */
+    static uint64_t publish(std::unique_ptr<Version> version);
+
+    /**
+     * @brief Get the current version number.
+     *
+     * @return uint64_t The version number.
+     */
+    static uint64_t current(void);
+
+    /**
+     * @brief Get the number of replaced versions that are not freed yet.
+     *
+     * @return size_t The number of retired versions.
+     */
+    static size_t retired(void);
+};
+
+} // namespace Dae
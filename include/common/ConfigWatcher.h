@@ -0,0 +1,143 @@
+/**
+ * @file ConfigWatcher.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the ConfigWatcher class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "common/Configurable.h"
+#include "common/SpscQueue.h"
+
+namespace Dae {
+
+/**
+ * @brief Watches the configuration file and hot reloads it into running
+ * components.
+ *
+ * A background thread waits for the file to change (inotify on Linux, polling
+ * its modification time elsewhere), parses it and works out which keys
+ * changed. It then does everything that needs a lock: it publishes the new
+ * configuration, reads the new param values and finds the objects to notify
+ * (see `Configurable::prepare`). The prepared update is handed over with a
+ * single atomic pointer exchange.
+ *
+ * The thread that owns the components calls `poll` once per loop. If nothing
+ * changed that is one atomic exchange. Otherwise the whole update is applied
+ * at once with `Configurable::reload`, which takes no lock. The params are
+ * written as one batch, so neither the loop nor a thread reading them with
+ * `ParamRegistry::consistent` sees half of an update. The applied update is
+ * handed back to the background thread to be freed.
+ */
+class ConfigWatcher {
+public:
+    /**
+     * @brief Status codes for the ConfigWatcher class.
+     */
+    enum Status { ST_GOOD = 0, ST_FOPEN_FAIL, ST_PARSE_FAIL, ST_WATCH_FAIL };
+
+    /**
+     * @brief Construct a new ConfigWatcher object.
+     *
+     * @param filepath Path to the `.json` configuration file.
+     * @param period Longest time between checks of the file (s).
+     */
+    explicit ConfigWatcher(const std::string& filepath, double period = 0.1);
+
+    /**
+     * @brief Destroy the ConfigWatcher object, stopping the watcher.
+     */
+    ~ConfigWatcher();
+
+    ConfigWatcher(const ConfigWatcher& other)            = delete;
+    ConfigWatcher& operator=(const ConfigWatcher& other) = delete;
+
+    /**
+     * @brief Start watching the file. The file is read as the baseline that
+     * later changes are compared against.
+     *
+     * @return int Status code. 0 for success.
+     */
+    int start(void);
+
+    /**
+     * @brief Stop watching the file. Pending updates are discarded.
+     */
+    void stop(void);
+
+    /**
+     * @brief Apply a pending update, if there is one. Must be called from the
+     * thread that owns the configured components.
+     *
+     * @return bool True if an update was applied.
+     */
+    bool poll(void);
+
+    /**
+     * @brief Get the number of updates applied.
+     *
+     * @return uint64_t Number of updates.
+     */
+    uint64_t reloads(void) const {
+        return reloadCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    /// @brief Path to the configuration file.
+    std::string filepath;
+
+    /// @brief Longest time between checks of the file (s).
+    double period;
+
+    /// @brief Last parsed configuration, owned by the watcher thread.
+    nlohmann::json current;
+
+    /// @brief Update waiting to be applied.
+    std::atomic<Configurable::Reload*> pending{nullptr};
+
+    /// @brief Applied updates waiting to be freed.
+    SpscQueue<Configurable::Reload*, 8> retired;
+
+    /// @brief Number of applied updates.
+    std::atomic<uint64_t> reloadCount{0};
+
+    /// @brief Cleared to stop the watcher thread.
+    std::atomic<bool> running{false};
+
+    /// @brief The watcher thread.
+    std::thread watcher;
+
+    /**
+     * @brief Watcher thread loop.
+     *
+     * @param fd inotify descriptor, or -1 to poll the modification time.
+     */
+    void run(int fd);
+
+    /**
+     * @brief Parse the file, and publish it if anything changed.
+     */
+    void check(void);
+
+    /**
+     * @brief Free the applied updates.
+     */
+    void freeRetired(void);
+
+    /**
+     * @brief Parse the file.
+     *
+     * @param out Set to the parsed configuration.
+     * @return int Status code. 0 for success.
+     */
+    int parse(nlohmann::json& out) const;
+};
+
+} // namespace Dae
@@ -9,16 +9,35 @@
  */
 #pragma once
 
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <map>
+#include <set>
 #include <string>
+#include <vector>
 #include <json.h>
 
 #include "common/Logging.h"
 #include "common/Common.h"
+#include "common/ConfigSnapshot.h"
+#include "common/ConfigStore.h"
+#include "common/FrozenConfig.h"
+#include "common/Param.h"
 
 namespace Dae {
 
 /**
  * @brief Simple JSON wrapper for configurable classes.
+ *
+ * Values are read from the object's section of the global configuration,
+ * unless they have been overridden with `cnf`. Numeric values that are read
+ * often should be declared once with `param`, which returns a handle that is
+ * a single load to read.
+ *
+ * The global configuration is held in a `ConfigStore`, so objects can be
+ * constructed and configured on several threads at once. A single object
+ * must still only be used from one thread at a time.
  */
 class Configurable {
 public:
@@ -27,6 +46,38 @@ public:
      */
     enum Status { ST_GOOD = 0, ST_FOPEN_FAIL, ST_PARSE_FAIL };
 
+    /**
+     * @brief An object with changed keys in a reload.
+     */
+    struct Target {
+        /// @brief The object, cleared if it is destroyed first.
+        std::atomic<Configurable*> object;
+        /// @brief Its changed keys.
+        const std::vector<std::string>* keys;
+    };
+
+    /**
+     * @brief A newly parsed configuration, and the keys that changed in it.
+     */
+    struct Reload {
+        /// @brief The new global configuration.
+        nlohmann::json config;
+        /// @brief Changed keys, by object key.
+        std::map<std::string, std::vector<std::string>> changed;
+        /// @brief New values of the changed params, set by `prepare`.
+        std::vector<ParamRegistry::Write> params;
+        /// @brief Objects with changed keys, set by `prepare`.
+        std::deque<Target> targets;
+        /// @brief Set once prepared.
+        bool prepared = false;
+
+        /**
+         * @brief Destroy the Reload object. Must not be destroyed on the
+         * thread that applies it, as it takes the object list lock.
+         */
+        ~Reload();
+    };
+
     /**
      * @brief Construct a new Configurable object.
      *
@@ -34,6 +85,15 @@ public:
      */
     explicit Configurable(const std::string& key);
 
+    /// @copydoc Dae::Configurable::Configurable
+    Configurable(const Configurable& other);
+
+    /// @copydoc Dae::Configurable::Configurable
+    Configurable(Configurable&& other);
+
+    Configurable& operator=(const Configurable& other) = default;
+    Configurable& operator=(Configurable&& other)      = default;
+
     /**
      * @brief Destroy the Configurable object.
      */
@@ -44,11 +104,56 @@ public:
      * file. This should be called before initializing any other object that
      * extends the Configurable class.
      *
+     * If an up to date snapshot of the file exists (see `ConfigSnapshot`) it
+     * is mapped instead, and the JSON is never parsed. The configuration is
+     * published as a new version, and is unchanged if the file cannot be
+     * read. Once published, every declared param is set from it, or to its
+     * default if it is not configured, dropping earlier `cnf` writes.
+     *
      * @param filepath Path to the `.json` configuration file.
      * @return int Status code. 0 for success.
      */
     static int initialize(const std::string& filepath);
 
+    /**
+     * @brief Check whether the configuration is read from a snapshot.
+     *
+     * @return bool True if a snapshot is mapped.
+     */
+    static bool snapshotLoaded(void) {
+        ConfigStore::Reader reader;
+        return reader->snapshot.isOpen();
+    }
+
+    /**
+     * @brief Prepare a reloaded configuration to be applied, on any thread
+     * but the one that applies it.
+     *
+     * The new configuration is moved out of `update` and published, so
+     * objects created from then on already read it. The new values of the
+     * changed params are read, and the live objects with changed keys are
+     * found.
+     *
+     * @param update The reloaded configuration.
+     */
+    static void prepare(Reload& update);
+
+    /**
+     * @brief Apply a prepared reload.
+     *
+     * Every changed param is written in one batch (see
+     * `ParamRegistry::store`). Then every live object with changed keys has
+     * them applied as one batch, see `cnf`, and its `cnf` overrides of those
+     * keys are dropped. Removed params go back to their default. Objects
+     * with no changed keys are untouched.
+     *
+     * Takes no lock, unless `update` has not been prepared, and must be
+     * called from the thread that owns the configured objects.
+     *
+     * @param update The reloaded configuration.
+     */
+    static void reload(Reload& update);
+
     /**
      * @brief Configure the class from it's configuration.
      *
@@ -61,27 +166,38 @@ public:
     /**
      * @brief Configure a key in the class' configuration.
      *
+     * Keys declared with `param` are written straight to the parameter, which
+     * is shared by every object with the same object key and is the only copy
+     * of the value, so `confNum` reads it too. Other keys are overridden for
+     * this object only. The change hooks of the key are then run, and
+     * `configure` is only called if the key is neither a param nor has a
+     * hook.
+     *
      * @param key The value key.
      * @param value The value to change to.
      * @return double The previous value.
      */
     void cnf(const std::string& key, const double value);
 
+    /// @copydoc Dae::Configurable::cnf(const std::string&, const double)
+    void cnf(const std::string& key, const std::string& value);
+
     /**
-     * @brief Configure a key in the class' configuration.
+     * @brief Configure several keys as one update. Every value is written
+     * before anything is recomputed, and each hook, and `configure`, runs at
+     * most once.
      *
-     * @param key The value key.
-     * @param value The value to change to.
-     * @return std::string The previous value.
+     * @param values JSON object of the keys and values to change to.
      */
-    void cnf(const std::string& key, const std::string& value);
+    void cnf(const nlohmann::json& values);
 
 protected:
     /// @brief The string key of this configurable object.
     std::string key;
 
     /**
-     * @brief Extract an double value from the configuration.
+     * @brief Extract an double value from the configuration. Keys declared
+     * as a param, by any object with this object key, read the param.
      *
      * @param key String key.
      * @param defaultVal Default value if it is not found.
@@ -99,30 +215,159 @@ protected:
     std::string confStr(const std::string& key,
                         const std::string& defaultVal = "");
 
+    /**
+     * @brief Get every key of the object's configuration, whether it is
+     * overridden or in the global configuration.
+     *
+     * @return std::vector<std::string> The keys.
+     */
+    std::vector<std::string> keys(void) const;
+
+    /**
+     * @brief Declare a numeric parameter, named "<object key>.<key>".
+     *
+     * The parameter is created from the configuration the first time it is
+     * declared, and every later declaration shares it. It is set again
+     * whenever the configuration is initialized or reloaded.
+     *
+     * @tparam T The parameter type.
+     * @param key String key.
+     * @param defaultVal Default value if it is not found.
+     * @return Param<T> Handle to the parameter.
+     */
+    template <typename T> Param<T> param(const std::string& key,
+                                         const T            defaultVal) {
+        return Param<T>(bind(key, static_cast<double>(defaultVal)));
+    }
+
+#ifdef DAE_FROZEN_CONFIG
+    /**
+     * @brief Mark a key as frozen, so updates to it are rejected. Used by
+     * `DAE_PARAM` in a frozen build.
+     *
+     * @tparam F The frozen member type.
+     * @param key String key.
+     * @return F The frozen member.
+     */
+    template <typename F> F freeze(const std::string& key) {
+        frozen.insert(key);
+        return {};
+    }
+#endif
+
+    /**
+     * @brief Register a hook that recomputes whatever depends on some keys.
+     * It runs once per update that changes any of them, instead of
+     * `configure`.
+     *
+     * @tparam D The derived class.
+     * @param keys The keys the hook depends on.
+     * @param hook Member function to run.
+     */
+    template <typename D>
+    void onChange(const std::vector<std::string>& keys, void (D::*hook)(void)) {
+        // Bound on call rather than to `this`, so copies call their own hook
+        hooks.push_back({keys, [hook](Configurable& self) {
+                             (static_cast<D&>(self).*hook)();
+                         }});
+    }
+
+    /**
+     * @brief Check whether a key changed in the update being applied. Every
+     * key counts as changed outside of an update, such as during the first
+     * `configure`.
+     *
+     * @param key String key.
+     * @return bool True if the key changed.
+     */
+    bool changed(const std::string& key) const {
+        return !updating || dirty.count(key) != 0;
+    }
+
 private:
     using json = nlohmann::json;
 
-    /// @brief Global json instance.
-    static json global;
-
-    /// @brief Class json instance.
+    /// @brief Values overridden with `cnf`.
     json config;
 
+    /// @brief Slots of the declared parameters, by key.
+    std::map<std::string, std::atomic<double>*> params;
+
+    /**
+     * @brief A change hook and the keys it depends on.
+     */
+    struct Hook {
+        /// @brief The keys.
+        std::vector<std::string> keys;
+        /// @brief Calls the hook on an object.
+        std::function<void(Configurable&)> call;
+    };
+
+    /// @brief Change hooks.
+    std::vector<Hook> hooks;
+
+    /// @brief Keys changed in the update being applied.
+    std::set<std::string> dirty;
+
+    /// @brief Set while an update is being applied.
+    bool updating = false;
+
+#ifdef DAE_FROZEN_CONFIG
+    /// @brief Keys of the params compiled in as constants.
+    std::set<std::string> frozen;
+#endif
+
+    /**
+     * @brief Write a value to its param if it has one, otherwise to the
+     * overrides. Frozen keys are not written.
+     *
+     * @param key String key.
+     * @param value The value.
+     */
+    void write(const std::string& key, const json& value);
+
+    /**
+     * @brief Run the hooks of changed keys, and `configure` if any of them
+     * is neither a param nor hooked. Frozen keys are rejected.
+     *
+     * @param changes The changed keys.
+     */
+    void apply(const std::vector<std::string>& changes);
+
+    /**
+     * @brief Get the slot of a parameter, creating it if it does not exist.
+     *
+     * @param key String key.
+     * @param defaultVal Default value if it is not found.
+     * @return std::atomic<double>* The slot.
+     */
+    std::atomic<double>* bind(const std::string& key, double defaultVal);
+
+    /**
+     * @brief Look up a value, in the overrides and then the global
+     * configuration, without modifying either.
+     *
+     * @param key String key.
+     * @param root The global configuration, pinned by the caller.
+     * @return const json* The value, or nullptr if it is not found.
+     */
+    const json* lookup(const std::string& key, const json& root) const;
+
     /**
-     * @brief Helper function to extract a field from a json object.
+     * @brief Helper function to extract a field from the configuration.
      *
      * @tparam T The type of the field.
-     * @param json The json object.
      * @param key The string key.
      * @param defaultValue A default value.
      * @return T The found object or the default value;
      */
     template <typename T>
-    static T getOrDefault(const nlohmann::json& json, const std::string& key,
-                          const T& defaultValue) {
-        if (json.contains(key) && !json[key].is_null()) {
+    T getOrDefault(const std::string& key, const T& defaultValue) const {
+        ConfigStore::Reader reader;
+        const json*         value = lookup(key, reader->config);
+        if (value != nullptr && !value->is_null()) {
             try {
-                return json[key].get<T>();
+                return value->get<T>();
             } catch (const nlohmann::json::exception& e) {
                 info("Failed to parse %s as a " MSTR(T) ", \"%s\"", key.c_str(),
                      e.what());
@@ -0,0 +1,114 @@
+/**
+ * @file FrozenConfig.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of compile time frozen configuration values.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @brief Declare a numeric configuration parameter member, see `Param`.
+ *
+ * Normally this is a `Param` handle, read at runtime. When the build sets
+ * `DAE_FROZEN_CONFIG` it is an empty member whose value is a compile time
+ * constant taken from the frozen configuration, so it folds into the code
+ * that uses it. Both are read with `get()` or by conversion to `type`.
+ *
+ * Frozen values are looked up by `object`, which should be the class's
+ * default configuration key. Only these members are frozen: keys read with
+ * `confNum`, `confStr` or `param` are still read from the configuration at
+ * runtime. A `cnf` or reload that changes a frozen key is rejected with a
+ * warning, since the value it would set is compiled in.
+ *
+ * @param type Arithmetic type of the parameter.
+ * @param name Member name.
+ * @param object Configuration object key, a string literal.
+ * @param key Parameter key, a string literal.
+ * @param defaultVal Default value if it is not configured.
+ */
+#ifdef DAE_FROZEN_CONFIG
+#define DAE_PARAM(type, name, object, key, defaultVal)                         \
+    struct name##Frozen {                                                      \
+        static constexpr type value =                                          \
+            Dae::frozenValue<object, key, type>(defaultVal);                   \
+        constexpr type get(void) const { return value; }                       \
+        constexpr operator type() const { return value; }                      \
+    };                                                                         \
+    [[no_unique_address]] name##Frozen name = freeze<name##Frozen>(key)
+#else
+#define DAE_PARAM(type, name, object, key, defaultVal)                         \
+    Dae::Param<type> name = param(key, static_cast<type>(defaultVal))
+#endif
+
+namespace Dae {
+
+/**
+ * @brief String usable as a template argument.
+ *
+ * @tparam N Length of the string including the terminator.
+ */
+template <size_t N> struct FixedString {
+    constexpr FixedString(const char (&value)[N]) {
+        for (size_t i = 0; i < N; i++) {
+            str[i] = value[i];
+        }
+    }
+
+    /// @brief The string.
+    char str[N]{};
+};
+
+/**
+ * @brief Frozen value of a configuration key. Specialised by the generated
+ * `FrozenConfigValues.h` for every scalar in the frozen configuration.
+ *
+ * @tparam Object Configuration object key.
+ * @tparam Key Key within the object.
+ */
+template <FixedString Object, FixedString Key> struct Frozen {
+    /// @brief Set if the key is in the frozen configuration.
+    static constexpr bool FOUND = false;
+    /// @brief Set if the value is a number or boolean.
+    static constexpr bool NUMERIC = false;
+    /// @brief Number value, booleans are 0 or 1.
+    static constexpr double NUMBER = 0;
+    /// @brief String value.
+    static constexpr std::string_view STRING = {};
+};
+
+/**
+ * @brief Get a frozen numeric value, converted exactly as a `Param` would
+ * convert the same value read at runtime.
+ *
+ * @tparam Object Configuration object key.
+ * @tparam Key Key within the object.
+ * @tparam T The parameter type.
+ * @param defaultVal Default value if it is not a frozen number.
+ * @return T The value.
+ */
+template <FixedString Object, FixedString Key, typename T>
+constexpr T frozenValue(T defaultVal) {
+    double value = static_cast<double>(defaultVal);
+    if constexpr (Frozen<Object, Key>::NUMERIC) {
+        value = Frozen<Object, Key>::NUMBER;
+    }
+
+    if constexpr (std::is_same_v<T, bool>) {
+        return value != 0.0;
+    } else {
+        return static_cast<T>(value);
+    }
+}
+
+} // namespace Dae
+
+#ifdef DAE_FROZEN_CONFIG
+#include "FrozenConfigValues.h"
+#endif
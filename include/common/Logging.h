@@ -9,70 +9,627 @@
  */
 #pragma once
 
+#include <atomic>
+#include <cinttypes>
 #include <cstdio>
 #include <ctime>
 #include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 #include "common/Common.h"
 
+/**
+ * @brief Minimum level of log call sites that are compiled in. Call sites
+ * below it are stripped entirely. Defaults to `Logger::LV_DEBUG`, so trace call
+ * sites are only compiled in when it is lowered to `0`.
+ */
+#ifndef DAE_LOG_MIN_LEVEL
+#define DAE_LOG_MIN_LEVEL 1
+#endif
+
 namespace Dae {
 
+/**
+ * @brief Asynchronous, deferred formatting logger backing the logging macros.
+ *
+ * A call site does not format anything. It copies a pointer to its static
+ * `Site` descriptor (the format string ID) and the raw argument bytes into a
+ * per-thread single producer, single consumer ring. A background thread drains
+ * every ring, formats the records and writes them to stdout / stderr.
+ *
+ * If a ring is full the record is dropped and counted rather than blocking the
+ * calling thread. The number of dropped records is reported by the background
+ * thread.
+ *
+ * Arguments must be arithmetic, enum, pointer or C string values. C strings
+ * are copied into the record (up to `MAX_STRING_LENGTH` bytes) so temporaries
+ * such as `std::string::c_str()` are safe to log.
+ */
+class Logger {
+public:
+    /**
+     * @brief Severity of a log record.
+     */
+    enum Level : uint8_t {
+        LV_TRACE = 0,
+        LV_DEBUG,
+        LV_INFO,
+        LV_WARN,
+        LV_ERROR,
+        LV_OFF
+    };
+
+    /**
+     * @brief Register the runtime level of a tag. Called once per tag during
+     * static initialisation. The level is set to the one configured for the
+     * name, if there is one, and otherwise the default.
+     *
+     * @param name The tag name.
+     * @param level The runtime level of the tag.
+     * @return bool Always true.
+     */
+    static bool registerTag(const char* name, std::atomic<uint8_t>& level);
+
+    /**
+     * @brief Compile time string wrapper, so tag names can be template
+     * arguments. The file extension is dropped, so a header and its source
+     * file share a tag.
+     *
+     * @tparam N Length of the string including the terminator.
+     */
+    template <size_t N> struct TagName {
+        constexpr TagName(const char (&name)[N]) {
+            size_t end = N - 1;
+            for (size_t i = 0; i < N - 1; i++) {
+                if (name[i] == '.') end = i;
+            }
+            for (size_t i = 0; i < end; i++) {
+                str[i] = name[i];
+            }
+        }
+
+        /// @brief The tag name.
+        char str[N]{};
+    };
+
+    /**
+     * @brief Runtime level of a subsystem tag. Every tag gets its own level
+     * variable, so the runtime check is a single load and compare.
+     *
+     * A call site's tag is the name of the file it is written in, so call
+     * sites in headers have the same tag in every translation unit.
+     *
+     * @tparam Name The tag name.
+     */
+    template <TagName Name> struct Tag {
+        /// @brief Minimum level that is logged for this tag.
+        static inline std::atomic<uint8_t> level{LV_INFO};
+
+        /// @brief Registers the tag by name so it can be configured.
+        static inline const bool registered = registerTag(Name.str, level);
+
+        /**
+         * @brief Check whether a record of a level should be logged.
+         *
+         * @param lvl The level of the record.
+         * @return bool True if the record should be logged.
+         */
+        static bool enabled(Level lvl) {
+            (void)registered;
+            return lvl >= level.load(std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * @brief Static descriptor of a logging call site.
+     */
+    struct Site {
+        /// @brief Severity of the call site.
+        Level level;
+        /// @brief Complete printf format string of the call site.
+        const char* fmt;
+    };
+
+    /// @brief Function that formats a record payload with a format string.
+    using Decoder = void (*)(FILE* out, const char* fmt,
+                             const uint8_t* payload);
+
+    /// @brief Maximum number of bytes copied from a C string argument.
+    static constexpr size_t MAX_STRING_LENGTH = 1 << 10;
+
+    /// @brief Size in bytes of each per-thread record ring.
+    static constexpr size_t RING_SIZE = 1 << 16;
+
+    /// @brief Number of records a rate limited call site may burst.
+    static constexpr uint64_t RATE_BURST = 3;
+
+    /**
+     * @brief Coarse monotonic clock (us), advanced by the background thread.
+     * Reading it is a single load, which keeps rate limit checks cheap.
+     */
+    static inline std::atomic<uint64_t> coarseMicros{0};
+
+    /**
+     * @brief Per call site token bucket, implemented as a generic cell rate
+     * algorithm so that the whole bucket state is a single word.
+     *
+     * The suppressed path is three relaxed loads, a compare and a relaxed
+     * counter increment. The counter is not a read-modify-write, so a
+     * suppressed count may be slightly low when several threads share a call
+     * site.
+     *
+     * A call site is handed to the background thread the first time it
+     * suppresses a record, which reports the count itself once the call site
+     * has gone quiet, and at shutdown.
+     */
+    struct RateLimit {
+        /// @brief Theoretical arrival time of the next record (us).
+        std::atomic<uint64_t> tat{0};
+        /// @brief Records suppressed since the last one was let through.
+        std::atomic<uint32_t> suppressed{0};
+        /// @brief Set once the call site is known to the background thread.
+        std::atomic<bool> tracked{false};
+        /// @brief Summary call site, set before the call site is tracked.
+        const Site* summary = nullptr;
+        /// @brief Next tracked call site.
+        RateLimit* next = nullptr;
+
+        /**
+         * @brief Try to take a token from the bucket.
+         *
+         * @param period Period (us) that one token is refilled in.
+         * @param site Call site of the suppressed count summary.
+         * @param count Set to the number of suppressed records on success.
+         * @return bool True if the record should be logged.
+         */
+        bool acquire(uint64_t period, const Site& site, uint32_t& count) {
+            const uint64_t now  = coarseMicros.load(std::memory_order_relaxed);
+            uint64_t       last = tat.load(std::memory_order_relaxed);
+
+            if (last > now + period * (RATE_BURST - 1) ||
+                !tat.compare_exchange_strong(last,
+                                             (last > now ? last : now) + period,
+                                             std::memory_order_relaxed)) {
+                if (!tracked.load(std::memory_order_relaxed)) track(site);
+                suppressed.store(
+                    suppressed.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+                return false;
+            }
+
+            count = suppressed.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * @brief Check whether this is the first time the call site is hit.
+         *
+         * @return bool True exactly once.
+         */
+        bool once(void) {
+            if (tat.load(std::memory_order_relaxed) != 0) return false;
+            return tat.exchange(1, std::memory_order_relaxed) == 0;
+        }
+
+        /**
+         * @brief Hand the call site to the background thread, so that its
+         * suppressed count is reported even if it is never reached again.
+         *
+         * @param site Call site of the suppressed count summary.
+         */
+        void track(const Site& site);
+    };
+
+    /**
+     * @brief Queue a log record for the call site with the raw arguments.
+     *
+     * @tparam Args Argument types.
+     * @param site The static call site descriptor.
+     * @param args The format arguments.
+     */
+    template <typename... Args>
+    static void write(const Site& site, const Args&... args) {
+        const size_t size = (0 + ... + encodedSize(args));
+
+        uint8_t* payload = reserve(site, &decode<Stored<Args>...>, size);
+        if (payload == nullptr) return;
+
+        (encode(payload, args), ...);
+        commit();
+    }
+
+    /**
+     * @brief Block until every record queued before this call has been
+     * written out.
+     */
+    static void flush(void);
+
+    /**
+     * @brief Set the runtime level of every tag, including tags registered
+     * later.
+     *
+     * @param level The minimum level to log.
+     */
+    static void setLevel(Level level);
+
+    /**
+     * @brief Set the runtime level of a single tag. A tag that is not
+     * registered yet keeps the level, and takes it when it registers.
+     *
+     * @param tag The tag name.
+     * @param level The minimum level to log.
+     * @return bool False if the tag is not registered yet.
+     */
+    static bool setLevel(const std::string& tag, Level level);
+
+    /**
+     * @brief Get the runtime level of a single tag.
+     *
+     * @param tag The tag name.
+     * @return Level The minimum level logged, LV_OFF if the tag is neither
+     * registered nor set.
+     */
+    static Level getLevel(const std::string& tag);
+
+    /**
+     * @brief Get the names of every registered tag.
+     *
+     * @return std::vector<std::string> The tag names.
+     */
+    static std::vector<std::string> tags(void);
+
+    /**
+     * @brief Parse a level name, one of "trace", "debug", "info", "warn",
+     * "error" or "off".
+     *
+     * @param name The level name.
+     * @param level Set to the parsed level on success.
+     * @return bool False if the name is not a level.
+     */
+    static bool parseLevel(const std::string& name, Level& level);
+
+    /**
+     * @brief Redirect the logger output. Pending records are flushed to the
+     * previous streams first.
+     *
+     * @param out Stream for debug, info and warning records.
+     * @param err Stream for error records.
+     */
+    static void redirect(FILE* out, FILE* err);
+
+    /**
+     * @brief Get the total number of records dropped because a ring was full.
+     *
+     * @return uint64_t Number of dropped records.
+     */
+    static uint64_t dropped(void);
+
+    /**
+     * @brief Never called, only exists so that the compiler checks the format
+     * string against the arguments at every call site.
+     *
+     * @param fmt Format string.
+     * @param ... Variadic arguments.
+     */
+    [[gnu::format(printf, 1, 2)]] static void checkFormat(const char* fmt,
+                                                          ...) {
+        (void)fmt;
+    }
+
+    /**
+     * @brief Format and print a message, used by the record decoders.
+     *
+     * @param out The output stream.
+     * @param fmt Format string.
+     * @param ... Variadic arguments.
+     */
+    static void print(FILE* out, const char* fmt, ...);
+
+private:
+    /// @brief Type of an argument once it has been stored in a record.
+    template <typename T>
+    using Stored = std::conditional_t<
+        std::is_same_v<std::decay_t<T>, char*> ||
+            std::is_same_v<std::decay_t<T>, const char*>,
+        const char*, std::decay_t<T>>;
+
+    /**
+     * @brief Reserve a record in the calling thread's ring.
+     *
+     * @param site Call site of the record.
+     * @param decoder Decoder for the record payload.
+     * @param size Size of the payload.
+     * @return uint8_t* Pointer to the payload, or nullptr if it was dropped.
+     */
+    static uint8_t* reserve(const Site& site, Decoder decoder, size_t size);
+
+    /**
+     * @brief Publish the record reserved last by the calling thread.
+     */
+    static void commit(void);
+
+    /**
+     * @brief Length of a C string argument as it will be stored.
+     *
+     * @param str The string.
+     * @return size_t Stored length, not including the terminator.
+     */
+    static size_t storedLength(const char* str) {
+        if (str == nullptr) return 6;
+
+        size_t len = 0;
+        while (len < MAX_STRING_LENGTH && str[len] != '\0') {
+            len++;
+        }
+        return len;
+    }
+
+    template <typename T> static size_t encodedSize(const T& arg) {
+        if constexpr (std::is_same_v<Stored<T>, const char*>) {
+            return sizeof(uint32_t) + storedLength(arg) + 1;
+        } else {
+            static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+                              std::is_pointer_v<std::decay_t<T>>,
+                          "Log arguments must be arithmetic, enum, pointer "
+                          "or C string values");
+            return sizeof(Stored<T>);
+        }
+    }
+
+    template <typename T> static void encode(uint8_t*& out, const T& arg) {
+        if constexpr (std::is_same_v<Stored<T>, const char*>) {
+            const char*    raw = arg;
+            const char*    str = raw == nullptr ? "(null)" : raw;
+            const uint32_t len = static_cast<uint32_t>(storedLength(raw));
+            memcpy(out, &len, sizeof(len));
+            memcpy(out + sizeof(len), str, len);
+            out[sizeof(len) + len] = '\0';
+            out += sizeof(len) + len + 1;
+        } else {
+            const Stored<T> value = arg;
+            memcpy(out, &value, sizeof(value));
+            out += sizeof(value);
+        }
+    }
+
+    template <typename T> static T extract(const uint8_t*& in) {
+        if constexpr (std::is_same_v<T, const char*>) {
+            uint32_t len;
+            memcpy(&len, in, sizeof(len));
+            const char* str = reinterpret_cast<const char*>(in + sizeof(len));
+            in += sizeof(len) + len + 1;
+            return str;
+        } else {
+            T value;
+            memcpy(&value, in, sizeof(value));
+            in += sizeof(value);
+            return value;
+        }
+    }
+
+    template <typename... Args>
+    static void decode(FILE* out, const char* fmt,
+                       [[maybe_unused]] const uint8_t* payload) {
+        // Braced initialisation guarantees left to right extraction.
+        std::tuple<Args...> args{extract<Args>(payload)...};
+        std::apply([&](auto... a) { print(out, fmt, a...); }, args);
+    }
+};
+
+/**
+ * @brief Queue a log record for a static call site. Arguments are checked
+ * against the format string at compile time, but only formatted by the
+ * background logging thread.
+ *
+ * Call sites below `DAE_LOG_MIN_LEVEL` compile to nothing, the rest are
+ * filtered by the runtime level of the file's tag, see `Logger::Tag`.
+ *
+ * @param lvl Logger::Level of the record.
+ * @param fmt Format string.
+ * @param ... Variadic arguments.
+ */
+#define DAE_LOG(lvl, fmt, ...)                                                 \
+    do {                                                                       \
+        if (false) ::Dae::Logger::checkFormat(fmt __VA_OPT__(, ) __VA_ARGS__); \
+        if constexpr ((lvl) >= DAE_LOG_MIN_LEVEL) {                            \
+            static constexpr ::Dae::Logger::Site daeLogSite{lvl, fmt};         \
+            if (::Dae::Logger::Tag<__FILE_NAME__>::enabled(lvl))               \
+                ::Dae::Logger::write(daeLogSite __VA_OPT__(, ) __VA_ARGS__);   \
+        }                                                                      \
+    } while (0)
+
+/**
+ * @brief Queue a log record for a rate limited call site. Once the call site
+ * is out of tokens, records are counted rather than queued, and the count is
+ * reported with `summary` the next time the call site is allowed through. A
+ * call site that goes quiet has its count reported by the background thread
+ * once its bucket is full again, or at shutdown.
+ *
+ * @param lvl Logger::Level of the record.
+ * @param ms Period (ms) that one token is refilled in.
+ * @param fmt Format string.
+ * @param summary Format string of the suppressed count summary.
+ * @param ... Variadic arguments.
+ */
+#define DAE_LOG_EVERY(lvl, ms, fmt, summary, ...)                         \
+    do {                                                                  \
+        static ::Dae::Logger::RateLimit      daeLogLimit;                 \
+        static constexpr ::Dae::Logger::Site daeLogSummary{lvl, summary}; \
+        uint32_t                             daeLogSuppressed = 0;        \
+        if (((lvl) >= DAE_LOG_MIN_LEVEL) &&                               \
+            ::Dae::Logger::Tag<__FILE_NAME__>::enabled(lvl) &&            \
+            daeLogLimit.acquire((ms) * 1000ull, daeLogSummary,            \
+                                daeLogSuppressed)) {                      \
+            DAE_LOG(lvl, fmt __VA_OPT__(, ) __VA_ARGS__);                 \
+            if (daeLogSuppressed != 0)                                    \
+                DAE_LOG(lvl, summary, daeLogSuppressed);                  \
+        }                                                                 \
+    } while (0)
+
+/**
+ * @brief Queue a log record only the first time a call site is reached with
+ * its level enabled, so a record filtered out is not used up.
+ *
+ * @param lvl Logger::Level of the record.
+ * @param fmt Format string.
+ * @param ... Variadic arguments.
+ */
+#define DAE_LOG_ONCE(lvl, fmt, ...)                                \
+    do {                                                           \
+        static ::Dae::Logger::RateLimit daeLogLimit;               \
+        if (((lvl) >= DAE_LOG_MIN_LEVEL) &&                        \
+            ::Dae::Logger::Tag<__FILE_NAME__>::enabled(lvl) &&     \
+            daeLogLimit.once()) {                                  \
+            DAE_LOG(lvl, fmt __VA_OPT__(, ) __VA_ARGS__);          \
+        }                                                          \
+    } while (0)
+
+/// @brief Summary format of rate limited call sites.
+#define DAE_SUPPRESSED_FMT "Suppressed %" PRIu32 " similar messages"
+
+/// @brief Complete format string of an error message.
+#define DAE_ERROR_FMT(fmt)                                             \
+    "\033[31m[" __FILE_NAME__ ":" MSTR(__LINE__) "]\033[0m " fmt "!\n"
+
+/// @brief Complete format string of a warning message.
+#define DAE_WARN_FMT(fmt)                                              \
+    "\033[93m[" __FILE_NAME__ ":" MSTR(__LINE__) "]\033[0m " fmt "!\n"
+
+/// @brief Complete format string of an info message.
+#define DAE_INFO_FMT(fmt) "\033[32m[info]\033[0m " fmt ".\n"
+
+/// @brief Complete format string of a trace message.
+#define DAE_TRACE_FMT(fmt)                                             \
+    "\033[90m[" __FILE_NAME__ ":" MSTR(__LINE__) "]\033[0m " fmt "!\n"
+
+/// @brief Complete format string of a debug message.
+#define DAE_DEBUG_FMT(fmt)                                             \
+    "\033[95m[" __FILE_NAME__ ":" MSTR(__LINE__) "]\033[0m " fmt "!\n"
+
 /**
  * @brief Print an error message to stderr.
  *
  * @param fmt Format string.
  * @param ... Variadic arguments.
- * @return fprintf return code.
  */
-#define error(fmt, ...)                                                     \
-    fprintf(stderr, "\033[31m[" __FILE_NAME__                               \
-                    ":" MSTR(__LINE__) "]\033[0m " fmt "!\n" __VA_OPT__(, ) \
-                        __VA_ARGS__)
+#define error(fmt, ...)                                    \
+    DAE_LOG(::Dae::Logger::LV_ERROR,                       \
+            DAE_ERROR_FMT(fmt) __VA_OPT__(, ) __VA_ARGS__)
 
 /**
  * @brief Print a warning message to stdout.
  *
  * @param fmt Format string.
  * @param ... Variadic arguments.
- * @return fprintf return code.
  */
-#define warn(fmt, ...)                                                      \
-    fprintf(stdout, "\033[93m[" __FILE_NAME__                               \
-                    ":" MSTR(__LINE__) "]\033[0m " fmt "!\n" __VA_OPT__(, ) \
-                        __VA_ARGS__)
+#define warn(fmt, ...)                                    \
+    DAE_LOG(::Dae::Logger::LV_WARN,                       \
+            DAE_WARN_FMT(fmt) __VA_OPT__(, ) __VA_ARGS__)
 
 /**
  * @brief Print an info message to stdout.
  *
  * @param fmt Format string.
  * @param ... Variadic arguments.
- * @return fprintf return code.
  */
-#define info(fmt, ...) \
-    fprintf(stdout,    \
-            "\033[32m[info]\033[0m " fmt ".\n" __VA_OPT__(, ) __VA_ARGS__)
+#define info(fmt, ...)                                    \
+    DAE_LOG(::Dae::Logger::LV_INFO,                       \
+            DAE_INFO_FMT(fmt) __VA_OPT__(, ) __VA_ARGS__)
+
+/**
+ * @brief Print an error message to stderr at most once every `ms`
+ * milliseconds, after an initial burst of `Logger::RATE_BURST` messages.
+ *
+ * @param ms Rate limit period (ms).
+ * @param fmt Format string.
+ * @param ... Variadic arguments.
+ */
+#define error_every(ms, fmt, ...)                                              \
+    DAE_LOG_EVERY(::Dae::Logger::LV_ERROR, ms, DAE_ERROR_FMT(fmt),             \
+                  DAE_ERROR_FMT(DAE_SUPPRESSED_FMT) __VA_OPT__(, ) __VA_ARGS__)
+
+/**
+ * @brief Print a warning message to stdout at most once every `ms`
+ * milliseconds, after an initial burst of `Logger::RATE_BURST` messages.
+ *
+ * @param ms Rate limit period (ms).
+ * @param fmt Format string.
+ * @param ... Variadic arguments.
+ */
+#define warn_every(ms, fmt, ...)                                               \
+    DAE_LOG_EVERY(::Dae::Logger::LV_WARN, ms, DAE_WARN_FMT(fmt),               \
+                  DAE_WARN_FMT(DAE_SUPPRESSED_FMT) __VA_OPT__(, ) __VA_ARGS__)
+
+/**
+ * @brief Print an info message to stdout at most once every `ms`
+ * milliseconds, after an initial burst of `Logger::RATE_BURST` messages.
+ *
+ * @param ms Rate limit period (ms).
+ * @param fmt Format string.
+ * @param ... Variadic arguments.
+ */
+#define info_every(ms, fmt, ...)                                               \
+    DAE_LOG_EVERY(::Dae::Logger::LV_INFO, ms, DAE_INFO_FMT(fmt),               \
+                  DAE_INFO_FMT(DAE_SUPPRESSED_FMT) __VA_OPT__(, ) __VA_ARGS__)
+
+/**
+ * @brief Print an error message to stderr the first time it is reached.
+ *
+ * @param fmt Format string.
+ * @param ... Variadic arguments.
+ */
+#define error_once(fmt, ...)                                    \
+    DAE_LOG_ONCE(::Dae::Logger::LV_ERROR,                       \
+                 DAE_ERROR_FMT(fmt) __VA_OPT__(, ) __VA_ARGS__)
+
+/**
+ * @brief Print a warning message to stdout the first time it is reached.
+ *
+ * @param fmt Format string.
+ * @param ... Variadic arguments.
+ */
+#define warn_once(fmt, ...)                                    \
+    DAE_LOG_ONCE(::Dae::Logger::LV_WARN,                       \
+                 DAE_WARN_FMT(fmt) __VA_OPT__(, ) __VA_ARGS__)
+
+/**
+ * @brief Print an info message to stdout the first time it is reached.
+ *
+ * @param fmt Format string.
+ * @param ... Variadic arguments.
+ */
+#define info_once(fmt, ...)                                    \
+    DAE_LOG_ONCE(::Dae::Logger::LV_INFO,                       \
+                 DAE_INFO_FMT(fmt) __VA_OPT__(, ) __VA_ARGS__)
 
 /**
  * @brief Print a test info message to stdout.
  *
  * @param fmt Format string.
  * @param ... Variadic arguments.
- * @return fprintf return code.
  */
-#define testInfo(test, fmt, ...) \
-    fprintf(stdout,    \
-            "\033[38;2;255;165;0m%s : \033[0m" fmt ".\n", test  __VA_OPT__(, ) __VA_ARGS__)
+#define testInfo(test, fmt, ...)                          \
+    DAE_LOG(::Dae::Logger::LV_INFO,                       \
+            "\033[38;2;255;165;0m%s : \033[0m" fmt ".\n", \
+            test __VA_OPT__(, ) __VA_ARGS__)
 
 /**
  * @brief Prompt the user for command line input. Should be followed with a
- * call to read stdin.
+ * call to read stdin. Pending log records are flushed first, and the prompt
+ * itself is printed synchronously.
  *
  * @param fmt Format string.
  * @param ... Variadic arguments.
  * @return fprintf return code.
  */
-#define prompt(fmt, ...) \
-    fprintf(stdout, "\033[96m" fmt "\033[0m" __VA_OPT__(, ) __VA_ARGS__)
+#define prompt(fmt, ...)                                                   \
+    (::Dae::Logger::flush(),                                               \
+     fprintf(stdout, "\033[96m" fmt "\033[0m" __VA_OPT__(, ) __VA_ARGS__))
 
 /**
  * @brief Print an error message when a standard library function fails.
@@ -80,9 +637,8 @@ namespace Dae {
  * @param code Error code, should be `errno` for most standard library calls.
  * @param fmt Format string.
  * @param ... Variadic arguments.
- * @return fprintf return code.
  */
-#define stl_error(code, fmt, ...) \
+#define stl_error(code, fmt, ...)                                              \
     error(fmt ", cause %d: %s" __VA_OPT__(, ) __VA_ARGS__, code, strerror(code))
 
 /**
@@ -91,34 +647,31 @@ namespace Dae {
  * @param code Error code, should be `errno` for most standard library calls.
  * @param fmt Format string.
  * @param ... Variadic arguments.
- * @return fprintf return code.
  */
-#define stl_warn(code, fmt, ...) \
+#define stl_warn(code, fmt, ...)                                               \
     warn(fmt ", cause %d: %s" __VA_OPT__(, ) __VA_ARGS__, code, strerror(code))
 
-#ifdef DEBUG
 /**
- * @brief Print a debug message. This is only defined when the program is built
- * in debug mode, with `DEBUG` defined.
+ * @brief Print a debug message to stdout. Only logged when the runtime level of
+ * the tag is `LV_DEBUG` or lower, which is the default when built with `DEBUG`
+ * defined.
  *
  * @param fmt Format string.
  * @param ... Variadic arguments.
- * @return fprintf return code.
  */
-#define debug(fmt, ...)                                                     \
-    fprintf(stdout, "\033[95m[" __FILE_NAME__                               \
-                    ":" MSTR(__LINE__) "]\033[0m " fmt "!\n" __VA_OPT__(, ) \
-                        __VA_ARGS__)
-#else
+#define debug(fmt, ...)                                    \
+    DAE_LOG(::Dae::Logger::LV_DEBUG,                       \
+            DAE_DEBUG_FMT(fmt) __VA_OPT__(, ) __VA_ARGS__)
+
 /**
- * @brief Print a debug message. This is only defined when the program is built
- * in debug mode, with `DEBUG` defined.
+ * @brief Print a trace message to stdout. Stripped at compile time unless
+ * `DAE_LOG_MIN_LEVEL` is `0`.
  *
  * @param fmt Format string.
  * @param ... Variadic arguments.
- * @return fprintf return code.
  */
-#define debug(fmt, ...)
-#endif
+#define trace(fmt, ...)                                    \
+    DAE_LOG(::Dae::Logger::LV_TRACE,                       \
+            DAE_TRACE_FMT(fmt) __VA_OPT__(, ) __VA_ARGS__)
 
-} // namespace Dae
\ No newline at end of file
+} // namespace Dae
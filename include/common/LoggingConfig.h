@@ -0,0 +1,49 @@
+/**
+ * @file LoggingConfig.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the LoggingConfig class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <string>
+
+#include "common/Configurable.h"
+
+namespace Dae {
+
+/**
+ * @brief Applies runtime log levels from the configuration.
+ *
+ * The configuration object holds a default `level`, and optionally a level per
+ * subsystem tag, keyed by the tag name. Level names are "trace", "debug",
+ * "info", "warn", "error" and "off".
+ *
+ * ```json
+ * "Logging": {
+ *      "level": "info",
+ *      "JSONBackend": "debug"
+ * }
+ * ```
+ *
+ * Levels below `DAE_LOG_MIN_LEVEL` are compiled out, and cannot be enabled at
+ * runtime.
+ */
+class LoggingConfig : public Configurable {
+public:
+    /**
+     * @brief Construct a new LoggingConfig object, and apply the configured
+     * levels.
+     *
+     * @param key Configuration key.
+     */
+    explicit LoggingConfig(const std::string& key = "Logging");
+
+    /// @copydoc Dae::Configurable::configure
+    void configure(void) override;
+};
+
+} // namespace Dae
@@ -0,0 +1,550 @@
+/**
+ * @file Matrix.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the Matrix class and vector types.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__SSE2__) && !defined(DAE_MATH_SCALAR)
+#include <emmintrin.h>
+#define DAE_MATH_SSE2
+#endif
+
+namespace Dae {
+
+/**
+ * @brief Scalar helpers usable in constant expressions.
+ */
+namespace Math {
+
+/**
+ * @brief Square root, evaluated by Newton's method in constant expressions.
+ *
+ * @param value The value.
+ * @return double The square root, NaN for negative values.
+ */
+constexpr double sqrt(double value) {
+    if (!std::is_constant_evaluated()) return std::sqrt(value);
+    if (value < 0) return __builtin_nan("");
+    if (value == 0 || value == __builtin_inf()) return value;
+
+    double root = value > 1 ? value : 1.0;
+    for (;;) {
+        const double next = 0.5 * (root + value / root);
+        if (next >= root) return root;
+        root = next;
+    }
+}
+
+} // namespace Math
+
+/**
+ * @brief Fixed size, row major, N x M matrix.
+ *
+ * A matrix is a plain aggregate holding exactly its elements, so it can be
+ * brace initialised, is trivially copyable, and `view` maps it onto an
+ * existing array, such as the `Telemetry` fields, without a copy. Values are
+ * returned from operators rather than built with expression templates, as
+ * they are small enough to live in registers; `mulAdd` fuses the common
+ * multiply and accumulate.
+ *
+ * Everything is `constexpr`. At runtime, double precision element wise
+ * operations, dot products and products of small matrices use SSE2 when
+ * it is available, unless `DAE_MATH_SCALAR` is defined. Storage is not
+ * over-aligned, so views of unaligned arrays stay valid, and the SIMD
+ * paths use unaligned loads.
+ *
+ * @tparam N Number of rows.
+ * @tparam M Number of columns.
+ * @tparam T Element type.
+ */
+template <size_t N, size_t M, typename T = double> struct Matrix {
+    static_assert(N > 0 && M > 0, "Matrices must not be empty");
+    static_assert(std::is_arithmetic_v<T>, "Matrices must be arithmetic");
+
+    /// @brief Number of rows.
+    static constexpr size_t ROWS = N;
+
+    /// @brief Number of columns.
+    static constexpr size_t COLS = M;
+
+    /// @brief Number of elements.
+    static constexpr size_t SIZE = N * M;
+
+    /// @brief The elements, row major.
+    T data[SIZE];
+
+    /**
+     * @brief Get a matrix of zeros.
+     */
+    static constexpr Matrix zero(void) {
+        Matrix out{};
+        return out;
+    }
+
+    /**
+     * @brief Get a matrix with every element set to a value.
+     *
+     * @param value The value.
+     */
+    static constexpr Matrix filled(T value) {
+        Matrix out{};
+        for (size_t i = 0; i < SIZE; i++) {
+            out.data[i] = value;
+        }
+        return out;
+    }
+
+    /**
+     * @brief Get the identity matrix.
+     */
+    static constexpr Matrix identity(void) {
+        static_assert(N == M, "Only square matrices have an identity");
+        Matrix out{};
+        for (size_t i = 0; i < N; i++) {
+            out(i, i) = T(1);
+        }
+        return out;
+    }
+
+    /**
+     * @brief Get a diagonal matrix.
+     *
+     * @param diagonal The diagonal elements.
+     */
+    static constexpr Matrix diagonal(const Matrix<N, 1, T>& diagonal) {
+        static_assert(N == M, "Only square matrices have a diagonal");
+        Matrix out{};
+        for (size_t i = 0; i < N; i++) {
+            out(i, i) = diagonal.data[i];
+        }
+        return out;
+    }
+
+    /**
+     * @brief View an array as a matrix, without copying it.
+     *
+     * @param array The array, row major.
+     * @return Matrix& The array as a matrix.
+     */
+    static Matrix& view(T (&array)[SIZE]) {
+        return *reinterpret_cast<Matrix*>(array);
+    }
+
+    /// @copydoc Dae::Matrix::view
+    static const Matrix& view(const T (&array)[SIZE]) {
+        return *reinterpret_cast<const Matrix*>(array);
+    }
+
+    /// @brief Get an element.
+    constexpr T& operator()(size_t row, size_t col) {
+        return data[row * M + col];
+    }
+
+    /// @brief Get an element.
+    constexpr const T& operator()(size_t row, size_t col) const {
+        return data[row * M + col];
+    }
+
+    /// @brief Get an element by its row major index.
+    constexpr T& operator[](size_t i) { return data[i]; }
+
+    /// @brief Get an element by its row major index.
+    constexpr const T& operator[](size_t i) const { return data[i]; }
+
+    /// @brief Get the first element of a vector.
+    constexpr T& x(void) { return data[0]; }
+    /// @brief Get the second element of a vector.
+    constexpr T& y(void) { return data[1]; }
+    /// @brief Get the third element of a vector.
+    constexpr T& z(void) { return data[2]; }
+    /// @brief Get the first element of a vector.
+    constexpr const T& x(void) const { return data[0]; }
+    /// @brief Get the second element of a vector.
+    constexpr const T& y(void) const { return data[1]; }
+    /// @brief Get the third element of a vector.
+    constexpr const T& z(void) const { return data[2]; }
+
+    /// @brief Get a row.
+    constexpr Matrix<1, M, T> row(size_t r) const {
+        Matrix<1, M, T> out{};
+        for (size_t c = 0; c < M; c++) {
+            out.data[c] = (*this)(r, c);
+        }
+        return out;
+    }
+
+    /// @brief Get a column.
+    constexpr Matrix<N, 1, T> col(size_t c) const {
+        Matrix<N, 1, T> out{};
+        for (size_t r = 0; r < N; r++) {
+            out.data[r] = (*this)(r, c);
+        }
+        return out;
+    }
+
+    /**
+     * @brief Get a block of the matrix.
+     *
+     * @tparam R Number of rows of the block.
+     * @tparam C Number of columns of the block.
+     * @param top First row of the block.
+     * @param left First column of the block.
+     * @return Matrix<R, C, T> The block.
+     */
+    template <size_t R, size_t C>
+    constexpr Matrix<R, C, T> block(size_t top, size_t left) const {
+        static_assert(R <= N && C <= M, "Blocks must fit in the matrix");
+        Matrix<R, C, T> out{};
+        for (size_t r = 0; r < R; r++) {
+            for (size_t c = 0; c < C; c++) {
+                out(r, c) = (*this)(top + r, left + c);
+            }
+        }
+        return out;
+    }
+
+    /**
+     * @brief Overwrite a block of the matrix.
+     *
+     * @param top First row of the block.
+     * @param left First column of the block.
+     * @param value The block.
+     */
+    template <size_t R, size_t C>
+    constexpr void setBlock(size_t top, size_t left,
+                            const Matrix<R, C, T>& value) {
+        static_assert(R <= N && C <= M, "Blocks must fit in the matrix");
+        for (size_t r = 0; r < R; r++) {
+            for (size_t c = 0; c < C; c++) {
+                (*this)(top + r, left + c) = value(r, c);
+            }
+        }
+    }
+
+    /// @brief Get the transpose.
+    constexpr Matrix<M, N, T> transpose(void) const {
+        Matrix<M, N, T> out{};
+        for (size_t r = 0; r < N; r++) {
+            for (size_t c = 0; c < M; c++) {
+                out(c, r) = (*this)(r, c);
+            }
+        }
+        return out;
+    }
+
+    /// @brief Element wise addition.
+    constexpr Matrix& operator+=(const Matrix& other) {
+#ifdef DAE_MATH_SSE2
+        if constexpr (std::is_same_v<T, double>) {
+            if (!std::is_constant_evaluated()) {
+                simdAxpy(data, 1.0, other.data);
+                return *this;
+            }
+        }
+#endif
+        for (size_t i = 0; i < SIZE; i++) {
+            data[i] += other.data[i];
+        }
+        return *this;
+    }
+
+    /// @brief Element wise subtraction.
+    constexpr Matrix& operator-=(const Matrix& other) {
+#ifdef DAE_MATH_SSE2
+        if constexpr (std::is_same_v<T, double>) {
+            if (!std::is_constant_evaluated()) {
+                simdAxpy(data, -1.0, other.data);
+                return *this;
+            }
+        }
+#endif
+        for (size_t i = 0; i < SIZE; i++) {
+            data[i] -= other.data[i];
+        }
+        return *this;
+    }
+
+    /// @brief Scale every element.
+    constexpr Matrix& operator*=(T scale) {
+#ifdef DAE_MATH_SSE2
+        if constexpr (std::is_same_v<T, double>) {
+            if (!std::is_constant_evaluated()) {
+                simdScale(data, scale);
+                return *this;
+            }
+        }
+#endif
+        for (size_t i = 0; i < SIZE; i++) {
+            data[i] *= scale;
+        }
+        return *this;
+    }
+
+    /// @brief Divide every element.
+    constexpr Matrix& operator/=(T scale) {
+        if constexpr (std::is_floating_point_v<T>) {
+            return *this *= T(1) / scale;
+        } else {
+            for (size_t i = 0; i < SIZE; i++) {
+                data[i] /= scale;
+            }
+            return *this;
+        }
+    }
+
+    /**
+     * @brief Fused multiply and accumulate, `this += other * scale`, without
+     * a temporary.
+     *
+     * @param other The matrix to add.
+     * @param scale Its scale.
+     * @return Matrix& This matrix.
+     */
+    constexpr Matrix& mulAdd(const Matrix& other, T scale) {
+#ifdef DAE_MATH_SSE2
+        if constexpr (std::is_same_v<T, double>) {
+            if (!std::is_constant_evaluated()) {
+                simdAxpy(data, scale, other.data);
+                return *this;
+            }
+        }
+#endif
+        for (size_t i = 0; i < SIZE; i++) {
+            data[i] += other.data[i] * scale;
+        }
+        return *this;
+    }
+
+    /// @brief Element wise sum.
+    friend constexpr Matrix operator+(Matrix a, const Matrix& b) {
+        return a += b;
+    }
+
+    /// @brief Element wise difference.
+    friend constexpr Matrix operator-(Matrix a, const Matrix& b) {
+        return a -= b;
+    }
+
+    /// @brief Negation.
+    friend constexpr Matrix operator-(Matrix a) { return a *= T(-1); }
+
+    /// @brief Scale every element.
+    friend constexpr Matrix operator*(Matrix a, T scale) { return a *= scale; }
+
+    /// @brief Scale every element.
+    friend constexpr Matrix operator*(T scale, Matrix a) { return a *= scale; }
+
+    /// @brief Divide every element.
+    friend constexpr Matrix operator/(Matrix a, T scale) { return a /= scale; }
+
+    /// @brief Element wise equality.
+    friend constexpr bool operator==(const Matrix& a, const Matrix& b) {
+        for (size_t i = 0; i < SIZE; i++) {
+            if (a.data[i] != b.data[i]) return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Dot product of the elements, such as of two vectors.
+     *
+     * @param other The other matrix.
+     * @return T The dot product.
+     */
+    constexpr T dot(const Matrix& other) const {
+#ifdef DAE_MATH_SSE2
+        if constexpr (std::is_same_v<T, double>) {
+            if (!std::is_constant_evaluated()) {
+                return simdDot(data, other.data);
+            }
+        }
+#endif
+        T sum = 0;
+        for (size_t i = 0; i < SIZE; i++) {
+            sum += data[i] * other.data[i];
+        }
+        return sum;
+    }
+
+    /// @brief Get the squared Euclidean (Frobenius) norm.
+    constexpr T squaredNorm(void) const { return dot(*this); }
+
+    /// @brief Get the Euclidean (Frobenius) norm.
+    constexpr T norm(void) const {
+        return static_cast<T>(Math::sqrt(static_cast<double>(squaredNorm())));
+    }
+
+    /**
+     * @brief Get this scaled to a unit norm. Zero stays zero.
+     */
+    constexpr Matrix normalized(void) const {
+        const T length = norm();
+        return length > T(0) ? *this / length : *this;
+    }
+
+    /**
+     * @brief Cross product of two 3-vectors.
+     *
+     * @param other The other vector.
+     * @return Matrix The cross product.
+     */
+    constexpr Matrix cross(const Matrix& other) const {
+        static_assert(N == 3 && M == 1, "Cross products are of 3-vectors");
+        return {{data[1] * other.data[2] - data[2] * other.data[1],
+                 data[2] * other.data[0] - data[0] * other.data[2],
+                 data[0] * other.data[1] - data[1] * other.data[0]}};
+    }
+
+    /**
+     * @brief Get the skew symmetric matrix of a 3-vector, so that
+     * `a.skew() * b == a.cross(b)`.
+     */
+    constexpr Matrix<3, 3, T> skew(void) const {
+        static_assert(N == 3 && M == 1, "Skew matrices are of 3-vectors");
+        return {{0, -data[2], data[1], data[2], 0, -data[0], -data[1], data[0],
+                 0}};
+    }
+
+#ifdef DAE_MATH_SSE2
+    /// @brief `out += in * scale`, two elements at a time.
+    static void simdAxpy(double* out, double scale, const double* in) {
+        const __m128d s = _mm_set1_pd(scale);
+        size_t        i = 0;
+        for (; i + 2 <= SIZE; i += 2) {
+            const __m128d a = _mm_loadu_pd(out + i);
+            const __m128d b = _mm_loadu_pd(in + i);
+            _mm_storeu_pd(out + i, _mm_add_pd(a, _mm_mul_pd(b, s)));
+        }
+        if constexpr (SIZE % 2 != 0) out[i] += in[i] * scale;
+    }
+
+    /// @brief `out *= scale`, two elements at a time.
+    static void simdScale(double* out, double scale) {
+        const __m128d s = _mm_set1_pd(scale);
+        size_t        i = 0;
+        for (; i + 2 <= SIZE; i += 2) {
+            _mm_storeu_pd(out + i, _mm_mul_pd(_mm_loadu_pd(out + i), s));
+        }
+        if constexpr (SIZE % 2 != 0) out[i] *= scale;
+    }
+
+    /// @brief Dot product, two elements at a time.
+    static double simdDot(const double* a, const double* b) {
+        __m128d sum = _mm_setzero_pd();
+        size_t  i   = 0;
+        for (; i + 2 <= SIZE; i += 2) {
+            sum = _mm_add_pd(
+                sum, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+        }
+        double out = _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+        if constexpr (SIZE % 2 != 0) out += a[i] * b[i];
+        return out;
+    }
+#endif
+};
+
+/// @brief Column vector.
+template <size_t N, typename T = double> using Vector = Matrix<N, 1, T>;
+
+/// @brief 3-vector.
+using Vector3 = Vector<3>;
+
+/// @brief 4-vector.
+using Vector4 = Vector<4>;
+
+/// @brief 3 x 3 matrix.
+using Matrix3 = Matrix<3, 3>;
+
+/// @brief 4 x 4 matrix.
+using Matrix4 = Matrix<4, 4>;
+
+/**
+ * @brief Matrix product.
+ *
+ * At runtime, double precision products are computed a row at a time: each
+ * element of a row of `a` is broadcast and multiplied into a row of `b`, so
+ * the inner loop is SIMD across the columns of the result.
+ *
+ * @return Matrix<N, P, T> The product.
+ */
+template <size_t N, size_t M, size_t P, typename T>
+constexpr Matrix<N, P, T> operator*(const Matrix<N, M, T>& a,
+                                    const Matrix<M, P, T>& b) {
+    Matrix<N, P, T> out{};
+
+#ifdef DAE_MATH_SSE2
+    if constexpr (std::is_same_v<T, double> && P >= 2) {
+        if (!std::is_constant_evaluated()) {
+            for (size_t i = 0; i < N; i++) {
+                double* row = &out.data[i * P];
+                size_t  j   = 0;
+                for (; j + 2 <= P; j += 2) {
+                    __m128d sum = _mm_setzero_pd();
+                    for (size_t k = 0; k < M; k++) {
+                        sum = _mm_add_pd(
+                            sum, _mm_mul_pd(_mm_set1_pd(a(i, k)),
+                                            _mm_loadu_pd(&b.data[k * P + j])));
+                    }
+                    _mm_storeu_pd(row + j, sum);
+                }
+                if constexpr (P % 2 != 0) {
+                    for (size_t k = 0; k < M; k++) {
+                        row[j] += a(i, k) * b(k, j);
+                    }
+                }
+            }
+            return out;
+        }
+    }
+#endif
+
+    for (size_t i = 0; i < N; i++) {
+        for (size_t k = 0; k < M; k++) {
+            const T scale = a(i, k);
+            for (size_t j = 0; j < P; j++) {
+                out(i, j) += scale * b(k, j);
+            }
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Matrix vector product, as dot products of the rows.
+ *
+ * @return Vector<N, T> The product.
+ */
+template <size_t N, size_t M, typename T>
+constexpr Vector<N, T> operator*(const Matrix<N, M, T>& a,
+                                 const Vector<M, T>& v) {
+    Vector<N, T> out{};
+
+#ifdef DAE_MATH_SSE2
+    if constexpr (std::is_same_v<T, double>) {
+        if (!std::is_constant_evaluated()) {
+            for (size_t i = 0; i < N; i++) {
+                out.data[i] = Vector<M, T>::simdDot(&a.data[i * M], v.data);
+            }
+            return out;
+        }
+    }
+#endif
+
+    for (size_t i = 0; i < N; i++) {
+        for (size_t k = 0; k < M; k++) {
+            out.data[i] += a(i, k) * v.data[k];
+        }
+    }
+    return out;
+}
+
+} // namespace Dae
@@ -0,0 +1,299 @@
+/**
+ * @file MessageBus.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the MessageBus, Topic and Subscriber classes.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace Dae {
+
+/**
+ * @brief Untyped base of every topic, so the bus can own them.
+ */
+class TopicBase {
+public:
+    virtual ~TopicBase() = default;
+};
+
+/**
+ * @brief A typed message stream with one publisher and any number of
+ * readers.
+ *
+ * Messages are written into a preallocated ring of `Depth` slots, each
+ * guarded by its own sequence number (a seqlock), so publishing never
+ * allocates or blocks and readers never block the publisher. A reader that
+ * races the publisher retries, which only happens if the publisher laps the
+ * whole ring during one read.
+ *
+ * @tparam T Message type, must be trivially copyable.
+ * @tparam Depth Number of slots, must be a power of two.
+ */
+template <typename T, size_t Depth = 4> class Topic : public TopicBase {
+    static_assert(Depth >= 2 && (Depth & (Depth - 1)) == 0,
+                  "Topic depth must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Topic messages must be trivially copyable");
+
+public:
+    /**
+     * @brief Publish a message, called by the publisher only.
+     *
+     * @param message The message.
+     */
+    void publish(const T& message) {
+        const uint64_t gen  = generation.load(std::memory_order_relaxed) + 1;
+        Slot&          slot = slots[gen & (Depth - 1)];
+
+        // Odd while the slot is being written
+        slot.sequence.store(gen * 2 - 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        memcpy(&slot.message, &message, sizeof(T));
+        slot.stamp = now();
+
+        slot.sequence.store(gen * 2, std::memory_order_release);
+        generation.store(gen, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copy the latest message.
+     *
+     * @param message Set to the message on success.
+     * @param stamp Set to the publish time (ns) on success.
+     * @return uint64_t Generation of the message, 0 if none was published.
+     */
+    uint64_t read(T& message, uint64_t& stamp) const {
+        return visit([&](const T& latest, uint64_t time) {
+            memcpy(&message, &latest, sizeof(T));
+            stamp = time;
+        });
+    }
+
+    /// @copydoc Dae::Topic::read
+    uint64_t read(T& message) const {
+        uint64_t stamp = 0;
+        return read(message, stamp);
+    }
+
+    /**
+     * @brief Read the latest message in place, without copying it.
+     *
+     * `fn` is called with the message and its publish time (ns), and is
+     * called again if the message was overwritten while it ran, so it must
+     * only keep what it read once `visit` returns.
+     *
+     * @tparam Fn Callable as `fn(const T&, uint64_t)`.
+     * @param fn The reader.
+     * @return uint64_t Generation of the message, 0 if none was published.
+     */
+    template <typename Fn> uint64_t visit(Fn&& fn) const {
+        for (;;) {
+            const uint64_t gen = generation.load(std::memory_order_acquire);
+            if (gen == 0) return 0;
+
+            const Slot& slot  = slots[gen & (Depth - 1)];
+            uint64_t    start = slot.sequence.load(std::memory_order_acquire);
+            if (start != gen * 2) continue;
+
+            fn(slot.message, slot.stamp);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) == start) {
+                return gen;
+            }
+        }
+    }
+
+    /**
+     * @brief Get the generation of the latest message, counting up from 1
+     * for the first message.
+     *
+     * @return uint64_t The generation, 0 if none was published.
+     */
+    uint64_t latest(void) const {
+        return generation.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get the current time on the clock messages are stamped with.
+     *
+     * @return uint64_t Monotonic time (ns).
+     */
+    static uint64_t now(void) {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+
+private:
+    /**
+     * @brief A message slot, on its own cache line.
+     */
+    struct alignas(64) Slot {
+        /// @brief Twice the generation of the message, odd while writing.
+        std::atomic<uint64_t> sequence{0};
+        /// @brief Publish time (ns).
+        uint64_t stamp = 0;
+        /// @brief The message.
+        T message{};
+    };
+
+    /// @brief Generation of the latest message, on its own cache line.
+    alignas(64) std::atomic<uint64_t> generation{0};
+
+    /// @brief Message slots.
+    Slot slots[Depth];
+};
+
+/**
+ * @brief A reader of a topic that tracks which messages it has seen, and
+ * optionally limits how often it takes a new one.
+ *
+ * Subscribers are owned by one thread.
+ *
+ * @tparam T Message type.
+ * @tparam Depth Depth of the topic.
+ */
+template <typename T, size_t Depth = 4> class Subscriber {
+public:
+    /**
+     * @brief Construct an unbound Subscriber object, which never updates.
+     */
+    Subscriber() = default;
+
+    /**
+     * @brief Construct a new Subscriber object.
+     *
+     * @param topic The topic, or nullptr.
+     * @param interval Minimum time between updates (s), 0 for every message.
+     */
+    explicit Subscriber(const Topic<T, Depth>* topic, double interval = 0)
+        : topic(topic),
+          interval(static_cast<uint64_t>(interval * 1e9)) {}
+
+    /**
+     * @brief Check whether a message has been published since the last one
+     * this subscriber took. Ignores the update interval.
+     *
+     * @return bool True if there is a new message.
+     */
+    bool updated(void) const {
+        return topic != nullptr && topic->latest() != seen;
+    }
+
+    /**
+     * @brief Take the latest message, if it is new and the update interval
+     * has passed since the last message taken.
+     *
+     * @param message Set to the message on success.
+     * @return bool True if a message was taken.
+     */
+    bool update(T& message) {
+        if (!updated()) return false;
+
+        T              latest;
+        uint64_t       stamp = 0;
+        const uint64_t gen   = topic->read(latest, stamp);
+
+        // Throttled messages stay unseen, so the next one after the interval
+        // is taken
+        if (interval != 0 && taken && stamp - last < interval) return false;
+
+        message = latest;
+        seen    = gen;
+        last    = stamp;
+        taken   = true;
+        return true;
+    }
+
+    /**
+     * @brief Copy the latest message, new or not.
+     *
+     * @param message Set to the message on success.
+     * @return bool False if nothing has been published.
+     */
+    bool copy(T& message) const {
+        return topic != nullptr && topic->read(message) != 0;
+    }
+
+private:
+    /// @brief The topic.
+    const Topic<T, Depth>* topic = nullptr;
+
+    /// @brief Minimum time between updates (ns).
+    uint64_t interval = 0;
+
+    /// @brief Generation of the last message taken.
+    uint64_t seen = 0;
+
+    /// @brief Publish time of the last message taken (ns).
+    uint64_t last = 0;
+
+    /// @brief Set once a message has been taken.
+    bool taken = false;
+};
+
+/**
+ * @brief Global registry of named topics, so modules can find each other's
+ * topics without being wired together.
+ *
+ * Topics are created on first lookup and live until the program exits, so
+ * a topic pointer can be kept. Lookups take a lock, publishing and reading
+ * through a topic do not.
+ */
+class MessageBus {
+public:
+    /**
+     * @brief Get a topic, creating it if it does not exist.
+     *
+     * @tparam T Message type.
+     * @tparam Depth Depth of the topic.
+     * @param name Topic name.
+     * @return Topic<T, Depth>* The topic, or nullptr if the name is already
+     * used by a topic of another type.
+     */
+    template <typename T, size_t Depth = 4>
+    static Topic<T, Depth>* topic(const std::string& name) {
+        TopicBase* (*create)(void) = [] {
+            return static_cast<TopicBase*>(new Topic<T, Depth>());
+        };
+        return static_cast<Topic<T, Depth>*>(
+            find(name, typeid(Topic<T, Depth>), create));
+    }
+
+    /**
+     * @brief Get the name of every topic.
+     *
+     * @return std::vector<std::string> The topic names.
+     */
+    static std::vector<std::string> names(void);
+
+private:
+    /**
+     * @brief Find a topic, creating it if it does not exist.
+     *
+     * @param name Topic name.
+     * @param type Type of the topic.
+     * @param create Creates the topic.
+     * @return TopicBase* The topic, or nullptr on a type mismatch.
+     */
+    static TopicBase* find(const std::string& name, const std::type_info& type,
+                           TopicBase* (*create)(void));
+};
+
+} // namespace Dae
@@ -0,0 +1,215 @@
+/**
+ * @file Param.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the Param and ParamRegistry classes.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Dae {
+
+/**
+ * @brief Global registry of numeric parameters.
+ *
+ * Parameters are named "<object key>.<key>" and each has a slot in a flat,
+ * fixed size array of atomic doubles, so a slot never moves once it has been
+ * handed out. Registration takes a lock. Lookups by name, and reads and
+ * writes through a slot, do not.
+ *
+ * Each slot is read and written on its own. A set of values that must change
+ * together is written with `store`, and read with `consistent`, which never
+ * sees part of one.
+ */
+class ParamRegistry {
+public:
+    /// @brief Number of slots in the flat value array. Parameters past this
+    /// are still registered, but stored individually.
+    static constexpr size_t MAX_PARAMS = 1024;
+
+    /**
+     * @brief A registered parameter.
+     */
+    struct Entry {
+        /// @brief Configuration object key.
+        std::string object;
+        /// @brief Key within the object.
+        std::string key;
+        /// @brief The slot.
+        std::atomic<double>* slot;
+        /// @brief Value when the key is not configured.
+        double fallback;
+    };
+
+    /**
+     * @brief A value to write to a parameter.
+     */
+    struct Write {
+        /// @brief The slot.
+        std::atomic<double>* slot;
+        /// @brief The value.
+        double value;
+    };
+
+    /**
+     * @brief Get the slot of a parameter named "<object>.<key>", creating it
+     * if it does not exist.
+     *
+     * @param object Configuration object key.
+     * @param key Key within the object.
+     * @param value Initial value, only used if the parameter is created.
+     * @param fallback Value when the key is not configured, only used if the
+     * parameter is created.
+     * @return std::atomic<double>* The slot.
+     */
+    static std::atomic<double>* resolve(const std::string& object,
+                                        const std::string& key, double value,
+                                        double fallback);
+
+    /**
+     * @brief Find a parameter, without taking a lock. Entries are never
+     * removed, so the pointer stays valid.
+     *
+     * @param name Full parameter name.
+     * @return const Entry* The parameter, or nullptr if it does not exist.
+     */
+    static const Entry* entry(const std::string& name);
+
+    /**
+     * @brief Find the slot of a parameter.
+     *
+     * @param name Full parameter name.
+     * @return std::atomic<double>* The slot, or nullptr if it does not exist.
+     */
+    static std::atomic<double>* find(const std::string& name) {
+        const Entry* found = entry(name);
+        return found == nullptr ? nullptr : found->slot;
+    }
+
+    /**
+     * @brief Set every parameter to its configured value, or its fallback if
+     * it is not configured.
+     *
+     * @param read Reads the configured value of a parameter, returning false
+     * if it is not configured.
+     */
+    static void refresh(const std::function<bool(const Entry&, double&)>& read);
+
+    /**
+     * @brief Write several parameters as one batch, without taking a lock.
+     * Only one thread may write batches at a time.
+     *
+     * @param writes The values to write.
+     */
+    static void store(const std::vector<Write>& writes);
+
+    /**
+     * @brief Read several parameters without seeing part of a batch. The
+     * reads are run again if a batch is written meanwhile, so they must have
+     * no side effects. A single read needs no such care.
+     *
+     * @tparam F The reads, a callable taking no arguments.
+     * @param read The reads.
+     */
+    template <typename F> static void consistent(F&& read) {
+        for (;;) {
+            const uint64_t before = batch.load(std::memory_order_acquire);
+            if ((before & 1) != 0) continue;
+
+            read();
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (batch.load(std::memory_order_relaxed) == before) return;
+        }
+    }
+
+    /**
+     * @brief Get the name of every registered parameter.
+     *
+     * @return std::vector<std::string> The parameter names.
+     */
+    static std::vector<std::string> names(void);
+
+private:
+    /// @brief Batch sequence number, odd while a batch is being written.
+    static inline std::atomic<uint64_t> batch{0};
+};
+
+/**
+ * @brief Typed handle to a registered parameter.
+ *
+ * A handle is a single pointer to the parameter's slot, so reading it is one
+ * relaxed load and it can be read every tick instead of caching the value.
+ * Handles are created by `Configurable::param`, and copies share the slot.
+ *
+ * @tparam T Arithmetic type of the parameter. Values are stored as doubles, so
+ * integers are exact up to 2^53.
+ */
+template <typename T> class Param {
+    static_assert(std::is_arithmetic_v<T>, "Params must be arithmetic");
+
+public:
+    /**
+     * @brief Construct an unbound Param object, reading as zero.
+     */
+    Param() = default;
+
+    /**
+     * @brief Construct a Param object bound to a slot.
+     *
+     * @param slot The parameter slot.
+     */
+    explicit Param(std::atomic<double>* slot) : slot(slot) {}
+
+    /**
+     * @brief Read the parameter.
+     *
+     * @return T The value.
+     */
+    T get(void) const {
+        if (slot == nullptr) return T{};
+
+        const double value = slot->load(std::memory_order_relaxed);
+        if constexpr (std::is_same_v<T, bool>) {
+            return value != 0.0;
+        } else {
+            return static_cast<T>(value);
+        }
+    }
+
+    /// @copydoc Dae::Param::get
+    operator T() const { return get(); }
+
+    /**
+     * @brief Write the parameter, visible to every handle sharing the slot.
+     *
+     * @param value The value.
+     */
+    void set(T value) {
+        if (slot == nullptr) return;
+        slot->store(static_cast<double>(value), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Check whether the handle is bound to a slot.
+     *
+     * @return bool True if the handle is bound.
+     */
+    bool bound(void) const { return slot != nullptr; }
+
+private:
+    /// @brief The parameter slot.
+    std::atomic<double>* slot = nullptr;
+};
+
+} // namespace Dae
@@ -0,0 +1,422 @@
+/**
+ * @file Pipeline.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the Pipeline class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "common/Logging.h"
+#include "common/MessageBus.h"
+#include "common/SpscQueue.h"
+#include "common/Utils.h"
+
+namespace Dae {
+
+/**
+ * @brief Multi-threaded frame pipeline, such as I/O, estimation, control,
+ * then output and logging.
+ *
+ * Each stage runs on its own thread, optionally pinned to a CPU, and hands
+ * frames to the next stage through a wait-free `SpscQueue`. The first stage
+ * is the source: it is called with an empty frame and fills it in. Every
+ * frame is given an ID and stamped when the source produces it, and its end
+ * to end latency is recorded when the last stage finishes it.
+ *
+ * A stage that takes longer than its budget counts an overrun. Stages that
+ * only need the newest frame (`PL_LATEST`) are fed through a `Topic`
+ * instead of a queue, so frames that arrive while they are busy replace
+ * each other and an overrun never leaves them behind. Frames that find a
+ * `PL_EVERY` stage's queue full are dropped and counted, so a slow stage
+ * never stalls the stages before it.
+ *
+ * @tparam Frame Frame type, must be trivially copyable.
+ * @tparam Depth Capacity of each queue between stages, a power of two.
+ */
+template <typename Frame, size_t Depth = 16> class Pipeline {
+    static_assert(std::is_trivially_copyable_v<Frame>,
+                  "Pipeline frames must be trivially copyable");
+
+public:
+    /**
+     * @brief Status codes for the Pipeline class.
+     */
+    enum Status { ST_GOOD = 0, ST_NO_STAGES, ST_RUNNING };
+
+    /**
+     * @brief Which frames a stage processes.
+     */
+    enum Policy {
+        /// @brief Every frame, in order.
+        PL_EVERY = 0,
+        /// @brief Only the newest frame, older ones are skipped.
+        PL_LATEST
+    };
+
+    /**
+     * @brief Work done by a stage on a frame.
+     *
+     * Returns false to drop the frame, or for the source, if it produced
+     * nothing.
+     */
+    using Work = std::function<bool(Frame&)>;
+
+    /// @brief Number of recent frames whose latency can be looked up.
+    static constexpr size_t LATENCY_HISTORY = 1024;
+
+    /**
+     * @brief Counters of a stage.
+     */
+    struct Stats {
+        /// @brief Frames processed.
+        uint64_t frames;
+        /// @brief Frames dropped because this stage's queue was full.
+        uint64_t dropped;
+        /// @brief Stale frames skipped by a `PL_LATEST` stage.
+        uint64_t skipped;
+        /// @brief Frames that took longer than the budget.
+        uint64_t overruns;
+        /// @brief Longest time spent on one frame (s).
+        double maxTime;
+    };
+
+    Pipeline() = default;
+
+    /**
+     * @brief Destroy the Pipeline object, stopping it.
+     */
+    ~Pipeline() { stop(); }
+
+    Pipeline(const Pipeline& other)            = delete;
+    Pipeline& operator=(const Pipeline& other) = delete;
+
+    /**
+     * @brief Add a stage after the existing ones. The first stage added is
+     * the source.
+     *
+     * @param name Stage name, used in warnings.
+     * @param work The work done on each frame.
+     * @param policy Which frames the stage processes.
+     * @param budget Time allowed per frame (s), 0 for no limit.
+     * @param cpu CPU to pin the stage to, -1 to leave it unpinned.
+     * @return int Status code. 0 for success.
+     */
+    int addStage(const std::string& name, Work work, Policy policy = PL_EVERY,
+                 double budget = 0, int cpu = -1) {
+        if (running.load(std::memory_order_relaxed)) return ST_RUNNING;
+
+        auto stage    = std::make_unique<Stage>();
+        stage->name   = name;
+        stage->work   = std::move(work);
+        stage->policy = policy;
+        stage->budget = static_cast<uint64_t>(budget * 1e9);
+        stage->cpu    = cpu;
+        stages.push_back(std::move(stage));
+        return ST_GOOD;
+    }
+
+    /**
+     * @brief Start a thread for every stage.
+     *
+     * @return int Status code. 0 for success.
+     */
+    int start(void) {
+        if (stages.empty()) return ST_NO_STAGES;
+        if (running.exchange(true, std::memory_order_relaxed)) {
+            return ST_RUNNING;
+        }
+
+        for (size_t i = 0; i < stages.size(); i++) {
+            stages[i]->thread = std::thread(&Pipeline::run, this, i);
+        }
+        return ST_GOOD;
+    }
+
+    /**
+     * @brief Stop and join every stage. Frames still queued are discarded.
+     */
+    void stop(void) {
+        running.store(false, std::memory_order_relaxed);
+        for (auto& stage : stages) {
+            if (stage->thread.joinable()) stage->thread.join();
+        }
+
+        Packet packet;
+        for (auto& stage : stages) {
+            while (stage->input.pop(packet)) {}
+        }
+    }
+
+    /**
+     * @brief Get the number of stages.
+     *
+     * @return size_t The number of stages.
+     */
+    size_t size(void) const { return stages.size(); }
+
+    /**
+     * @brief Get the counters of a stage.
+     *
+     * @param stage Stage index.
+     * @return Stats The counters.
+     */
+    Stats stats(size_t stage) const {
+        const Stage&   s       = *stages[stage];
+        const uint64_t maxTime = s.maxTime.load(std::memory_order_relaxed);
+        return {s.frames.load(std::memory_order_relaxed),
+                s.dropped.load(std::memory_order_relaxed),
+                s.skipped.load(std::memory_order_relaxed),
+                s.overruns.load(std::memory_order_relaxed),
+                static_cast<double>(maxTime) * 1e-9};
+    }
+
+    /**
+     * @brief Get the number of frames that made it through every stage.
+     *
+     * @return uint64_t The number of frames.
+     */
+    uint64_t completed(void) const {
+        return completedCount.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the end to end latency of a recent frame.
+     *
+     * @param id Frame ID, counting up from 0 in the order the source
+     * produced them.
+     * @param seconds Set to the latency (s) on success.
+     * @return bool False if the frame did not complete, or is too old.
+     */
+    bool latency(uint64_t id, double& seconds) const {
+        const Record& record = records[id % LATENCY_HISTORY];
+        if (record.id.load(std::memory_order_acquire) != id + 1) return false;
+
+        const uint64_t time = record.time.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (record.id.load(std::memory_order_relaxed) != id + 1) return false;
+
+        seconds = static_cast<double>(time) * 1e-9;
+        return true;
+    }
+
+    /**
+     * @brief Get the worst end to end latency so far.
+     *
+     * @return double The latency (s).
+     */
+    double maxLatency(void) const {
+        return static_cast<double>(
+                   worstLatency.load(std::memory_order_relaxed)) *
+               1e-9;
+    }
+
+private:
+    /**
+     * @brief A frame in flight.
+     */
+    struct Packet {
+        /// @brief Frame ID.
+        uint64_t id;
+        /// @brief Time the source produced the frame (ns).
+        uint64_t start;
+        /// @brief The frame.
+        Frame frame;
+    };
+
+    /**
+     * @brief A stage, its input queue and its counters.
+     */
+    struct Stage {
+        /// @brief Stage name.
+        std::string name;
+        /// @brief The work done on each frame.
+        Work work;
+        /// @brief Which frames the stage processes.
+        Policy policy = PL_EVERY;
+        /// @brief Time allowed per frame (ns), 0 for no limit.
+        uint64_t budget = 0;
+        /// @brief CPU to pin to, or -1.
+        int cpu = -1;
+        /// @brief The stage thread.
+        std::thread thread;
+        /// @brief Frames from the previous stage, for `PL_EVERY`.
+        SpscQueue<Packet, Depth> input;
+        /// @brief Newest frame from the previous stage, for `PL_LATEST`.
+        Topic<Packet> newest;
+        /// @brief Generation of the last frame taken from `newest`.
+        uint64_t seen = 0;
+
+        /// @brief Counters, see `Stats`.
+        std::atomic<uint64_t> frames{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint64_t> skipped{0};
+        std::atomic<uint64_t> overruns{0};
+        std::atomic<uint64_t> maxTime{0};
+    };
+
+    /**
+     * @brief Latency of a completed frame.
+     */
+    struct Record {
+        /// @brief Frame ID plus one, 0 if empty.
+        std::atomic<uint64_t> id{0};
+        /// @brief End to end latency (ns).
+        std::atomic<uint64_t> time{0};
+    };
+
+    /// @brief The stages, in order.
+    std::vector<std::unique_ptr<Stage>> stages;
+
+    /// @brief Set while the stages should run.
+    std::atomic<bool> running{false};
+
+    /// @brief Number of completed frames.
+    std::atomic<uint64_t> completedCount{0};
+
+    /// @brief Worst end to end latency (ns).
+    std::atomic<uint64_t> worstLatency{0};
+
+    /// @brief Latencies of recent frames, by ID.
+    Record records[LATENCY_HISTORY];
+
+    /**
+     * @brief Get the monotonic time (ns).
+     */
+    static uint64_t now(void) {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+
+    /**
+     * @brief Stage thread.
+     *
+     * @param index Stage index.
+     */
+    void run(size_t index) {
+        Stage&     stage  = *stages[index];
+        Stage*     next   = nullptr;
+        const bool source = index == 0;
+        unsigned   idle   = 0;
+        if (index + 1 < stages.size()) next = stages[index + 1].get();
+
+        if (stage.cpu >= 0 && !Utils::pinThread(stage.cpu)) {
+            warn("Failed to pin pipeline stage '%s' to CPU %d",
+                 stage.name.c_str(), stage.cpu);
+        }
+
+        uint64_t nextId = 0;
+        Packet   packet;
+        while (running.load(std::memory_order_relaxed)) {
+            if (source) {
+                packet.frame = Frame{};
+            } else if (!take(stage, packet)) {
+                // Back off gently, frames arrive at hundreds of Hz at most
+                if (++idle < 64) {
+                    std::this_thread::yield();
+                } else {
+                    std::this_thread::sleep_for(std::chrono::microseconds(20));
+                }
+                continue;
+            }
+            idle = 0;
+
+            const uint64_t begin = now();
+            const bool     keep  = stage.work(packet.frame);
+            const uint64_t end   = now();
+            if (source) {
+                if (!keep) continue;
+                packet.id    = nextId++;
+                packet.start = end;
+            }
+
+            account(stage, end - begin);
+            if (!keep) continue;
+
+            if (next == nullptr) {
+                complete(packet, end);
+            } else if (next->policy == PL_LATEST) {
+                next->newest.publish(packet);
+            } else if (!next->input.push(packet)) {
+                next->dropped.fetch_add(1, std::memory_order_relaxed);
+                warn_every(1000, "Pipeline stage '%s' is full, dropping frames",
+                           next->name.c_str());
+            }
+        }
+    }
+
+    /**
+     * @brief Take the next frame for a stage, or the newest one if its
+     * policy allows skipping.
+     *
+     * @return bool False if there is no new frame.
+     */
+    bool take(Stage& stage, Packet& packet) {
+        if (stage.policy != PL_LATEST) return stage.input.pop(packet);
+
+        if (stage.newest.latest() == stage.seen) return false;
+        const uint64_t gen = stage.newest.read(packet);
+        if (gen > stage.seen + 1) {
+            stage.skipped.fetch_add(gen - stage.seen - 1,
+                                    std::memory_order_relaxed);
+        }
+        stage.seen = gen;
+        return true;
+    }
+
+    /**
+     * @brief Count a processed frame.
+     *
+     * @param time Time spent on it (ns).
+     */
+    void account(Stage& stage, uint64_t time) {
+        stage.frames.fetch_add(1, std::memory_order_relaxed);
+        if (time > stage.maxTime.load(std::memory_order_relaxed)) {
+            stage.maxTime.store(time, std::memory_order_relaxed);
+        }
+
+        if (stage.budget != 0 && time > stage.budget) {
+            stage.overruns.fetch_add(1, std::memory_order_relaxed);
+            warn_every(1000, "Pipeline stage '%s' overran its budget, %.3f ms",
+                       stage.name.c_str(), static_cast<double>(time) * 1e-6);
+        }
+    }
+
+    /**
+     * @brief Record a frame that made it through every stage.
+     *
+     * @param end Time the last stage finished it (ns).
+     */
+    void complete(const Packet& packet, uint64_t end) {
+        const uint64_t time   = end - packet.start;
+        Record&        record = records[packet.id % LATENCY_HISTORY];
+
+        record.id.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        record.time.store(time, std::memory_order_relaxed);
+        record.id.store(packet.id + 1, std::memory_order_release);
+
+        completedCount.fetch_add(1, std::memory_order_relaxed);
+        if (time > worstLatency.load(std::memory_order_relaxed)) {
+            worstLatency.store(time, std::memory_order_relaxed);
+        }
+    }
+};
+
+} // namespace Dae
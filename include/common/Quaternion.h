@@ -0,0 +1,292 @@
+/**
+ * @file Quaternion.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the Quaternion class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+#include "common/Matrix.h"
+
+namespace Dae {
+
+/**
+ * @brief Attitude quaternion, [w, x, y, z] with w the scalar part, in the
+ * same order as `Telemetry::quaternion`.
+ *
+ * Rotations follow the Hamilton convention: `a * b` applies `b` then `a`,
+ * and a quaternion rotates vectors from the body frame to the Earth frame.
+ * Like `Matrix`, a quaternion is a plain aggregate that `view` can map onto
+ * an existing array, and the product uses SSE2 when it is available.
+ */
+struct Quaternion {
+    /// @brief The elements, [w, x, y, z].
+    double data[4];
+
+    /**
+     * @brief Get the identity rotation.
+     */
+    static constexpr Quaternion identity(void) { return {{1, 0, 0, 0}}; }
+
+    /**
+     * @brief Get the rotation about an axis.
+     *
+     * @param axis The axis, need not be normalised.
+     * @param angle The angle (rad).
+     */
+    static Quaternion fromAxisAngle(const Vector3& axis, double angle) {
+        const Vector3 unit = axis.normalized();
+        const double  s    = std::sin(angle / 2);
+        return {{std::cos(angle / 2), unit[0] * s, unit[1] * s, unit[2] * s}};
+    }
+
+    /**
+     * @brief Get the rotation of a rotation vector, whose direction is the
+     * axis and whose length is the angle (rad).
+     *
+     * @param rotation The rotation vector.
+     */
+    static Quaternion fromRotationVector(const Vector3& rotation) {
+        const double angle = rotation.norm();
+        if (angle < 1e-9) {
+            // Small angle, avoids dividing by the angle
+            return Quaternion{{1, rotation[0] / 2, rotation[1] / 2,
+                               rotation[2] / 2}}
+                .normalized();
+        }
+        return fromAxisAngle(rotation, angle);
+    }
+
+    /**
+     * @brief Get the rotation of Z-Y-X Euler angles.
+     *
+     * @param roll Roll (rad).
+     * @param pitch Pitch (rad).
+     * @param yaw Yaw (rad).
+     */
+    static Quaternion fromEuler(double roll, double pitch, double yaw) {
+        const double cr = std::cos(roll / 2), sr = std::sin(roll / 2);
+        const double cp = std::cos(pitch / 2), sp = std::sin(pitch / 2);
+        const double cy = std::cos(yaw / 2), sy = std::sin(yaw / 2);
+        return {{cr * cp * cy + sr * sp * sy, sr * cp * cy - cr * sp * sy,
+                 cr * sp * cy + sr * cp * sy, cr * cp * sy - sr * sp * cy}};
+    }
+
+    /**
+     * @brief View an array as a quaternion, without copying it.
+     *
+     * @param array The array, [w, x, y, z].
+     * @return Quaternion& The array as a quaternion.
+     */
+    static Quaternion& view(double (&array)[4]) {
+        return *reinterpret_cast<Quaternion*>(array);
+    }
+
+    /// @copydoc Dae::Quaternion::view
+    static const Quaternion& view(const double (&array)[4]) {
+        return *reinterpret_cast<const Quaternion*>(array);
+    }
+
+    /// @brief Get an element.
+    constexpr double& operator[](size_t i) { return data[i]; }
+
+    /// @brief Get an element.
+    constexpr const double& operator[](size_t i) const { return data[i]; }
+
+    /// @brief Get the scalar part.
+    constexpr double w(void) const { return data[0]; }
+
+    /// @brief Get the vector part.
+    constexpr Vector3 vec(void) const { return {{data[1], data[2], data[3]}}; }
+
+    /// @brief Get the conjugate, the inverse of a unit quaternion.
+    constexpr Quaternion conjugate(void) const {
+        return {{data[0], -data[1], -data[2], -data[3]}};
+    }
+
+    /// @brief Get the dot product of the elements.
+    constexpr double dot(const Quaternion& other) const {
+        return data[0] * other.data[0] + data[1] * other.data[1] +
+               data[2] * other.data[2] + data[3] * other.data[3];
+    }
+
+    /// @brief Get the angle of the rotation between two unit quaternions
+    /// (rad).
+    double angleTo(const Quaternion& other) const {
+        return 2 * std::acos(std::min(1.0, std::abs(dot(other))));
+    }
+
+    /// @brief Get the norm.
+    constexpr double norm(void) const { return Math::sqrt(dot(*this)); }
+
+    /// @brief Get this scaled to a unit norm. Zero stays zero.
+    constexpr Quaternion normalized(void) const {
+        const double length = norm();
+        if (length <= 0) return *this;
+        const double s = 1 / length;
+        return {{data[0] * s, data[1] * s, data[2] * s, data[3] * s}};
+    }
+
+    /// @brief Get the inverse.
+    constexpr Quaternion inverse(void) const {
+        const double      n = dot(*this);
+        const Quaternion c = conjugate();
+        return {{c.data[0] / n, c.data[1] / n, c.data[2] / n, c.data[3] / n}};
+    }
+
+    /**
+     * @brief Rotate a vector from the body frame to the Earth frame, for a
+     * unit quaternion.
+     *
+     * @param v The vector.
+     * @return Vector3 The rotated vector.
+     */
+    constexpr Vector3 rotate(const Vector3& v) const {
+        // v + 2w (u x v) + 2 u x (u x v), cheaper than two products
+        const Vector3 u = vec();
+        const Vector3 t = u.cross(v) * 2.0;
+        return v + t * data[0] + u.cross(t);
+    }
+
+    /**
+     * @brief Rotate a vector from the Earth frame to the body frame, for a
+     * unit quaternion.
+     *
+     * @param v The vector.
+     * @return Vector3 The rotated vector.
+     */
+    constexpr Vector3 unrotate(const Vector3& v) const {
+        return conjugate().rotate(v);
+    }
+
+    /**
+     * @brief Get the rotation matrix, body to Earth, of a unit quaternion.
+     */
+    constexpr Matrix3 toMatrix(void) const {
+        const double w = data[0], x = data[1], y = data[2], z = data[3];
+        return {{1 - 2 * (y * y + z * z), 2 * (x * y - w * z),
+                 2 * (x * z + w * y), 2 * (x * y + w * z),
+                 1 - 2 * (x * x + z * z), 2 * (y * z - w * x),
+                 2 * (x * z - w * y), 2 * (y * z + w * x),
+                 1 - 2 * (x * x + y * y)}};
+    }
+
+    /**
+     * @brief Get the Z-Y-X Euler angles of a unit quaternion.
+     *
+     * @return Vector3 [roll, pitch, yaw] (rad).
+     */
+    Vector3 toEuler(void) const {
+        const double w = data[0], x = data[1], y = data[2], z = data[3];
+        const double sinp = 2 * (w * y - z * x);
+        return {{std::atan2(2 * (w * x + y * z), 1 - 2 * (x * x + y * y)),
+                 std::abs(sinp) >= 1 ? std::copysign(M_PI / 2, sinp)
+                                     : std::asin(sinp),
+                 std::atan2(2 * (w * z + x * y), 1 - 2 * (y * y + z * z))}};
+    }
+
+    /**
+     * @brief Spherical linear interpolation between unit quaternions, the
+     * short way round.
+     *
+     * @param a The start, at `t = 0`.
+     * @param b The end, at `t = 1`.
+     * @param t The fraction of the way from `a` to `b`.
+     * @return Quaternion The interpolated unit quaternion.
+     */
+    static Quaternion slerp(const Quaternion& a, const Quaternion& b,
+                            double t) {
+        double       dot  = a.dot(b);
+        const double sign = dot < 0 ? -1.0 : 1.0;
+        dot *= sign;
+
+        // Nearly parallel quaternions are lerped, as sin(theta) vanishes
+        double wa = 1 - t;
+        double wb = t * sign;
+        if (dot < 0.9995) {
+            const double theta = std::acos(dot);
+            const double sine  = std::sin(theta);
+            wa                 = std::sin((1 - t) * theta) / sine;
+            wb                 = std::sin(t * theta) / sine * sign;
+        }
+
+        return Quaternion{{wa * a.data[0] + wb * b.data[0],
+                           wa * a.data[1] + wb * b.data[1],
+                           wa * a.data[2] + wb * b.data[2],
+                           wa * a.data[3] + wb * b.data[3]}}
+            .normalized();
+    }
+
+    /// @brief Element wise equality.
+    friend constexpr bool operator==(const Quaternion& a,
+                                     const Quaternion& b) {
+        return a.data[0] == b.data[0] && a.data[1] == b.data[1] &&
+               a.data[2] == b.data[2] && a.data[3] == b.data[3];
+    }
+
+    /**
+     * @brief Hamilton product, the rotation `b` followed by `a`.
+     */
+    friend constexpr Quaternion operator*(const Quaternion& a,
+                                          const Quaternion& b) {
+#ifdef DAE_MATH_SSE2
+        if (!std::is_constant_evaluated()) return simdMultiply(a, b);
+#endif
+        const double w1 = a.data[0], x1 = a.data[1], y1 = a.data[2],
+                     z1 = a.data[3];
+        const double w2 = b.data[0], x2 = b.data[1], y2 = b.data[2],
+                     z2 = b.data[3];
+        return {{w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2,
+                 w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2,
+                 w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2,
+                 w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2}};
+    }
+
+#ifdef DAE_MATH_SSE2
+    /**
+     * @brief Hamilton product on two lanes, as the sum of the elements of
+     * `a` times signed permutations of `b`.
+     */
+    static Quaternion simdMultiply(const Quaternion& a, const Quaternion& b) {
+        const __m128d wx = _mm_loadu_pd(&b.data[0]);
+        const __m128d yz = _mm_loadu_pd(&b.data[2]);
+        const __m128d xw = _mm_shuffle_pd(wx, wx, 1);
+        const __m128d zy = _mm_shuffle_pd(yz, yz, 1);
+
+        const __m128d negLo  = _mm_set_pd(1.0, -1.0);
+        const __m128d negHi  = _mm_set_pd(-1.0, 1.0);
+        const __m128d negAll = _mm_set1_pd(-1.0);
+
+        const __m128d w1 = _mm_set1_pd(a.data[0]);
+        const __m128d x1 = _mm_set1_pd(a.data[1]);
+        const __m128d y1 = _mm_set1_pd(a.data[2]);
+        const __m128d z1 = _mm_set1_pd(a.data[3]);
+
+        // [w, x] = w1 [w2, x2] + x1 [-x2, w2] + y1 [-y2, z2] + z1 [-z2, -y2]
+        __m128d lo = _mm_mul_pd(w1, wx);
+        lo         = _mm_add_pd(lo, _mm_mul_pd(x1, _mm_mul_pd(xw, negLo)));
+        lo         = _mm_add_pd(lo, _mm_mul_pd(y1, _mm_mul_pd(yz, negLo)));
+        lo         = _mm_add_pd(lo, _mm_mul_pd(z1, _mm_mul_pd(zy, negAll)));
+
+        // [y, z] = w1 [y2, z2] + x1 [-z2, y2] + y1 [w2, -x2] + z1 [x2, w2]
+        __m128d hi = _mm_mul_pd(w1, yz);
+        hi         = _mm_add_pd(hi, _mm_mul_pd(x1, _mm_mul_pd(zy, negLo)));
+        hi         = _mm_add_pd(hi, _mm_mul_pd(y1, _mm_mul_pd(wx, negHi)));
+        hi         = _mm_add_pd(hi, _mm_mul_pd(z1, xw));
+
+        Quaternion out;
+        _mm_storeu_pd(&out.data[0], lo);
+        _mm_storeu_pd(&out.data[2], hi);
+        return out;
+    }
+#endif
+};
+
+} // namespace Dae
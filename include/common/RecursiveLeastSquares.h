@@ -0,0 +1,147 @@
+/**
+ * @file RecursiveLeastSquares.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the RecursiveLeastSquares class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "common/Matrix.h"
+
+namespace Dae {
+
+/**
+ * @brief Recursive least squares estimator of a linear model
+ * `y = phi' theta`, with exponential forgetting.
+ *
+ * The covariance is held factored as `P = U D U'`, with `U` unit upper
+ * triangular and `D` diagonal, and updated by Bierman's algorithm. The
+ * factors keep the covariance symmetric and positive definite however many
+ * updates are made, where the plain covariance update loses both to
+ * rounding once forgetting has inflated it. An update is O(N^2), does not
+ * take a square root and never allocates.
+ *
+ * Forgetting by `lambda` weighs a measurement `k` updates old by
+ * `lambda^k`, so the estimate tracks parameters that drift, over about
+ * `1 / (1 - lambda)` updates. Directions the regressors do not excite grow
+ * in variance by `1 / lambda` each update, so the diagonal is capped to keep
+ * the estimator from blowing up while it is not excited.
+ *
+ * @tparam N Number of parameters.
+ */
+template <size_t N> class RecursiveLeastSquares {
+public:
+    /// @brief Parameter vector.
+    using Parameters = Vector<N>;
+
+    /// @brief Regressor vector.
+    using Regressor = Vector<N>;
+
+    /// @brief Covariance of the parameters.
+    using Covariance = Matrix<N, N>;
+
+    /**
+     * @brief Construct a new RecursiveLeastSquares object, at zero with unit
+     * variance.
+     */
+    RecursiveLeastSquares(void) { reset(Parameters::zero(), 1.0); }
+
+    /**
+     * @brief Reset the estimate, with independent parameters.
+     *
+     * @param initial Initial parameters.
+     * @param variance Initial variance of every parameter.
+     */
+    void reset(const Parameters& initial, double variance) {
+        theta = initial;
+        u     = Covariance::identity();
+        d     = Parameters::filled(variance);
+    }
+
+    /**
+     * @brief Fuse a measurement.
+     *
+     * @param phi The regressor.
+     * @param y The measurement.
+     * @param lambda Forgetting factor, from 0 to 1, where 1 forgets nothing.
+     * @param maxVariance Cap on the diagonal of the factored covariance.
+     * @return double The residual of the measurement before the update.
+     */
+    double update(const Regressor& phi, double y, double lambda,
+                  double maxVariance) {
+        // f = U' phi, v = D f
+        Parameters f;
+        Parameters v;
+        for (size_t j = 0; j < N; j++) {
+            f[j] = phi[j];
+            for (size_t i = 0; i < j; i++) {
+                f[j] += u(i, j) * phi[i];
+            }
+            v[j] = d[j] * f[j];
+        }
+
+        // Bierman's update, with the measurement variance lambda, which
+        // leaves the gain unscaled, `P phi / (lambda + phi' P phi)`
+        Parameters gain  = Parameters::zero();
+        double     alpha = lambda;
+        for (size_t j = 0; j < N; j++) {
+            const double beta = alpha;
+            alpha            += f[j] * v[j];
+
+            const double p = -f[j] / beta;
+            d[j]           = std::min(d[j] * beta / (alpha * lambda),
+                                      maxVariance);
+
+            gain[j] = v[j];
+            for (size_t i = 0; i < j; i++) {
+                const double previous = u(i, j);
+                u(i, j)               = previous + gain[i] * p;
+                gain[i]              += previous * v[j];
+            }
+        }
+
+        const double residual = y - phi.dot(theta);
+        theta.mulAdd(gain, residual / alpha);
+        return residual;
+    }
+
+    /**
+     * @brief Get the estimated parameters.
+     *
+     * @return const Parameters& The parameters.
+     */
+    const Parameters& parameters(void) const { return theta; }
+
+    /**
+     * @brief Get the covariance of the parameters, `U D U'`.
+     *
+     * @return Covariance The covariance.
+     */
+    Covariance covariance(void) const {
+        Covariance scaled = u;
+        for (size_t i = 0; i < N; i++) {
+            for (size_t j = 0; j < N; j++) {
+                scaled(i, j) *= d[j];
+            }
+        }
+        return scaled * u.transpose();
+    }
+
+private:
+    /// @brief Estimated parameters.
+    Parameters theta;
+
+    /// @brief Unit upper triangular factor of the covariance.
+    Covariance u;
+
+    /// @brief Diagonal factor of the covariance.
+    Parameters d;
+};
+
+} // namespace Dae
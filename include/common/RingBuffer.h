@@ -0,0 +1,109 @@
+/**
+ * @file RingBuffer.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the RingBuffer class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <cstddef>
+
+namespace Dae {
+
+/**
+ * @brief Fixed capacity ring of the most recent elements, for one thread.
+ *
+ * Pushing onto a full ring overwrites the oldest element. Elements are
+ * indexed oldest first, and the storage is held inline, so the ring never
+ * allocates.
+ *
+ * @tparam T Element type.
+ * @tparam Capacity Number of elements, must be a power of two.
+ */
+template <typename T, size_t Capacity> class RingBuffer {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "RingBuffer capacity must be a power of two");
+
+public:
+    /**
+     * @brief Push an element, overwriting the oldest if the ring is full.
+     *
+     * @param value The element.
+     * @return bool False if an element was overwritten.
+     */
+    bool push(const T& value) {
+        slots[(first + count) & (Capacity - 1)] = value;
+
+        if (count == Capacity) {
+            first = (first + 1) & (Capacity - 1);
+            return false;
+        }
+        count++;
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest element.
+     *
+     * @param value Set to the element on success.
+     * @return bool False if the ring is empty.
+     */
+    bool pop(T& value) {
+        if (count == 0) return false;
+
+        value = slots[first];
+        first = (first + 1) & (Capacity - 1);
+        count--;
+        return true;
+    }
+
+    /// @brief Get an element, 0 being the oldest.
+    T& operator[](size_t i) { return slots[(first + i) & (Capacity - 1)]; }
+
+    /// @brief Get an element, 0 being the oldest.
+    const T& operator[](size_t i) const {
+        return slots[(first + i) & (Capacity - 1)];
+    }
+
+    /// @brief Get the oldest element. The ring must not be empty.
+    T& front(void) { return slots[first]; }
+
+    /// @brief Get the oldest element. The ring must not be empty.
+    const T& front(void) const { return slots[first]; }
+
+    /// @brief Get the newest element. The ring must not be empty.
+    T& back(void) { return (*this)[count - 1]; }
+
+    /// @brief Get the newest element. The ring must not be empty.
+    const T& back(void) const { return (*this)[count - 1]; }
+
+    /// @brief Get the number of elements.
+    size_t size(void) const { return count; }
+
+    /// @brief Check whether the ring is empty.
+    bool empty(void) const { return count == 0; }
+
+    /// @brief Check whether the ring is full.
+    bool full(void) const { return count == Capacity; }
+
+    /// @brief Remove every element.
+    void clear(void) {
+        first = 0;
+        count = 0;
+    }
+
+private:
+    /// @brief Element storage.
+    T slots[Capacity]{};
+
+    /// @brief Index of the oldest element.
+    size_t first = 0;
+
+    /// @brief Number of elements.
+    size_t count = 0;
+};
+
+} // namespace Dae
@@ -0,0 +1,120 @@
+/**
+ * @file SpscQueue.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the SpscQueue class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace Dae {
+
+/**
+ * @brief Bounded, wait-free, single producer single consumer queue.
+ *
+ * One thread may call `push`, and one other thread may call `pop`. Both are
+ * wait-free and never allocate. The producer and consumer indices live on
+ * separate cache lines, and each side caches the other's index so the shared
+ * line is only touched when the queue looks full or empty.
+ *
+ * @tparam T Element type, must be trivially copyable.
+ * @tparam Capacity Number of elements, must be a power of two.
+ */
+template <typename T, size_t Capacity> class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscQueue capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "SpscQueue elements must be trivially copyable");
+
+public:
+    /**
+     * @brief Push an element, called by the producer only.
+     *
+     * @param value The element.
+     * @return bool False if the queue is full.
+     */
+    bool push(const T& value) {
+        const size_t head = producer.index.load(std::memory_order_relaxed);
+
+        if (head - producer.cached == Capacity) {
+            producer.cached = consumer.index.load(std::memory_order_acquire);
+            if (head - producer.cached == Capacity) return false;
+        }
+
+        slots[head & (Capacity - 1)] = value;
+        producer.index.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pop an element, called by the consumer only.
+     *
+     * @param value Set to the element on success.
+     * @return bool False if the queue is empty.
+     */
+    bool pop(T& value) {
+        const size_t tail = consumer.index.load(std::memory_order_relaxed);
+
+        if (tail == consumer.cached) {
+            consumer.cached = producer.index.load(std::memory_order_acquire);
+            if (tail == consumer.cached) return false;
+        }
+
+        value = slots[tail & (Capacity - 1)];
+        consumer.index.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Get the number of queued elements. Only exact when neither side
+     * is running.
+     *
+     * @return size_t The number of queued elements.
+     */
+    size_t size(void) const {
+        return producer.index.load(std::memory_order_acquire) -
+               consumer.index.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Check whether the queue is empty.
+     *
+     * @return bool True if there are no queued elements.
+     */
+    bool empty(void) const { return size() == 0; }
+
+    /**
+     * @brief Get the capacity of the queue.
+     *
+     * @return size_t The capacity.
+     */
+    static constexpr size_t capacity(void) { return Capacity; }
+
+private:
+    /**
+     * @brief One side of the queue, on its own cache line.
+     */
+    struct alignas(64) Side {
+        /// @brief Index owned by this side.
+        std::atomic<size_t> index{0};
+        /// @brief Last seen index of the other side.
+        size_t cached = 0;
+    };
+
+    /// @brief Producer state.
+    Side producer;
+
+    /// @brief Consumer state.
+    Side consumer;
+
+    /// @brief Element storage.
+    alignas(64) T slots[Capacity];
+};
+
+} // namespace Dae
@@ -29,6 +29,14 @@ public:
      * @return uint64_t Microseconds since epoch.
      */
     static uint64_t micros();
+
+    /**
+     * @brief Pin the calling thread to a CPU. Only supported on Linux.
+     *
+     * @param cpu The CPU index.
+     * @return bool True if the thread was pinned.
+     */
+    static bool pinThread(int cpu);
 };
 
 } // namespace Dae
\ No newline at end of file
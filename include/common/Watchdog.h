@@ -0,0 +1,211 @@
+/**
+ * @file Watchdog.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the Watchdog class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+
+#include "common/Configurable.h"
+
+namespace Dae {
+
+/**
+ * @brief Telemetry loss watchdog.
+ *
+ * The loop thread calls `feed` whenever it receives good telemetry. A
+ * separate thread, woken by a `timerfd` on Linux, checks the age of the last
+ * feed every period and escalates through the levels as it passes each
+ * configured timeout, running the action of every level it reaches. Because
+ * it runs on its own thread, it fires while the loop thread is still blocked
+ * waiting on telemetry.
+ *
+ * The late and failsafe timeouts are counted in telemetry frames, so by
+ * default a stall is late after one missed frame, and engages the failsafe
+ * after two. Changing the period re-arms the timer of a running watchdog.
+ *
+ * Feeding again returns the watchdog to `LV_OK`, and runs its action.
+ * Actions run on the watchdog thread, so must be quick and thread safe, and
+ * must be set before `start`.
+ */
+class Watchdog : public Configurable {
+public:
+    /**
+     * @brief Status codes for the Watchdog class.
+     */
+    enum Status { ST_GOOD = 0, ST_TIMER_FAIL, ST_RUNNING };
+
+    /**
+     * @brief Escalation levels, in order.
+     */
+    enum Level {
+        /// @brief Telemetry is arriving.
+        LV_OK = 0,
+        /// @brief Telemetry is late, a frame or so was missed.
+        LV_LATE,
+        /// @brief Telemetry has stopped, the failsafe should engage.
+        LV_FAILSAFE,
+        /// @brief Telemetry is lost for good.
+        LV_LOST,
+        /// @brief Number of levels.
+        LV_COUNT
+    };
+
+    /**
+     * @brief Construct a new Watchdog object.
+     *
+     * @param key Configuration key.
+     */
+    explicit Watchdog(const std::string& key = "Watchdog");
+
+    /**
+     * @brief Destroy the Watchdog object, stopping it.
+     */
+    ~Watchdog();
+
+    Watchdog(const Watchdog& other)            = delete;
+    Watchdog& operator=(const Watchdog& other) = delete;
+
+    /**
+     * @brief Set the action run when the watchdog reaches a level.
+     *
+     * @param level The level.
+     * @param action The action.
+     */
+    void setAction(Level level, std::function<void(void)> action);
+
+    /**
+     * @brief Start the watchdog thread. The age counts from now until the
+     * first feed.
+     *
+     * @return int Status code. 0 for success.
+     */
+    int start(void);
+
+    /**
+     * @brief Stop the watchdog thread.
+     */
+    void stop(void);
+
+    /**
+     * @brief Record good telemetry. Wait-free, called by the loop thread.
+     */
+    void feed(void) { lastFeed.store(now(), std::memory_order_release); }
+
+    /**
+     * @brief Get the time since the last feed.
+     *
+     * @return double The age (s).
+     */
+    double age(void) const;
+
+    /**
+     * @brief Get the current level.
+     *
+     * @return Level The level.
+     */
+    Level level(void) const {
+        return static_cast<Level>(current.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Get the number of times the watchdog left `LV_OK`.
+     *
+     * @return uint64_t The number of trips.
+     */
+    uint64_t trips(void) const {
+        return tripCount.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the name of a level.
+     *
+     * @param level The level.
+     * @return const char* The name.
+     */
+    static const char* levelName(Level level);
+
+    /// @copydoc Dae::Configurable::configure
+    void configure(void) override;
+
+private:
+    // Configs
+
+    /// @brief Period between checks (s). Config 'period'.
+    DAE_PARAM(double, PERIOD, "Watchdog", "period", 0.0005);
+
+    /// @brief Expected time between telemetry frames (s). Config
+    /// 'frame_period'.
+    DAE_PARAM(double, FRAME_PERIOD, "Watchdog", "frame_period", 0.0025);
+
+    /// @brief Age at which telemetry is late (frames). Config 'late_frames'.
+    DAE_PARAM(double, LATE_FRAMES, "Watchdog", "late_frames", 1.5);
+
+    /// @brief Age at which the failsafe engages (frames). Config
+    /// 'failsafe_frames'.
+    DAE_PARAM(double, FAILSAFE_FRAMES, "Watchdog", "failsafe_frames", 2.5);
+
+    /// @brief Age at which telemetry is lost (s). Config 'lost_timeout'.
+    DAE_PARAM(double, LOST_TIMEOUT, "Watchdog", "lost_timeout", 1.0);
+
+    // State
+
+    /// @brief Timer file descriptor, -1 when stopped or sleeping instead.
+    int timer = -1;
+
+    /// @brief Action of each level.
+    std::function<void(void)> actions[LV_COUNT];
+
+    /// @brief Time of the last feed (ns).
+    std::atomic<uint64_t> lastFeed{0};
+
+    /// @brief Current level.
+    std::atomic<int> current{LV_OK};
+
+    /// @brief Number of times the watchdog left `LV_OK`.
+    std::atomic<uint64_t> tripCount{0};
+
+    /// @brief Cleared to stop the watchdog thread.
+    std::atomic<bool> running{false};
+
+    /// @brief The watchdog thread.
+    std::thread watcher;
+
+    /**
+     * @brief Watchdog thread loop.
+     */
+    void run(void);
+
+    /**
+     * @brief Arm the timer with the current period.
+     *
+     * @return bool False if the timer could not be armed.
+     */
+    bool arm(void);
+
+    /**
+     * @brief Re-arm the timer after the period changes.
+     */
+    void rearm(void);
+
+    /**
+     * @brief Check the age of the last feed, and escalate or recover.
+     */
+    void check(void);
+
+    /**
+     * @brief Get the monotonic time (ns).
+     */
+    static uint64_t now(void);
+};
+
+} // namespace Dae
@@ -0,0 +1,174 @@
+/**
+ * @file ControlAllocator.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the ControlAllocator class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "common/Configurable.h"
+#include "common/Matrix.h"
+#include "control/Mixer.h"
+
+namespace Dae {
+
+/**
+ * @brief Weighted least squares control allocator, for airframes with more
+ * actuators than demand axes.
+ *
+ * Finds the actuator positions `u` within their limits that minimise
+ *
+ *     gamma * |Wv (B u - v)|^2 + |Wu (u - up)|^2
+ *
+ * where `B` is the effectiveness of each channel on each axis, `v` the
+ * demand and `up` the preferred, trimmed, positions. The demand term is
+ * weighted far above the preference, so the demand is met whenever the
+ * actuators can meet it, and when they saturate the error is spread by the
+ * axis weights. Redundant actuators stay close to their preferred
+ * positions.
+ *
+ * The problem is solved by an active set method, which holds a set of
+ * actuators at their limits and solves for the rest, through a Cholesky
+ * factorisation of the free block of the fixed size Hessian. Each iteration
+ * either finishes, fixes an actuator that hit a limit, or frees one that
+ * the gradient pulls off its limit. The solution and its active set are
+ * kept as the warm start of the next solve, so a slowly changing demand
+ * usually takes one or two iterations, and the iterations are capped at
+ * `MAX_ITERATIONS`, which bounds the worst case time. A capped solve
+ * returns the last feasible iterate.
+ *
+ * Demand axes are indexed by `Mixer::Axis`. Config, for each channel,
+ * 'ch<N>_roll', 'ch<N>_pitch', 'ch<N>_yaw' and 'ch<N>_throttle' give its
+ * effectiveness, 'ch<N>_min' and 'ch<N>_max' its limits, 'ch<N>_trim' its
+ * preferred position and 'ch<N>_weight' the cost of moving it. Config
+ * '<axis>_weight' weighs each demand axis, and 'gamma' the demand against
+ * the preference. Channels with no effectiveness are held at their trim.
+ */
+class ControlAllocator : public Configurable {
+public:
+    using Control = PhysicsBackend::Control;
+
+    /// @brief Number of demand axes.
+    static constexpr size_t AXES = Mixer::AXES;
+
+    /// @brief Number of PWM channels.
+    static constexpr size_t CHANNELS = Mixer::CHANNELS;
+
+    /// @brief Most active set iterations in a solve.
+    static constexpr size_t MAX_ITERATIONS = 2 * CHANNELS;
+
+    /// @brief Demands, indexed by `Mixer::Axis`.
+    using Demand = Mixer::Demand;
+
+    /// @brief Actuator positions, one per channel.
+    using Actuators = Vector<CHANNELS>;
+
+    /// @brief Effectiveness of each channel on each axis.
+    using Effectiveness = Matrix<AXES, CHANNELS>;
+
+    /**
+     * @brief Construct a new ControlAllocator object, at the preferred
+     * positions.
+     *
+     * @param key Configuration key.
+     */
+    explicit ControlAllocator(const std::string& key = "ControlAllocator");
+
+    /**
+     * @brief Allocate a demand, warm started from the last solution, and
+     * write the positions of every channel.
+     *
+     * @param demand The demand.
+     * @param control The control signal.
+     * @return size_t The number of iterations taken.
+     */
+    size_t allocate(const Demand& demand, Control& control);
+
+    /**
+     * @brief Drop the warm start, back to the preferred positions with no
+     * actuator held at a limit.
+     */
+    void reset(void);
+
+    /**
+     * @brief Get the actuator positions of the last solve.
+     *
+     * @return const Actuators& The positions.
+     */
+    const Actuators& positions(void) const { return solution; }
+
+    /**
+     * @brief Get the compiled effectiveness matrix.
+     *
+     * @return const Effectiveness& The effectiveness, a row per axis.
+     */
+    const Effectiveness& matrix(void) const { return effectiveness; }
+
+    /**
+     * @brief Get the demand the last positions achieve, `B u`.
+     *
+     * @return Demand The achieved demand.
+     */
+    Demand achieved(void) const { return effectiveness * solution; }
+
+    /**
+     * @brief Check whether the last solve reached the optimum, rather than
+     * the iteration cap.
+     *
+     * @return bool True if optimal.
+     */
+    bool optimal(void) const { return converged; }
+
+    /// @copydoc Dae::Configurable::configure
+    void configure(void) override;
+
+private:
+    // Configs
+
+    /// @brief Effectiveness of each channel on each axis.
+    Effectiveness effectiveness = Effectiveness::zero();
+
+    /// @brief Lowest position of each channel.
+    Actuators lower = Actuators::zero();
+
+    /// @brief Highest position of each channel.
+    Actuators upper = Actuators::zero();
+
+    /// @brief Preferred position of each channel.
+    Actuators preferred = Actuators::zero();
+
+    // State
+
+    /// @brief Hessian of the cost, `gamma B' Wv^2 B + Wu^2`.
+    Matrix<CHANNELS, CHANNELS> hessian = Matrix<CHANNELS, CHANNELS>::zero();
+
+    /// @brief Maps the demand onto the linear term, `gamma B' Wv^2`.
+    Matrix<CHANNELS, AXES> demandGain = Matrix<CHANNELS, AXES>::zero();
+
+    /// @brief Preference part of the linear term, `Wu^2 up`.
+    Actuators preferredTerm = Actuators::zero();
+
+    /// @brief Channels with an effectiveness, the ones solved for.
+    size_t actuators[CHANNELS]{};
+
+    /// @brief Number of channels solved for.
+    size_t count = 0;
+
+    /// @brief Actuator positions of the last solve.
+    Actuators solution = Actuators::zero();
+
+    /// @brief Limit each channel is held at, -1 lower, 1 upper, 0 free.
+    int8_t held[CHANNELS]{};
+
+    /// @brief Whether the last solve reached the optimum.
+    bool converged = true;
+};
+
+} // namespace Dae
@@ -0,0 +1,170 @@
+/**
+ * @file EffectivenessEstimator.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the EffectivenessEstimator class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "common/Configurable.h"
+#include "common/RecursiveLeastSquares.h"
+#include "sim/PhysicsBackend.h"
+
+namespace Dae {
+
+/**
+ * @brief Identifies the control effectiveness and damping of the roll,
+ * pitch and yaw axes online, from the gyro and the PWM signal.
+ *
+ * Each axis is modelled as
+ *
+ *     dw/dt = damping * w + effectiveness * u + bias
+ *
+ * where `w` is the body rate of the axis and `u` its input, a configured
+ * mix of the PWM channels. The rate derivative is differenced between
+ * consecutive gyro samples, against the rate and input over the interval,
+ * and fitted by a recursive least squares estimator per axis, with
+ * exponential forgetting so the estimates follow changes in airspeed and
+ * damage. Damping is negative for a stable axis.
+ *
+ * An update costs three 3 parameter factored updates and a matrix vector
+ * product, and the estimates can be read by controllers every tick.
+ *
+ * Config 'ch<N>_roll', 'ch<N>_pitch' and 'ch<N>_yaw' give the weight of
+ * channel N in the input of each axis, by default the aileron, elevator and
+ * rudder channels of `Mixer`'s 'aileron' airframe.
+ */
+class EffectivenessEstimator : public Configurable {
+public:
+    using Telemetry = PhysicsBackend::Telemetry;
+    using Control   = PhysicsBackend::Control;
+
+    /// @brief Number of PWM channels.
+    static constexpr size_t CHANNELS = sizeof(Control::pwm) / sizeof(double);
+
+    /// @brief Estimator of one axis, parameters ordered as `Parameter`.
+    using Estimator = RecursiveLeastSquares<3>;
+
+    /**
+     * @brief Parameters of an axis model.
+     */
+    enum Parameter { PA_DAMPING = 0, PA_EFFECTIVENESS, PA_BIAS };
+
+    /**
+     * @brief Construct a new EffectivenessEstimator object.
+     *
+     * @param key Configuration key.
+     */
+    explicit EffectivenessEstimator(
+        const std::string& key = "EffectivenessEstimator");
+
+    /**
+     * @brief Reset every estimate to zero, with the initial variance.
+     */
+    void reset(void);
+
+    /**
+     * @brief Fuse a gyro sample. The first sample after a reset only starts
+     * the estimator.
+     *
+     * @param gyro Gyroscope reading, body frame (rad/s).
+     * @param control The control signal applied since the last sample.
+     * @param dt Time since the last sample (s).
+     */
+    void update(const Vector3& gyro, const Control& control, double dt);
+
+    /**
+     * @brief Fuse a telemetry sample, timed by its timestamp.
+     *
+     * @param telemetry The telemetry.
+     * @param control The control signal applied since the last telemetry.
+     */
+    void update(const Telemetry& telemetry, const Control& control);
+
+    /**
+     * @brief Get the damping of each axis, the rate derivative (1/s).
+     *
+     * @return Vector3 The damping.
+     */
+    Vector3 damping(void) const { return parameter(PA_DAMPING); }
+
+    /**
+     * @brief Get the effectiveness of each axis, the acceleration per unit of
+     * input (rad/s^2).
+     *
+     * @return Vector3 The effectiveness.
+     */
+    Vector3 effectiveness(void) const { return parameter(PA_EFFECTIVENESS); }
+
+    /**
+     * @brief Get the acceleration of each axis at zero rate and input
+     * (rad/s^2).
+     *
+     * @return Vector3 The bias.
+     */
+    Vector3 bias(void) const { return parameter(PA_BIAS); }
+
+    /**
+     * @brief Get the estimator of an axis.
+     *
+     * @param axis The axis, 0 roll, 1 pitch, 2 yaw.
+     * @return const Estimator& The estimator.
+     */
+    const Estimator& axis(size_t axis) const { return estimators[axis]; }
+
+    /// @copydoc Dae::Configurable::configure
+    void configure(void) override;
+
+private:
+    // Configs
+
+    /// @brief Forgetting factor per update. Config 'forgetting'.
+    DAE_PARAM(double, FORGETTING, "EffectivenessEstimator", "forgetting",
+              0.998);
+
+    /// @brief Variance of the parameters on reset. Config 'initial_variance'.
+    DAE_PARAM(double, INITIAL_VARIANCE, "EffectivenessEstimator",
+              "initial_variance", 100.0);
+
+    /// @brief Cap on the variance while an axis is not excited. Config
+    /// 'max_variance'.
+    DAE_PARAM(double, MAX_VARIANCE, "EffectivenessEstimator", "max_variance",
+              1e4);
+
+    /// @brief Weight of each channel in the input of each axis.
+    Matrix<3, CHANNELS> inputs = Matrix<3, CHANNELS>::zero();
+
+    // State
+
+    /// @brief Estimator of each axis.
+    Estimator estimators[3];
+
+    /// @brief Gyroscope reading of the last sample (rad/s).
+    Vector3 previous = Vector3::zero();
+
+    /// @brief Timestamp of the last telemetry (s).
+    double lastTime = 0;
+
+    /// @brief Whether a sample has been received since the last reset.
+    bool started = false;
+
+    /**
+     * @brief Get one parameter of every axis.
+     *
+     * @param index The parameter.
+     * @return Vector3 The parameter of each axis.
+     */
+    Vector3 parameter(Parameter index) const {
+        return {{estimators[0].parameters()[index],
+                 estimators[1].parameters()[index],
+                 estimators[2].parameters()[index]}};
+    }
+};
+
+} // namespace Dae
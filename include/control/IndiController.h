@@ -0,0 +1,173 @@
+/**
+ * @file IndiController.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the IndiController class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "common/Configurable.h"
+#include "common/Matrix.h"
+#include "sim/PhysicsBackend.h"
+
+namespace Dae {
+
+/**
+ * @brief Incremental nonlinear dynamic inversion controller of the roll,
+ * pitch and yaw rates.
+ *
+ * Rather than a model of the whole airframe, the controller measures the
+ * angular acceleration the current inputs produce, and only inverts the
+ * control effectiveness to find the increment that changes it to the one
+ * wanted,
+ *
+ *     u = uf + (nu - dwf/dt) / b,    nu = k (r - w),
+ *
+ * where `r` is the rate setpoint, `w` the gyro, `k` the rate gain and `b`
+ * the effectiveness. The gyro is passed through a second order low pass
+ * filter, whose state gives the filtered rate and its derivative `dwf/dt`,
+ * and the input applied over the last tick through the same filter, giving
+ * `uf`, so the two are delayed alike. Damping, trim and disturbances show
+ * up in the measured acceleration, and need not be known. As the applied
+ * input is fed back, a saturated channel does not wind up.
+ *
+ * The filters are discretised with backward Euler, stable at any cutoff
+ * and time step. An update costs a few dozen flops per axis and the mix
+ * into the PWM channels, and does not allocate.
+ *
+ * Config 'cutoff' sets the filter cutoff (Hz). For each of 'roll', 'pitch'
+ * and 'yaw', '<axis>_gain' sets `k` (1/s) and '<axis>_effectiveness' the
+ * starting `b` (rad/s^2), which can be updated in flight, for instance from
+ * an `EffectivenessEstimator`. A reconfigure keeps the filter state and the
+ * effectiveness set in flight, unless '<axis>_effectiveness' itself changes.
+ * Config 'ch<N>_roll', 'ch<N>_pitch' and 'ch<N>_yaw' give the weight of
+ * channel N in the input of each axis, as for `EffectivenessEstimator`, and
+ * the same weights mix the inputs back into the channels, so the rows
+ * should be orthonormal.
+ */
+class IndiController : public Configurable {
+public:
+    using Telemetry = PhysicsBackend::Telemetry;
+    using Control   = PhysicsBackend::Control;
+
+    /// @brief Number of PWM channels.
+    static constexpr size_t CHANNELS = sizeof(Control::pwm) / sizeof(double);
+
+    /**
+     * @brief Construct a new IndiController object.
+     *
+     * @param key Configuration key.
+     */
+    explicit IndiController(const std::string& key = "IndiController");
+
+    /**
+     * @brief Reset the filters, and the effectiveness to its configured
+     * value. The next update only starts the filters.
+     */
+    void reset(void);
+
+    /**
+     * @brief Update the filters with a gyro sample, and write the new input
+     * of each axis into its PWM channels.
+     *
+     * @param setpoint Body rate setpoint (rad/s).
+     * @param gyro Gyroscope reading, body frame (rad/s).
+     * @param dt Time since the last update (s).
+     * @param control The control signal applied since the last update,
+     * whose mixed channels are overwritten.
+     */
+    void update(const Vector3& setpoint, const Vector3& gyro, double dt,
+                Control& control);
+
+    /**
+     * @brief Update with a telemetry sample, timed by its timestamp.
+     *
+     * @param setpoint Body rate setpoint (rad/s).
+     * @param telemetry The telemetry.
+     * @param control The control signal applied since the last telemetry,
+     * whose mixed channels are overwritten.
+     */
+    void update(const Vector3& setpoint, const Telemetry& telemetry,
+                Control& control);
+
+    /**
+     * @brief Set the effectiveness of each axis, until the next reset or
+     * change of its configured effectiveness.
+     *
+     * @param value The acceleration per unit of input (rad/s^2).
+     */
+    void setEffectiveness(const Vector3& value);
+
+    /// @brief Get the effectiveness of each axis (rad/s^2).
+    const Vector3& effectiveness(void) const { return gains; }
+
+    /// @brief Get the filtered body rate (rad/s).
+    const Vector3& rate(void) const { return rates; }
+
+    /// @brief Get the filtered angular acceleration (rad/s^2).
+    const Vector3& acceleration(void) const { return accelerations; }
+
+    /// @brief Get the filtered input of each axis.
+    const Vector3& input(void) const { return inputs; }
+
+    /// @brief Get the input of each axis written by the last update.
+    const Vector3& output(void) const { return outputs; }
+
+    /// @copydoc Dae::Configurable::configure
+    void configure(void) override;
+
+private:
+    // Configs
+
+    /// @brief Cutoff of the gyro and input filters (Hz). Config 'cutoff'.
+    DAE_PARAM(double, CUTOFF, "IndiController", "cutoff", 20.0);
+
+    /// @brief Rate gain of each axis (1/s).
+    Vector3 rateGain = Vector3::zero();
+
+    /// @brief Configured effectiveness of each axis (rad/s^2).
+    Vector3 configured = Vector3::zero();
+
+    /// @brief Weight of each channel in the input of each axis.
+    Matrix<3, CHANNELS> mix = Matrix<3, CHANNELS>::zero();
+
+    /// @brief Transpose of the weights, mixing the inputs into the channels.
+    Matrix<CHANNELS, 3> unmix = Matrix<CHANNELS, 3>::zero();
+
+    /// @brief Whether each channel is in the input of any axis.
+    bool mixed[CHANNELS]{};
+
+    // State
+
+    /// @brief Effectiveness of each axis in use (rad/s^2).
+    Vector3 gains = Vector3::zero();
+
+    /// @brief Filtered body rate (rad/s).
+    Vector3 rates = Vector3::zero();
+
+    /// @brief Filtered angular acceleration (rad/s^2).
+    Vector3 accelerations = Vector3::zero();
+
+    /// @brief Filtered input of each axis.
+    Vector3 inputs = Vector3::zero();
+
+    /// @brief Derivative of the filtered input of each axis (1/s).
+    Vector3 inputRates = Vector3::zero();
+
+    /// @brief Input of each axis written by the last update.
+    Vector3 outputs = Vector3::zero();
+
+    /// @brief Timestamp of the last telemetry (s).
+    double lastTime = 0;
+
+    /// @brief Whether a sample has been received since the last reset.
+    bool started = false;
+};
+
+} // namespace Dae
@@ -0,0 +1,144 @@
+/**
+ * @file Mixer.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the Mixer class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "common/Configurable.h"
+#include "common/Matrix.h"
+#include "sim/PhysicsBackend.h"
+
+namespace Dae {
+
+/**
+ * @brief Maps roll, pitch, yaw and throttle demands onto the PWM channels.
+ *
+ * The configuration is compiled into a dense mixing matrix, with a row per
+ * channel and a column per axis, and the per-channel trims, reversals,
+ * limits and expo curves. Each channel outputs
+ *
+ *     pwm = clamp(s * (trim + w * throttle + x * (1 - e + e * x^2)))
+ *
+ * where `x` is the channel's share of the roll, pitch and yaw demands, `w`
+ * its throttle weight, `s` is -1 for reversed channels and `e` is the expo.
+ * A reversed channel is mirrored about its centre, trim included, and expo
+ * only shapes the surface demands, so neither bends a throttle channel out
+ * of its range. As the expo curve is odd, the reversal is folded into the
+ * matrix and trims, so a mix is one matrix vector product and one pass over
+ * the channels, two at a time with SSE2.
+ *
+ * Config 'airframe' starts the matrix from a preset, and the keys of a
+ * channel, 'ch<N>_roll', 'ch<N>_pitch', 'ch<N>_yaw', 'ch<N>_throttle',
+ * 'ch<N>_trim', 'ch<N>_reverse', 'ch<N>_min', 'ch<N>_max' and 'ch<N>_expo',
+ * override it. Presets, by channel:
+ *
+ * - 'aileron': 0 aileron, 1 elevator, 2 throttle, 3 rudder.
+ * - 'elevon': 0 left elevon, 1 right elevon, 2 throttle, 3 rudder.
+ * - 'vtail': 0 aileron, 1 left ruddervator, 2 throttle, 3 right
+ *   ruddervator.
+ * - 'flaperon': 0 left flaperon, 1 elevator, 2 throttle, 3 rudder, 4 right
+ *   flaperon. Trim both flaperons for flaps.
+ * - 'twin': 0 aileron, 1 elevator, 2 left motor, 3 rudder, 4 right motor,
+ *   with differential thrust for yaw.
+ *
+ * Surfaces deflect with weight 1, and where a pair of surfaces differ, the
+ * left one has the positive weight. Servo directions are matched with the
+ * reverse keys. Throttle, from 0 to 1, is mapped onto the full channel
+ * range by a weight of 2 and a default trim of -1.
+ */
+class Mixer : public Configurable {
+public:
+    using Control = PhysicsBackend::Control;
+
+    /**
+     * @brief Demand axes, the columns of the mixing matrix.
+     */
+    enum Axis { AX_ROLL = 0, AX_PITCH, AX_YAW, AX_THROTTLE };
+
+    /// @brief Number of demand axes.
+    static constexpr size_t AXES = 4;
+
+    /// @brief Number of PWM channels.
+    static constexpr size_t CHANNELS = sizeof(Control::pwm) / sizeof(double);
+
+    /// @brief Names of the axes in configuration keys, indexed by `Axis`.
+    static constexpr const char* AXIS_NAMES[AXES] = {"roll", "pitch", "yaw",
+                                                     "throttle"};
+
+    /// @brief Channels of the roll, pitch and yaw surfaces in the 'aileron'
+    /// airframe, the default for controllers that only take one per axis.
+    static constexpr size_t DEFAULT_CHANNELS[3] = {0, 1, 3};
+
+    /// @brief Demands, indexed by `Axis`. Roll, pitch and yaw are from -1 to
+    /// 1, and throttle from 0 to 1.
+    using Demand = Vector<AXES>;
+
+    /// @brief Mixing matrix, a row per channel.
+    using Weights = Matrix<CHANNELS, AXES>;
+
+    /**
+     * @brief Construct a new Mixer object.
+     *
+     * @param key Configuration key.
+     */
+    explicit Mixer(const std::string& key = "Mixer");
+
+    /**
+     * @brief Get the key of the weight of a channel on an axis,
+     * 'ch<N>_<axis>'.
+     *
+     * @param channel The channel.
+     * @param axis The axis, indexed by `Axis`.
+     * @return std::string The key.
+     */
+    static std::string channelKey(size_t channel, size_t axis);
+
+    /**
+     * @brief Mix demands into the PWM channels.
+     *
+     * @param demand The demands.
+     * @param control The control signal, every channel is written.
+     */
+    void mix(const Demand& demand, Control& control) const;
+
+    /**
+     * @brief Get the compiled mixing matrix, reversals included.
+     *
+     * @return const Weights& The mixing matrix.
+     */
+    const Weights& matrix(void) const { return weights; }
+
+    /// @copydoc Dae::Configurable::configure
+    void configure(void) override;
+
+private:
+    // State
+
+    /// @brief Mixing matrix, reversals included.
+    Weights weights = Weights::zero();
+
+    /// @brief Output at zero deflection of each channel, reversal included.
+    double trims[CHANNELS]{};
+
+    /// @brief Throttle column of the mixing matrix.
+    double throttles[CHANNELS]{};
+
+    /// @brief Expo of each channel, from 0 for linear to 1 for cubic.
+    double expos[CHANNELS]{};
+
+    /// @brief Lowest output of each channel.
+    double mins[CHANNELS]{};
+
+    /// @brief Highest output of each channel.
+    double maxs[CHANNELS]{};
+};
+
+} // namespace Dae
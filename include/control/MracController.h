@@ -0,0 +1,132 @@
+/**
+ * @file MracController.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the MracController class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <string>
+
+#include "common/Configurable.h"
+#include "common/Matrix.h"
+
+namespace Dae {
+
+/**
+ * @brief Model reference adaptive controller of the roll, pitch and yaw
+ * rates.
+ *
+ * Each axis is taken to follow `dw/dt = a w + b u + c` with unknown `a`,
+ * `b` and `c`, and `b` positive. The controller makes the rate track a first
+ * order reference model,
+ *
+ *     dwm/dt = am (r - wm),
+ *
+ * with the control law `u = kx w + kr r + kc`, whose gains adapt along the
+ * Lyapunov gradient of the tracking error `e = w - wm`,
+ *
+ *     dkx/dt = -g w e,    dkr/dt = -g r e,    dkc/dt = -g e.
+ *
+ * The gains are projected onto bounds after every update, so they stay
+ * bounded whatever the disturbance, and adaptation is held while the output
+ * saturates, where the error is no longer the gains' doing. A loss of
+ * effectiveness from damage, or a change of damping from a payload, is
+ * taken up by the gains without retuning.
+ *
+ * Config, for each of 'roll', 'pitch' and 'yaw': '<axis>_bandwidth' the
+ * reference model bandwidth `am` (1/s), '<axis>_effectiveness' the expected
+ * `b` the gains start from (rad/s^2), '<axis>_adaptation' the adaptation
+ * rate `g`, and '<axis>_gain_limit' the bound on the magnitude of every
+ * gain. A reconfigure keeps the adapted gains, projected onto the new bounds,
+ * and the reference model, which follows the new bandwidth from the next
+ * update; only reset() returns the gains to their initial values. All three
+ * axes are updated together, at a fixed cost, without allocating.
+ */
+class MracController : public Configurable {
+public:
+    /**
+     * @brief Construct a new MracController object.
+     *
+     * @param key Configuration key.
+     */
+    explicit MracController(const std::string& key = "MracController");
+
+    /**
+     * @brief Reset the gains to their initial values, and the reference
+     * model to a rate. A changed '<axis>_effectiveness' only takes effect
+     * here, as a reconfigure keeps the adapted gains.
+     *
+     * @param rate Body rate to start the reference model at (rad/s).
+     */
+    void reset(const Vector3& rate = Vector3::zero());
+
+    /**
+     * @brief Adapt the gains and compute the outputs for one tick.
+     *
+     * @param setpoint Body rate setpoint (rad/s).
+     * @param rate Body rate, from the gyro (rad/s).
+     * @param dt Time since the last update (s).
+     * @return const Vector3& The outputs, from -1 to 1, roll, pitch and yaw.
+     */
+    const Vector3& update(const Vector3& setpoint, const Vector3& rate,
+                          double dt);
+
+    /// @brief Get the outputs of the last update.
+    const Vector3& output(void) const { return outputs; }
+
+    /// @brief Get the reference model rate (rad/s).
+    const Vector3& reference(void) const { return model; }
+
+    /// @brief Get the gains on the rate.
+    const Vector3& rateGain(void) const { return kx; }
+
+    /// @brief Get the gains on the setpoint.
+    const Vector3& setpointGain(void) const { return kr; }
+
+    /// @brief Get the constant terms.
+    const Vector3& offset(void) const { return kc; }
+
+    /// @copydoc Dae::Configurable::configure
+    void configure(void) override;
+
+private:
+    // Configs
+
+    /// @brief Bandwidth of the reference model of each axis (1/s).
+    Vector3 bandwidth = Vector3::zero();
+
+    /// @brief Expected effectiveness of each axis (rad/s^2).
+    Vector3 effectiveness = Vector3::zero();
+
+    /// @brief Adaptation rate of each axis.
+    Vector3 adaptation = Vector3::zero();
+
+    /// @brief Bound on the gains of each axis.
+    Vector3 limit = Vector3::zero();
+
+    // State
+
+    /// @brief Gains on the rate.
+    Vector3 kx = Vector3::zero();
+
+    /// @brief Gains on the setpoint.
+    Vector3 kr = Vector3::zero();
+
+    /// @brief Constant terms.
+    Vector3 kc = Vector3::zero();
+
+    /// @brief Reference model rate (rad/s).
+    Vector3 model = Vector3::zero();
+
+    /// @brief Outputs of the last update.
+    Vector3 outputs = Vector3::zero();
+
+    /// @brief Whether each output saturated on the last update.
+    bool saturated[3]{};
+};
+
+} // namespace Dae
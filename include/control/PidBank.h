@@ -0,0 +1,275 @@
+/**
+ * @file PidBank.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the PidGains and PidBank classes.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/Configurable.h"
+#include "sim/PhysicsBackend.h"
+
+namespace Dae {
+
+/**
+ * @brief Gains and limits of one PID loop.
+ *
+ * Changing any of them marks the bank that owns the loop as stale, so that
+ * it copies them again before its next evaluation.
+ */
+class PidGains : public Configurable {
+public:
+    /**
+     * @brief Construct a new PidGains object.
+     *
+     * @param key Configuration key.
+     * @param stale Set when a gain changes, may be null.
+     */
+    explicit PidGains(const std::string& key, bool* stale = nullptr);
+
+    // A copy would mark the same owner stale
+    PidGains(const PidGains& other)            = delete;
+    PidGains(PidGains&& other)                 = delete;
+    PidGains& operator=(const PidGains& other) = delete;
+    PidGains& operator=(PidGains&& other)      = delete;
+
+    /// @copydoc Dae::Configurable::configure
+    void configure(void) override;
+
+    // Configs
+
+    /// @brief Proportional gain. Config 'kp'.
+    DAE_PARAM(double, KP, "PidGains", "kp", 0.0);
+
+    /// @brief Integral gain (1/s). Config 'ki'.
+    DAE_PARAM(double, KI, "PidGains", "ki", 0.0);
+
+    /// @brief Derivative gain (s). Config 'kd'.
+    DAE_PARAM(double, KD, "PidGains", "kd", 0.0);
+
+    /// @brief Feed-forward gain on the setpoint. Config 'kff'.
+    DAE_PARAM(double, KFF, "PidGains", "kff", 0.0);
+
+    /// @brief Cutoff of the derivative filter (Hz), 0 to leave it
+    /// unfiltered. Config 'd_cutoff'.
+    DAE_PARAM(double, D_CUTOFF, "PidGains", "d_cutoff", 0.0);
+
+    /// @brief Largest magnitude of the integral term. Config 'i_limit'.
+    DAE_PARAM(double, I_LIMIT, "PidGains", "i_limit", 1.0);
+
+    /// @brief Lowest output. Config 'out_min'.
+    DAE_PARAM(double, OUT_MIN, "PidGains", "out_min", -1.0);
+
+    /// @brief Highest output. Config 'out_max'.
+    DAE_PARAM(double, OUT_MAX, "PidGains", "out_max", 1.0);
+
+    /// @brief Back-calculation gain, how fast the integral unwinds while the
+    /// output saturates (1/s). Config 'kt'.
+    DAE_PARAM(double, KT, "PidGains", "kt", 1.0);
+
+private:
+    /// @brief Set when a gain changes.
+    bool* stale;
+
+    /**
+     * @brief Mark the owner as stale.
+     */
+    void touch(void);
+};
+
+/**
+ * @brief Bank of PID loops evaluated together, a structure of arrays batch
+ * per tick.
+ *
+ * Each loop computes
+ *
+ *     u = kp * e + I + kd * D + kff * r,    out = clamp(u, min, max)
+ *
+ * where `e = r - y`, and `D` is the derivative of `-y` through a first order
+ * filter, so setpoint steps do not kick. The integral is advanced by
+ * `(ki * e + kt * (out - u)) * dt`, which bleeds it off while the output
+ * saturates, and is clamped to the integral limit.
+ *
+ * Loops are cascaded by giving a loop a source, whose output becomes its
+ * setpoint. Loops must be added outer loop first, and are grouped into
+ * layers by the depth of their cascade. Every layer is a contiguous range of
+ * loops, evaluated two at a time with SSE2 after the layers before it. A
+ * layer whose sources are consecutive reads their outputs in place, and any
+ * other is gathered into its setpoints first, so the vector loop only loads
+ * contiguous pairs.
+ *
+ * The gains are copied out of their `PidGains` when the bank is built and
+ * when they change, along with the derivative filter coefficients, which
+ * are recomputed whenever the time step changes. An evaluation reads no
+ * configuration, does not divide and never allocates.
+ */
+class PidBank {
+public:
+    using Control = PhysicsBackend::Control;
+
+    /**
+     * @brief Status codes for the PidBank class.
+     */
+    enum Status { ST_GOOD = 0, ST_FULL, ST_BAD_SOURCE, ST_BAD_CHANNEL };
+
+    /// @brief Largest number of loops in a bank.
+    static constexpr size_t CAPACITY = 32;
+
+    /// @brief Source or channel of a loop that has none.
+    static constexpr int NONE = -1;
+
+    PidBank() = default;
+
+    // The gains hold a pointer to the bank's stale flag
+    PidBank(const PidBank& other)            = delete;
+    PidBank(PidBank&& other)                 = delete;
+    PidBank& operator=(const PidBank& other) = delete;
+    PidBank& operator=(PidBank&& other)      = delete;
+
+    /**
+     * @brief Add a loop after the existing ones. Loops are indexed in the
+     * order they are added.
+     *
+     * @param key Configuration key of the loop's gains.
+     * @param source Loop whose output is the setpoint, `NONE` to set it with
+     * `setpoint`. Must be in the last layer or the one before it.
+     * @param channel PWM channel the output is written to, `NONE` for none.
+     * @return int Status code. 0 for success.
+     */
+    int add(const std::string& key, int source = NONE, int channel = NONE);
+
+    /**
+     * @brief Evaluate every loop, outer layers first. A tick with no time
+     * step, such as a repeated telemetry timestamp, keeps the last outputs.
+     *
+     * @param dt Time since the last evaluation (s).
+     */
+    void evaluate(double dt);
+
+    /**
+     * @brief Write the outputs of the loops with a channel.
+     *
+     * @param control The control signal.
+     */
+    void write(Control& control) const;
+
+    /**
+     * @brief Clear the integral and derivative of every loop. The next
+     * evaluation takes its measurements as the previous ones.
+     */
+    void reset(void);
+
+    /// @brief Set the setpoint of a loop without a source.
+    void setpoint(size_t loop, double value) { setpoints[loop] = value; }
+
+    /// @brief Set the measurement of a loop.
+    void measure(size_t loop, double value) { measurements[loop] = value; }
+
+    /// @brief Get the output of a loop from the last evaluation.
+    double output(size_t loop) const { return outputs[loop]; }
+
+    /// @brief Get the integral term of a loop.
+    double integral(size_t loop) const { return integrals[loop]; }
+
+    /// @brief Get the gains of a loop.
+    PidGains& gains(size_t loop) { return *handles[loop]; }
+
+    /// @brief Get the number of loops.
+    size_t size(void) const { return count; }
+
+private:
+    // Gains, copied from the handles
+
+    /// @brief Proportional gains.
+    alignas(16) double kp[CAPACITY]{};
+    /// @brief Integral gains (1/s).
+    alignas(16) double ki[CAPACITY]{};
+    /// @brief Derivative gains (s).
+    alignas(16) double kd[CAPACITY]{};
+    /// @brief Feed-forward gains.
+    alignas(16) double kff[CAPACITY]{};
+    /// @brief Back-calculation gains (1/s).
+    alignas(16) double kt[CAPACITY]{};
+    /// @brief Derivative filter coefficients, `1 / (dt + tau)` for filter
+    /// time constant `tau` (1/s).
+    alignas(16) double filter[CAPACITY]{};
+    /// @brief Integral limits.
+    alignas(16) double iLimit[CAPACITY]{};
+    /// @brief Lowest outputs.
+    alignas(16) double outMin[CAPACITY]{};
+    /// @brief Highest outputs.
+    alignas(16) double outMax[CAPACITY]{};
+
+    // State
+
+    /// @brief Setpoints.
+    alignas(16) double setpoints[CAPACITY]{};
+    /// @brief Measurements.
+    alignas(16) double measurements[CAPACITY]{};
+    /// @brief Outputs of the last evaluation.
+    alignas(16) double outputs[CAPACITY]{};
+    /// @brief Integral terms.
+    alignas(16) double integrals[CAPACITY]{};
+    /// @brief Filtered derivatives of the negated measurements.
+    alignas(16) double derivatives[CAPACITY]{};
+    /// @brief Measurements of the last evaluation.
+    alignas(16) double previous[CAPACITY]{};
+
+    /// @brief Source of each loop, or `NONE`.
+    int sources[CAPACITY]{};
+
+    /// @brief PWM channel of each loop, or `NONE`.
+    int channels[CAPACITY]{};
+
+    /// @brief Source of the first loop of each layer, if the sources of the
+    /// rest follow on from it, otherwise `NONE`.
+    int firstSources[CAPACITY]{};
+
+    /// @brief Index one past the last loop of each layer.
+    size_t layerEnds[CAPACITY]{};
+
+    /// @brief Number of layers.
+    size_t layers = 0;
+
+    /// @brief Number of loops.
+    size_t count = 0;
+
+    /// @brief The gains of each loop.
+    std::vector<std::unique_ptr<PidGains>> handles;
+
+    /// @brief Time step the filter coefficients were computed for (s).
+    double step = 0;
+
+    /// @brief Set when a gain has changed since the last copy.
+    bool stale = false;
+
+    /// @brief Set until the first evaluation after a reset.
+    bool fresh = true;
+
+    /**
+     * @brief Copy every loop's gains out of its configuration.
+     *
+     * @param dt Time step to compute the filter coefficients for (s).
+     */
+    void refresh(double dt);
+
+    /**
+     * @brief Evaluate a contiguous range of loops, over the time step of the
+     * last refresh.
+     *
+     * @param begin First loop.
+     * @param end One past the last loop.
+     * @param reference Setpoints, indexed by loop.
+     */
+    void evaluate(size_t begin, size_t end, const double* reference);
+};
+
+} // namespace Dae
@@ -0,0 +1,202 @@
+/**
+ * @file FlightLog.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the binary flight log format.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Dae {
+
+/**
+ * @brief Self describing binary flight log format, following the ArduPilot
+ * DataFlash layout.
+ *
+ * Every record starts with the two header bytes and a message ID, followed by
+ * the packed, little endian payload of that message. The log starts with one
+ * `FMT` record per message type, which gives the message name, its length, a
+ * format string and comma separated field labels, so a reader can decode any
+ * message without prior knowledge of it.
+ *
+ * Format characters:
+ *
+ * | Char | Type       | Char | Type       | Char | Type     |
+ * |------|------------|------|------------|------|----------|
+ * | b    | int8_t     | h    | int16_t    | i    | int32_t  |
+ * | B    | uint8_t    | H    | uint16_t   | I    | uint32_t |
+ * | q    | int64_t    | Q    | uint64_t   | f    | float    |
+ * | d    | double     | n    | char[4]    | N    | char[16] |
+ * | Z    | char[64]   |      |            |      |          |
+ */
+class FlightLog {
+public:
+    /// @brief First header byte of every record.
+    static constexpr uint8_t HEAD_BYTE1 = 0xA3;
+
+    /// @brief Second header byte of every record.
+    static constexpr uint8_t HEAD_BYTE2 = 0x95;
+
+    /// @brief Maximum number of fields in a message.
+    static constexpr size_t MAX_FIELDS = 16;
+
+    /**
+     * @brief Message IDs of the built in messages. IDs from `MSG_USER` up are
+     * free for components to define.
+     */
+    enum MessageId : uint8_t {
+        MSG_FORMAT = 128,
+        MSG_TELEM_IMU,
+        MSG_TELEM_STATE,
+        MSG_CONTROL_LOW,
+        MSG_CONTROL_HIGH,
+        MSG_LOOP,
+        MSG_TELEM_BLOCK,
+        MSG_USER = 160
+    };
+
+#pragma pack(push, 1)
+    /**
+     * @brief Header of every record.
+     */
+    struct Header {
+        uint8_t head1 = HEAD_BYTE1;
+        uint8_t head2 = HEAD_BYTE2;
+        uint8_t id;
+    };
+
+    /**
+     * @brief Payload of an `FMT` record, describing another message.
+     */
+    struct Format {
+        /// @brief Described message ID.
+        uint8_t type;
+        /// @brief Length of the described record, including its header.
+        uint8_t length;
+        /// @brief Message name, not necessarily NULL terminated.
+        char name[4];
+        /// @brief Format characters, not necessarily NULL terminated.
+        char format[16];
+        /// @brief Comma separated field labels, not necessarily NULL
+        /// terminated.
+        char labels[64];
+    };
+
+    /**
+     * @brief `TELI` payload, the IMU part of the telemetry.
+     */
+    struct TelemImu {
+        uint64_t timeUs;
+        double   timestamp;
+        double   gyro[3];
+        double   accel[3];
+    };
+
+    /**
+     * @brief `TELS` payload, the state part of the telemetry.
+     */
+    struct TelemState {
+        uint64_t timeUs;
+        double   position[3];
+        double   velocity[3];
+        double   quaternion[4];
+    };
+
+    /**
+     * @brief `CTLL` / `CTLH` payload, half of the control channels.
+     */
+    struct ControlHalf {
+        uint64_t timeUs;
+        float    pwm[8];
+    };
+
+    /**
+     * @brief `LOOP` payload, the control loop scheduler timings.
+     */
+    struct Loop {
+        uint64_t timeUs;
+        uint32_t frame;
+        float    period;
+        float    execution;
+        uint32_t overruns;
+    };
+
+    /**
+     * @brief `TELZ` payload, a chunk of a compressed telemetry block (see
+     * `TelemetryCompressor`). A block is split over `chunks` consecutive
+     * records, and the last one is padded with zeros.
+     */
+    struct TelemBlock {
+        uint32_t block;
+        uint16_t chunk;
+        uint16_t chunks;
+        uint8_t  data[192];
+    };
+#pragma pack(pop)
+
+    /**
+     * @brief Get the size of a format character.
+     *
+     * @param c The format character.
+     * @return size_t The field size, 0 for an unknown character.
+     */
+    static constexpr size_t fieldSize(char c) {
+        switch (c) {
+        case 'b':
+        case 'B':
+            return 1;
+        case 'h':
+        case 'H':
+            return 2;
+        case 'i':
+        case 'I':
+        case 'f':
+        case 'n':
+            return 4;
+        case 'q':
+        case 'Q':
+        case 'd':
+            return 8;
+        case 'N':
+            return 16;
+        case 'Z':
+            return 64;
+        default:
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Get the payload size described by a format string.
+     *
+     * @param format NULL terminated format string.
+     * @return size_t The payload size, 0 if the format is invalid.
+     */
+    static constexpr size_t payloadSize(const char* format) {
+        size_t size = 0;
+        for (size_t i = 0; format[i] != '\0'; i++) {
+            const size_t field = fieldSize(format[i]);
+            if (field == 0 || i >= MAX_FIELDS) return 0;
+            size += field;
+        }
+        return size;
+    }
+};
+
+static_assert(sizeof(FlightLog::Format) == FlightLog::payloadSize("BBnNZ"));
+static_assert(sizeof(FlightLog::TelemImu) ==
+              FlightLog::payloadSize("Qddddddd"));
+static_assert(sizeof(FlightLog::TelemState) ==
+              FlightLog::payloadSize("Qdddddddddd"));
+static_assert(sizeof(FlightLog::ControlHalf) ==
+              FlightLog::payloadSize("Qffffffff"));
+static_assert(sizeof(FlightLog::Loop) == FlightLog::payloadSize("QIffI"));
+static_assert(sizeof(FlightLog::TelemBlock) ==
+              FlightLog::payloadSize("IHHZZZ"));
+
+} // namespace Dae
@@ -0,0 +1,131 @@
+/**
+ * @file FlightLogExporter.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the FlightLogExporter class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "log/FlightLogReader.h"
+
+namespace Dae {
+
+/**
+ * @brief Converter of binary flight logs to CSV or columnar files, for
+ * analysis tools.
+ *
+ * CSV output is one `<NAME>.csv` file per message type, with the field labels
+ * as the header row. Columnar output is one `<NAME>.<Label>.f64` file per
+ * numeric field, holding the raw little endian doubles of every record, which
+ * can be memory mapped directly.
+ *
+ * Compressed telemetry is decoded through `FlightLogReader::telemetry` and
+ * written as `TELZ` rows of the whole telemetry frame, rather than as the raw
+ * block chunks.
+ */
+class FlightLogExporter {
+public:
+    /**
+     * @brief Status codes for the FlightLogExporter class.
+     */
+    enum Status { ST_GOOD = 0, ST_FOPEN_FAIL, ST_OUTPUT_FAIL };
+
+    /// @brief Field labels of a decoded compressed telemetry frame.
+    static constexpr const char* TELEMETRY_LABELS =
+        "T,GyrX,GyrY,GyrZ,AccX,AccY,AccZ,PN,PE,PD,VN,VE,VD,Q1,Q2,Q3,Q4";
+
+    /**
+     * @brief Convert a log file.
+     *
+     * @param filepath Path of the log file.
+     * @param dir Output directory, which must exist.
+     * @param columnar Write columnar files rather than CSV files.
+     * @return int Status code. 0 for success.
+     */
+    int convert(const std::string& filepath, const std::string& dir,
+                bool columnar);
+
+    /**
+     * @brief Get the number of records written per message name by the last
+     * conversion.
+     *
+     * @return const std::map<std::string, size_t>& Records by message name.
+     */
+    const std::map<std::string, size_t>& counts(void) const {
+        return records;
+    }
+
+    /**
+     * @brief Get the number of corrupt bytes skipped by the last conversion.
+     *
+     * @return size_t Number of skipped bytes.
+     */
+    size_t skipped(void) const { return skippedBytes; }
+
+    /**
+     * @brief Get the number of compressed telemetry blocks the last conversion
+     * could not decode.
+     *
+     * @return size_t Number of lost blocks.
+     */
+    size_t lostBlocks(void) const { return lost; }
+
+private:
+    /**
+     * @brief Output files of one message type.
+     */
+    struct Output {
+        /// @brief The CSV file.
+        FILE* csv = nullptr;
+        /// @brief One file per field in columnar mode.
+        std::vector<FILE*> columns;
+    };
+
+    /// @brief Records written per message name.
+    std::map<std::string, size_t> records;
+
+    /// @brief Corrupt bytes skipped.
+    size_t skippedBytes = 0;
+
+    /// @brief Compressed telemetry blocks lost.
+    size_t lost = 0;
+
+    /**
+     * @brief Open the output files of a message type.
+     *
+     * @param out The output files.
+     * @param msg The message layout.
+     * @param dir Output directory.
+     * @param columnar Write columnar files rather than CSV files.
+     * @return bool True if every file was opened.
+     */
+    static bool open(Output& out, const FlightLogReader::Message& msg,
+                     const std::string& dir, bool columnar);
+
+    /**
+     * @brief Write a record to the output files of its message type.
+     *
+     * @param out The output files.
+     * @param record The record.
+     * @param columnar Write columnar files rather than CSV files.
+     */
+    static void write(Output& out, const FlightLogReader::Record& record,
+                      bool columnar);
+
+    /**
+     * @brief Close the output files of a message type.
+     *
+     * @param out The output files.
+     */
+    static void close(Output& out);
+};
+
+} // namespace Dae
@@ -0,0 +1,136 @@
+/**
+ * @file FlightLogReader.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the FlightLogReader class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "log/FlightLog.h"
+#include "sim/PhysicsBackend.h"
+
+namespace Dae {
+
+/**
+ * @brief Offline decoder of binary flight logs written by the FlightRecorder.
+ *
+ * The reader learns every message layout from the `FMT` records in the log, so
+ * it can decode messages it has no compiled in knowledge of. Corrupt or
+ * unknown records are skipped by scanning for the next record header.
+ */
+class FlightLogReader {
+public:
+    /**
+     * @brief Status codes for the FlightLogReader class.
+     */
+    enum Status { ST_GOOD = 0, ST_FOPEN_FAIL };
+
+    /**
+     * @brief A message layout, taken from an `FMT` record.
+     */
+    struct Message {
+        /// @brief Message ID.
+        uint8_t id;
+        /// @brief Record length, including the header.
+        size_t length;
+        /// @brief Message name.
+        std::string name;
+        /// @brief Format characters.
+        std::string format;
+        /// @brief Field labels.
+        std::vector<std::string> labels;
+    };
+
+    /**
+     * @brief A decoded record.
+     */
+    struct Record {
+        /// @brief Layout of the record.
+        const Message* message;
+        /// @brief Numeric field values, 0 for string fields.
+        std::vector<double> values;
+        /// @brief String field values, empty for numeric fields.
+        std::vector<std::string> strings;
+        /// @brief The packed payload, valid until the log is reopened.
+        const uint8_t* payload;
+    };
+
+    /**
+     * @brief Load a log file.
+     *
+     * @param filepath Path of the log file.
+     * @return int Status code. 0 for success.
+     */
+    int open(const std::string& filepath);
+
+    /**
+     * @brief Decode the next record.
+     *
+     * @param record Set to the decoded record.
+     * @return bool False once the end of the log is reached.
+     */
+    bool next(Record& record);
+
+    /**
+     * @brief Decode the compressed telemetry of the whole log, from the
+     * `TELZ` records. The read position is left where it was.
+     *
+     * @param out Decoded frames in recording order, replaced.
+     * @return size_t Number of blocks skipped as incomplete or corrupt.
+     */
+    size_t telemetry(std::vector<PhysicsBackend::Telemetry>& out);
+
+    /**
+     * @brief Get the layout of a message.
+     *
+     * @param id Message ID.
+     * @return const Message* The layout, nullptr if it is not defined yet.
+     */
+    const Message* message(uint8_t id) const;
+
+    /**
+     * @brief Get the number of bytes skipped while looking for records.
+     *
+     * @return size_t Number of skipped bytes.
+     */
+    size_t skipped(void) const { return skippedBytes; }
+
+private:
+    /// @brief The whole log.
+    std::vector<uint8_t> data;
+
+    /// @brief Read position in the log.
+    size_t offset = 0;
+
+    /// @brief Bytes skipped while looking for records.
+    size_t skippedBytes = 0;
+
+    /// @brief Layout of every message seen so far, by ID.
+    std::vector<Message> messages = std::vector<Message>(UINT8_MAX + 1);
+
+    /**
+     * @brief Decode a record payload.
+     *
+     * @param msg The record layout.
+     * @param payload The payload.
+     * @param record The record to decode into.
+     */
+    static void decode(const Message& msg, const uint8_t* payload,
+                       Record& record);
+
+    /**
+     * @brief Learn a message layout from an `FMT` record.
+     *
+     * @param payload The `FMT` payload.
+     */
+    void learn(const uint8_t* payload);
+};
+
+} // namespace Dae
@@ -0,0 +1,312 @@
+/**
+ * @file FlightRecorder.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the FlightRecorder class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/Configurable.h"
+#include "common/SpscQueue.h"
+#include "log/FlightLog.h"
+#include "log/TelemetryCompressor.h"
+#include "sim/PhysicsBackend.h"
+
+namespace Dae {
+
+/**
+ * @brief Full rate binary flight data recorder.
+ *
+ * Records are copied into one of a set of preallocated, page aligned buffers.
+ * When a buffer fills up it is handed to a background thread over a wait-free
+ * queue, which writes it to the log file and hands it back. The recording
+ * thread never blocks, allocates or makes a system call. If every buffer is
+ * waiting to be written the record is dropped and counted instead.
+ *
+ * Only one thread may write records. The log format is described in
+ * `FlightLog`.
+ *
+ * With config 'compress_telemetry' set, telemetry is recorded losslessly
+ * through a `TelemetryCompressor` rather than as `TELI` and `TELS` records.
+ * Each closed block is written as a run of `TELZ` chunks, and
+ * `FlightLogReader::telemetry` decodes them back. The compressor storage is
+ * reserved when the log is opened, so compressing does not allocate either.
+ */
+class FlightRecorder : public Configurable {
+public:
+    /**
+     * @brief Status codes for the FlightRecorder class.
+     */
+    enum Status {
+        ST_GOOD = 0,
+        ST_ALLOC_FAIL,
+        ST_FOPEN_FAIL,
+        ST_BAD_FORMAT,
+        ST_NOT_OPEN
+    };
+
+    /**
+     * @brief Construct a new FlightRecorder object.
+     *
+     * @param key Configuration key.
+     */
+    explicit FlightRecorder(const std::string& key = "FlightRecorder");
+
+    /**
+     * @brief Destroy the FlightRecorder object, closing the log.
+     */
+    ~FlightRecorder();
+
+    FlightRecorder(const FlightRecorder& other)            = delete;
+    FlightRecorder& operator=(const FlightRecorder& other) = delete;
+
+    /**
+     * @brief Define a message type. Must be called before `open`.
+     *
+     * @param id Message ID, from `FlightLog::MSG_USER` up.
+     * @param name Message name, up to 4 characters.
+     * @param format Format characters, see `FlightLog`.
+     * @param labels Comma separated field labels.
+     * @return int Status code. 0 for success.
+     */
+    int define(uint8_t id, const char* name, const char* format,
+               const char* labels);
+
+    /**
+     * @brief Open a log file, and start the background writer.
+     *
+     * @param filepath Path of the log file, truncated if it exists.
+     * @return int Status code. 0 for success.
+     */
+    int open(const std::string& filepath);
+
+    /**
+     * @brief Write out every buffered record, and close the log file.
+     */
+    void close(void);
+
+    /**
+     * @brief Check whether a log file is open.
+     *
+     * @return bool True if a log is open.
+     */
+    bool isOpen(void) const { return fd >= 0; }
+
+    /**
+     * @brief Record a message.
+     *
+     * @param id Message ID.
+     * @param payload Packed payload matching the message format.
+     * @param size Payload size.
+     * @return bool False if the record was dropped.
+     */
+    bool write(uint8_t id, const void* payload, size_t size) {
+        const size_t total = sizeof(FlightLog::Header) + size;
+
+        if (current == nullptr || currentUsed + total > bufferSize) {
+            if (!rotate()) {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+
+        uint8_t* out = current->data + currentUsed;
+        out[0]       = FlightLog::HEAD_BYTE1;
+        out[1]       = FlightLog::HEAD_BYTE2;
+        out[2]       = id;
+        memcpy(out + sizeof(FlightLog::Header), payload, size);
+        currentUsed += total;
+        return true;
+    }
+
+    /**
+     * @brief Record a packed message struct.
+     *
+     * @tparam T The payload type.
+     * @param id Message ID.
+     * @param payload The payload.
+     * @return bool False if the record was dropped.
+     */
+    template <typename T> bool write(uint8_t id, const T& payload) {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Flight log payloads must be trivially copyable");
+        return write(id, &payload, sizeof(T));
+    }
+
+    /**
+     * @brief Record a telemetry frame as `TELI` and `TELS` messages, or
+     * append it to the compressed telemetry. Compressed frames do not keep
+     * the record time, only the telemetry timestamp.
+     *
+     * @param timeUs Record time (us).
+     * @param telem The telemetry.
+     */
+    void writeTelemetry(uint64_t                          timeUs,
+                        const PhysicsBackend::Telemetry& telem);
+
+    /**
+     * @brief Record a control output as `CTLL` and `CTLH` messages.
+     *
+     * @param timeUs Record time (us).
+     * @param ctrl The control output.
+     */
+    void writeControl(uint64_t timeUs, const PhysicsBackend::Control& ctrl);
+
+    /**
+     * @brief Record the loop timings as a `LOOP` message.
+     *
+     * @param loop The loop timings.
+     */
+    void writeLoop(const FlightLog::Loop& loop) {
+        write(FlightLog::MSG_LOOP, loop);
+    }
+
+    /**
+     * @brief Get the number of records dropped because every buffer was
+     * waiting to be written.
+     *
+     * @return uint64_t Number of dropped records.
+     */
+    uint64_t dropped(void) const {
+        return droppedCount.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the number of bytes written to the log file.
+     *
+     * @return uint64_t Number of bytes written.
+     */
+    uint64_t written(void) const {
+        return writtenBytes.load(std::memory_order_relaxed);
+    }
+
+    /// @copydoc Dae::Configurable::configure
+    void configure(void) override;
+
+private:
+    /**
+     * @brief A page aligned log buffer.
+     */
+    struct Buffer {
+        /// @brief Page aligned storage.
+        uint8_t* data = nullptr;
+        /// @brief Bytes used, set when the buffer is handed to the writer.
+        size_t used = 0;
+    };
+
+    /// @brief Maximum number of buffers.
+    static constexpr size_t MAX_BUFFERS = 64;
+
+    /// @brief Page size that buffers are aligned to.
+    static constexpr size_t PAGE_SIZE = 4096;
+
+    /// @brief Number of telemetry frames per compressed block.
+    static constexpr uint32_t COMPRESS_FRAMES = 256;
+
+    // Configs
+
+    /// @brief Size of each buffer (bytes), rounded up to a page. Config
+    /// 'buffer_size', taking effect on the next `open`.
+    size_t BUFFER_SIZE = 64 * 1024;
+
+    /// @brief Number of buffers. Config 'buffers', taking effect on the next
+    /// `open`.
+    size_t BUFFER_COUNT = 8;
+
+    /// @brief Whether to compress telemetry. Config 'compress_telemetry',
+    /// taking effect on the next `open`.
+    bool COMPRESS = false;
+
+    /// @brief Period that the writer checks for full buffers (s). Config
+    /// 'write_period'.
+    DAE_PARAM(double, WRITE_PERIOD, "FlightRecorder", "write_period", 0.005);
+
+    // State
+
+    /// @brief Log file descriptor.
+    int fd = -1;
+
+    /// @brief Size of each allocated buffer (bytes), fixed while a log is
+    /// open.
+    size_t bufferSize = 0;
+
+    /// @brief Whether the open log compresses telemetry.
+    bool compressing = false;
+
+    /// @brief Compressor of the telemetry, holding the block being encoded.
+    TelemetryCompressor compressor{COMPRESS_FRAMES};
+
+    /// @brief Number of compressed blocks written.
+    uint32_t compressedBlocks = 0;
+
+    /// @brief Every buffer.
+    std::vector<Buffer> buffers;
+
+    /// @brief Message definitions, written at the start of the log.
+    std::vector<FlightLog::Format> formats;
+
+    /// @brief Buffer being filled by the recording thread.
+    Buffer* current = nullptr;
+
+    /// @brief Bytes used in the current buffer.
+    size_t currentUsed = 0;
+
+    /// @brief Buffers ready to be filled.
+    SpscQueue<Buffer*, MAX_BUFFERS> freeBuffers;
+
+    /// @brief Buffers ready to be written.
+    SpscQueue<Buffer*, MAX_BUFFERS> fullBuffers;
+
+    /// @brief Number of dropped records.
+    std::atomic<uint64_t> droppedCount{0};
+
+    /// @brief Number of bytes written.
+    std::atomic<uint64_t> writtenBytes{0};
+
+    /// @brief Cleared to stop the writer thread.
+    std::atomic<bool> running{false};
+
+    /// @brief The writer thread.
+    std::thread writer;
+
+    /**
+     * @brief Hand the current buffer to the writer and take a free one.
+     *
+     * @return bool False if there is no free buffer.
+     */
+    bool rotate(void);
+
+    /**
+     * @brief Record the closed compressed blocks as `TELZ` messages, and
+     * empty the compressor.
+     */
+    void writeBlocks(void);
+
+    /**
+     * @brief Writer thread loop.
+     */
+    void run(void);
+
+    /**
+     * @brief Write a buffer to the log file.
+     *
+     * @param buffer The buffer.
+     */
+    void writeBuffer(const Buffer& buffer);
+
+    /**
+     * @brief Free every buffer.
+     */
+    void freeAll(void);
+};
+
+} // namespace Dae
@@ -0,0 +1,389 @@
+/**
+ * @file Gorilla.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the Gorilla time series encoders.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Dae {
+
+/**
+ * @brief Gorilla style streaming compression of timestamps and doubles, from
+ * "Gorilla: A Fast, Scalable, In-Memory Time Series Database" (Pelkonen et
+ * al. 2015).
+ *
+ * Timestamps are encoded as the delta of their delta, and values as the XOR
+ * with the previous value of the same series. Both are lossless.
+ */
+class Gorilla {
+public:
+    /**
+     * @brief Appends bits, most significant first, to a word buffer.
+     */
+    class BitWriter {
+    public:
+        /**
+         * @brief Construct a new BitWriter object.
+         *
+         * @param out Word buffer to append to.
+         */
+        explicit BitWriter(std::vector<uint64_t>& out) : out(out) {}
+
+        /**
+         * @brief Append the low `bits` bits of a value.
+         *
+         * @param value The value, higher bits must be zero.
+         * @param bits Number of bits, up to 64.
+         */
+        void write(uint64_t value, unsigned bits) {
+            if (bits > 32) {
+                writeSmall(value >> 32, bits - 32);
+                writeSmall(value & 0xFFFFFFFFull, 32);
+            } else {
+                writeSmall(value, bits);
+            }
+        }
+
+        /**
+         * @brief Pad the last word with zeros and append it.
+         */
+        void flush(void) {
+            if (fill == 0) return;
+            out.push_back(acc << (64 - fill));
+            acc  = 0;
+            fill = 0;
+        }
+
+        /**
+         * @brief Get the number of bits written so far.
+         *
+         * @return uint64_t Number of bits.
+         */
+        uint64_t bits(void) const { return out.size() * 64 + fill; }
+
+    private:
+        /// @brief Output word buffer.
+        std::vector<uint64_t>& out;
+        /// @brief Bits not yet appended.
+        uint64_t acc = 0;
+        /// @brief Number of bits in `acc`.
+        unsigned fill = 0;
+
+        void writeSmall(uint64_t value, unsigned bits) {
+            if (bits == 0) return;
+
+            if (fill + bits < 64) {
+                acc = (acc << bits) | value;
+                fill += bits;
+                return;
+            }
+
+            // Top up the accumulator and append it
+            const unsigned first = 64 - fill;
+            const unsigned rest  = bits - first;
+            out.push_back(fill == 0 ? value >> rest
+                                    : (acc << first) | (value >> rest));
+            acc  = rest == 0 ? 0 : value & ((1ull << rest) - 1);
+            fill = rest;
+        }
+    };
+
+    /**
+     * @brief Reads bits, most significant first, from a word buffer.
+     */
+    class BitReader {
+    public:
+        /**
+         * @brief Construct a new BitReader object.
+         *
+         * @param words Word buffer to read.
+         * @param count Number of words.
+         */
+        BitReader(const uint64_t* words, size_t count)
+            : words(words), count(count) {}
+
+        /**
+         * @brief Read a value.
+         *
+         * @param bits Number of bits, up to 64.
+         * @return uint64_t The value, zero past the end of the buffer.
+         */
+        uint64_t read(unsigned bits) {
+            if (bits > 32) {
+                const uint64_t high = readSmall(bits - 32);
+                return (high << 32) | readSmall(32);
+            }
+            return readSmall(bits);
+        }
+
+        /**
+         * @brief Read a single bit.
+         *
+         * @return bool The bit.
+         */
+        bool bit(void) { return readSmall(1) != 0; }
+
+    private:
+        /// @brief Word buffer.
+        const uint64_t* words;
+        /// @brief Number of words.
+        size_t count;
+        /// @brief Read position (bits).
+        uint64_t pos = 0;
+
+        uint64_t word(size_t i) const { return i < count ? words[i] : 0; }
+
+        uint64_t readSmall(unsigned bits) {
+            if (bits == 0) return 0;
+
+            const size_t   i      = pos >> 6;
+            const unsigned offset = pos & 63;
+            pos += bits;
+
+            // Gather the bits into the top of a word
+            uint64_t top = word(i) << offset;
+            if (offset + bits > 64) top |= word(i + 1) >> (64 - offset);
+            return top >> (64 - bits);
+        }
+    };
+
+    /**
+     * @brief Delta of delta timestamp codec.
+     *
+     * Timestamps are in seconds. Timestamps that are an exact number of
+     * microseconds use the delta of delta buckets from the paper, anything
+     * else is escaped and stored raw.
+     */
+    class TimeCodec {
+    public:
+        /**
+         * @brief Encode a timestamp.
+         *
+         * @param out The bit writer.
+         * @param t The timestamp (s).
+         */
+        void encode(BitWriter& out, double t) {
+            int64_t ticks;
+            if (!first && toTicks(t, ticks)) {
+                const int64_t delta = ticks - prevTicks;
+                const int64_t dod   = delta - prevDelta;
+
+                if (dod == 0) {
+                    out.write(0b0, 1);
+                } else if (fits(dod, 7)) {
+                    out.write(0b10, 2);
+                    out.write(static_cast<uint64_t>(dod) & 0x7F, 7);
+                } else if (fits(dod, 9)) {
+                    out.write(0b110, 3);
+                    out.write(static_cast<uint64_t>(dod) & 0x1FF, 9);
+                } else if (fits(dod, 12)) {
+                    out.write(0b1110, 4);
+                    out.write(static_cast<uint64_t>(dod) & 0xFFF, 12);
+                } else if (fits(dod, 32)) {
+                    out.write(0b11110, 5);
+                    out.write(static_cast<uint64_t>(dod) & 0xFFFFFFFF, 32);
+                } else {
+                    escape(out, t);
+                    return;
+                }
+
+                prevTicks = ticks;
+                prevDelta = delta;
+                return;
+            }
+
+            if (first) {
+                out.write(std::bit_cast<uint64_t>(t), 64);
+                reset(t);
+                first = false;
+            } else {
+                escape(out, t);
+            }
+        }
+
+        /**
+         * @brief Decode a timestamp.
+         *
+         * @param in The bit reader.
+         * @return double The timestamp (s).
+         */
+        double decode(BitReader& in) {
+            if (first) {
+                first          = false;
+                const double t = std::bit_cast<double>(in.read(64));
+                reset(t);
+                return t;
+            }
+
+            int64_t dod;
+            if (!in.bit()) {
+                dod = 0;
+            } else if (!in.bit()) {
+                dod = signExtend(in.read(7), 7);
+            } else if (!in.bit()) {
+                dod = signExtend(in.read(9), 9);
+            } else if (!in.bit()) {
+                dod = signExtend(in.read(12), 12);
+            } else if (!in.bit()) {
+                dod = signExtend(in.read(32), 32);
+            } else {
+                const double t = std::bit_cast<double>(in.read(64));
+                reset(t);
+                return t;
+            }
+
+            prevDelta += dod;
+            prevTicks += prevDelta;
+            return static_cast<double>(prevTicks) / TICKS_PER_SECOND;
+        }
+
+    private:
+        /// @brief Timestamp resolution.
+        static constexpr double TICKS_PER_SECOND = 1e6;
+
+        /// @brief Set until the first timestamp is coded.
+        bool first = true;
+        /// @brief Previous timestamp (ticks).
+        int64_t prevTicks = 0;
+        /// @brief Previous delta (ticks).
+        int64_t prevDelta = 0;
+
+        static bool fits(int64_t value, unsigned bits) {
+            const int64_t limit = int64_t{1} << (bits - 1);
+            return value >= -limit && value < limit;
+        }
+
+        static int64_t signExtend(uint64_t value, unsigned bits) {
+            const uint64_t sign = uint64_t{1} << (bits - 1);
+            return static_cast<int64_t>((value ^ sign) - sign);
+        }
+
+        /**
+         * @brief Convert a timestamp to ticks, if it round trips exactly.
+         */
+        static bool toTicks(double t, int64_t& ticks) {
+            if (!(std::fabs(t) < 1e12)) return false;
+            ticks = std::llround(t * TICKS_PER_SECOND);
+            return static_cast<double>(ticks) / TICKS_PER_SECOND == t;
+        }
+
+        /**
+         * @brief Restart the delta chain from a raw timestamp. Both sides do
+         * this identically, so they stay in step.
+         */
+        void reset(double t) {
+            if (!toTicks(t, prevTicks)) prevTicks = 0;
+            prevDelta = 0;
+        }
+
+        void escape(BitWriter& out, double t) {
+            out.write(0b11111, 5);
+            out.write(std::bit_cast<uint64_t>(t), 64);
+            reset(t);
+        }
+    };
+
+    /**
+     * @brief XOR value codec for a single series of doubles.
+     */
+    class ValueCodec {
+    public:
+        /**
+         * @brief Encode a value.
+         *
+         * @param out The bit writer.
+         * @param value The value.
+         */
+        void encode(BitWriter& out, double value) {
+            const uint64_t bits = std::bit_cast<uint64_t>(value);
+
+            if (first) {
+                out.write(bits, 64);
+                prev  = bits;
+                first = false;
+                return;
+            }
+
+            const uint64_t x = bits ^ prev;
+            prev             = bits;
+
+            if (x == 0) {
+                out.write(0b0, 1);
+                return;
+            }
+
+            unsigned leading        = std::countl_zero(x);
+            const unsigned trailing = std::countr_zero(x);
+            if (leading > 31) leading = 31;
+
+            if (window && leading >= prevLeading && trailing >= prevTrailing) {
+                // Meaningful bits fit in the previous window
+                out.write(0b10, 2);
+                out.write(x >> prevTrailing, 64 - prevLeading - prevTrailing);
+                return;
+            }
+
+            const unsigned length = 64 - leading - trailing;
+            out.write(0b11, 2);
+            out.write(leading, 5);
+            out.write(length - 1, 6);
+            out.write(x >> trailing, length);
+
+            window       = true;
+            prevLeading  = leading;
+            prevTrailing = trailing;
+        }
+
+        /**
+         * @brief Decode a value.
+         *
+         * @param in The bit reader.
+         * @return double The value.
+         */
+        double decode(BitReader& in) {
+            if (first) {
+                prev  = in.read(64);
+                first = false;
+                return std::bit_cast<double>(prev);
+            }
+
+            if (in.bit()) {
+                if (in.bit()) {
+                    prevLeading  = static_cast<unsigned>(in.read(5));
+                    const auto n = static_cast<unsigned>(in.read(6)) + 1;
+                    prevTrailing = 64 - prevLeading - n;
+                    window       = true;
+                }
+
+                const unsigned length = 64 - prevLeading - prevTrailing;
+                prev ^= in.read(length) << prevTrailing;
+            }
+
+            return std::bit_cast<double>(prev);
+        }
+
+    private:
+        /// @brief Set until the first value is coded.
+        bool first = true;
+        /// @brief Set once a meaningful bit window exists.
+        bool window = false;
+        /// @brief Previous value bits.
+        uint64_t prev = 0;
+        /// @brief Leading zeros of the current window.
+        unsigned prevLeading = 0;
+        /// @brief Trailing zeros of the current window.
+        unsigned prevTrailing = 0;
+    };
+};
+
+} // namespace Dae
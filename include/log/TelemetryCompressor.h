@@ -0,0 +1,230 @@
+/**
+ * @file TelemetryCompressor.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the TelemetryCompressor class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "log/Gorilla.h"
+#include "sim/PhysicsBackend.h"
+
+namespace Dae {
+
+/**
+ * @brief Streaming, lossless compressor for telemetry time series.
+ *
+ * Each telemetry field is treated as its own series, with the timestamp
+ * encoded as a delta of delta and every other field XOR encoded against its
+ * previous value (see `Gorilla`). Frames are grouped into independent blocks,
+ * each starting from raw values, so any block can be decoded on its own.
+ *
+ * A block is stored as a three word header followed by its bit stream:
+ *
+ * | Word | Contents                                         |
+ * |------|--------------------------------------------------|
+ * | 0    | Frame count (low 32 bits), payload words (high)  |
+ * | 1    | First timestamp (double bits)                    |
+ * | 2    | Last timestamp (double bits)                     |
+ *
+ * Blocks are contiguous and self describing, so the flight recorder can write
+ * them straight to a file and `decode` can read them back.
+ *
+ * Frames in the block being encoded can only be read after `flush`.
+ */
+class TelemetryCompressor {
+public:
+    using Telemetry = PhysicsBackend::Telemetry;
+
+    /// @brief Number of doubles in a telemetry frame.
+    static constexpr size_t FIELDS = sizeof(Telemetry) / sizeof(double);
+
+    /// @brief Number of header words in a block.
+    static constexpr size_t HEADER_WORDS = 3;
+
+    /// @brief Most bits a field can take to encode, the 64 raw bits of an
+    /// escaped value and its control bits.
+    static constexpr size_t MAX_FIELD_BITS = 80;
+
+    /**
+     * @brief Index entry of a closed block.
+     */
+    struct BlockInfo {
+        /// @brief Offset of the block in the word buffer.
+        size_t offset;
+        /// @brief Index of the first frame in the block.
+        size_t firstFrame;
+        /// @brief Number of frames in the block.
+        uint32_t frames;
+        /// @brief Timestamp of the first frame (s).
+        double first;
+        /// @brief Timestamp of the last frame (s).
+        double last;
+    };
+
+    /**
+     * @brief Construct a new TelemetryCompressor object.
+     *
+     * @param blockFrames Number of frames per block.
+     */
+    explicit TelemetryCompressor(uint32_t blockFrames = 1024);
+
+    TelemetryCompressor(const TelemetryCompressor& other)            = delete;
+    TelemetryCompressor& operator=(const TelemetryCompressor& other) = delete;
+
+    /**
+     * @brief Append a telemetry frame.
+     *
+     * @param telem The telemetry.
+     */
+    void append(const Telemetry& telem);
+
+    /**
+     * @brief Close the block being encoded, even if it is not full.
+     */
+    void flush(void);
+
+    /**
+     * @brief Remove every frame. The storage is kept for reuse.
+     */
+    void clear(void);
+
+    /**
+     * @brief Reserve room for a number of worst case blocks, so that
+     * appending that many blocks of frames does not allocate.
+     *
+     * @param blocks Number of blocks.
+     */
+    void reserve(size_t blocks);
+
+    /**
+     * @brief Get the number of frames appended.
+     *
+     * @return size_t Number of frames.
+     */
+    size_t frames(void) const { return frameCount; }
+
+    /**
+     * @brief Get the number of closed blocks.
+     *
+     * @return size_t Number of blocks.
+     */
+    size_t blocks(void) const { return index.size(); }
+
+    /**
+     * @brief Get the compressed size of the closed blocks.
+     *
+     * @return size_t Size (bytes).
+     */
+    size_t bytes(void) const { return closedWords * sizeof(uint64_t); }
+
+    /**
+     * @brief Get the index entry of a closed block.
+     *
+     * @param block Block index.
+     * @return const BlockInfo& The index entry.
+     */
+    const BlockInfo& block(size_t block) const { return index[block]; }
+
+    /**
+     * @brief Get the stored form of a closed block.
+     *
+     * @param block Block index.
+     * @param size Set to the block size (bytes).
+     * @return const void* The block.
+     */
+    const void* blockData(size_t block, size_t& size) const;
+
+    /**
+     * @brief Find the closed block containing a timestamp.
+     *
+     * @param timestamp The timestamp (s).
+     * @return size_t The last block starting at or before the timestamp, or
+     * `blocks()` if there is none.
+     */
+    size_t find(double timestamp) const;
+
+    /**
+     * @brief Decode a closed block.
+     *
+     * @param block Block index.
+     * @param out Decoded frames, replaced.
+     * @return bool False if the block does not exist.
+     */
+    bool decodeBlock(size_t block, std::vector<Telemetry>& out) const;
+
+    /**
+     * @brief Decode a single frame from the closed blocks. The block is
+     * cached, so reading frames in order only decodes each block once. Not
+     * thread safe.
+     *
+     * @param frame Frame index.
+     * @param out Set to the decoded frame.
+     * @return bool False if the frame is not in a closed block.
+     */
+    bool read(size_t frame, Telemetry& out) const;
+
+    /**
+     * @brief Decode a stored block.
+     *
+     * @param data The stored block, 8 byte aligned.
+     * @param size Size of the data (bytes).
+     * @param out Decoded frames, replaced.
+     * @return size_t Size of the block (bytes), 0 if it is malformed.
+     */
+    static size_t decode(const void* data, size_t size,
+                         std::vector<Telemetry>& out);
+
+private:
+    /// @brief Frames per block.
+    uint32_t blockFrames;
+
+    /// @brief Every block, closed ones followed by the one being encoded.
+    std::vector<uint64_t> words;
+
+    /// @brief Index of the closed blocks.
+    std::vector<BlockInfo> index;
+
+    /// @brief Bit writer of the block being encoded.
+    Gorilla::BitWriter writer;
+
+    /// @brief Timestamp codec of the block being encoded.
+    Gorilla::TimeCodec time;
+
+    /// @brief Field codecs of the block being encoded.
+    Gorilla::ValueCodec values[FIELDS - 1];
+
+    /// @brief Number of frames appended.
+    size_t frameCount = 0;
+
+    /// @brief Number of frames in the block being encoded.
+    uint32_t openFrames = 0;
+
+    /// @brief Number of words in closed blocks.
+    size_t closedWords = 0;
+
+    /// @brief First timestamp of the block being encoded.
+    double openFirst = 0;
+
+    /// @brief Last timestamp of the block being encoded.
+    double openLast = 0;
+
+    /// @brief Decoded copy of the last block read.
+    mutable std::vector<Telemetry> cache;
+
+    /// @brief Block index of the cache.
+    mutable size_t cacheBlock = SIZE_MAX;
+
+    /**
+     * @brief Start a new block.
+     */
+    void open(void);
+};
+
+} // namespace Dae
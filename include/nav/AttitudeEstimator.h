@@ -0,0 +1,114 @@
+/**
+ * @file AttitudeEstimator.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the AttitudeEstimator class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <string>
+
+#include "common/Configurable.h"
+#include "common/Quaternion.h"
+#include "sim/PhysicsBackend.h"
+
+namespace Dae {
+
+/**
+ * @brief Mahony complementary filter estimating the attitude from the IMU.
+ *
+ * The gyro is integrated at IMU rate, with a two sample coning correction,
+ * and the accelerometer pulls the estimate of the vertical back towards the
+ * measured specific force through a proportional and integral feedback. The
+ * integral term converges on the gyro bias. The accelerometer cannot
+ * observe the heading, so yaw is integrated from the gyro alone.
+ *
+ * The attitude rotates the body frame to the Earth frame, North East Down,
+ * as `Telemetry::quaternion` does. Updates do not allocate or branch.
+ */
+class AttitudeEstimator : public Configurable {
+public:
+    using Telemetry = PhysicsBackend::Telemetry;
+
+    /**
+     * @brief Construct a new AttitudeEstimator object, level and pointing
+     * north.
+     *
+     * @param key Configuration key.
+     */
+    explicit AttitudeEstimator(const std::string& key = "AttitudeEstimator");
+
+    /**
+     * @brief Reset the estimate, levelled to an accelerometer reading with
+     * zero yaw.
+     *
+     * @param accel Accelerometer reading, body frame (m/s^2).
+     * @param gyro Gyroscope reading, body frame (rad/s).
+     */
+    void reset(const Vector3& accel, const Vector3& gyro = Vector3::zero());
+
+    /**
+     * @brief Advance the estimate by one IMU sample.
+     *
+     * @param gyro Gyroscope reading, body frame (rad/s).
+     * @param accel Accelerometer reading, body frame (m/s^2).
+     * @param dt Time since the last sample (s).
+     */
+    void update(const Vector3& gyro, const Vector3& accel, double dt);
+
+    /**
+     * @brief Advance the estimate by one telemetry sample, timed by its
+     * timestamp. The first sample resets the estimate.
+     *
+     * @param telemetry The telemetry.
+     */
+    void update(const Telemetry& telemetry);
+
+    /**
+     * @brief Get the attitude estimate, body to Earth.
+     *
+     * @return const Quaternion& The attitude.
+     */
+    const Quaternion& attitude(void) const { return estimate; }
+
+    /**
+     * @brief Get the estimated gyro bias.
+     *
+     * @return Vector3 The bias (rad/s).
+     */
+    Vector3 bias(void) const { return -integral; }
+
+    /// @copydoc Dae::Configurable::configure
+    void configure(void) override;
+
+private:
+    // Configs
+
+    /// @brief Proportional gain on the attitude error (1/s). Config 'kp'.
+    DAE_PARAM(double, KP, "AttitudeEstimator", "kp", 1.0);
+
+    /// @brief Integral gain on the attitude error (1/s^2). Config 'ki'.
+    DAE_PARAM(double, KI, "AttitudeEstimator", "ki", 0.05);
+
+    // State
+
+    /// @brief Attitude estimate, body to Earth.
+    Quaternion estimate = Quaternion::identity();
+
+    /// @brief Integral of the attitude error, the negated gyro bias (rad/s).
+    Vector3 integral = Vector3::zero();
+
+    /// @brief Gyroscope reading of the last sample (rad/s).
+    Vector3 previous = Vector3::zero();
+
+    /// @brief Timestamp of the last telemetry (s).
+    double lastTime = 0;
+
+    /// @brief Whether telemetry has been received since construction.
+    bool started = false;
+};
+
+} // namespace Dae
@@ -0,0 +1,231 @@
+/**
+ * @file NavFilter.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the NavFilter class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <string>
+
+#include "common/Configurable.h"
+#include "common/Quaternion.h"
+#include "sim/PhysicsBackend.h"
+
+namespace Dae {
+
+/**
+ * @brief Inertial and GPS navigation filter, an error state extended Kalman
+ * filter over position, velocity, attitude and the IMU biases.
+ *
+ * The nominal state is propagated by integrating the IMU, and the filter
+ * tracks the covariance of the small error in it, with 15 states:
+ * position, velocity, attitude, gyro bias and accelerometer bias, each a
+ * 3-vector. Measurements are fused one scalar at a time, so no matrix is
+ * ever inverted, and the error is folded back into the nominal state once
+ * a fix has been fused.
+ *
+ * The transition matrix is mostly identity and zero, so the covariance is
+ * propagated by its 3 x 3 blocks, with the products of the known zero and
+ * identity blocks expanded by hand. Everything is held in fixed size
+ * members and nothing allocates.
+ *
+ * Positions and velocities are North East Down, and the attitude rotates
+ * the body frame to the Earth frame.
+ */
+class NavFilter : public Configurable {
+public:
+    using Telemetry = PhysicsBackend::Telemetry;
+
+    /// @brief Number of error states.
+    static constexpr size_t STATES = 15;
+
+    /// @brief Gravity in the Earth frame (m/s^2).
+    static constexpr Vector3 GRAVITY = {{0, 0, 9.80665}};
+
+    /// @brief Covariance of the error states.
+    using Covariance = Matrix<STATES, STATES>;
+
+    /**
+     * @brief First index of each 3-vector of error states.
+     */
+    enum State {
+        /// @brief Position error (m).
+        ST_POSITION = 0,
+        /// @brief Velocity error (m/s).
+        ST_VELOCITY = 3,
+        /// @brief Attitude error, a rotation vector in the Earth frame (rad).
+        ST_ATTITUDE = 6,
+        /// @brief Gyro bias error (rad/s).
+        ST_GYRO_BIAS = 9,
+        /// @brief Accelerometer bias error (m/s^2).
+        ST_ACCEL_BIAS = 12
+    };
+
+    /**
+     * @brief Construct a new NavFilter object.
+     *
+     * @param key Configuration key.
+     */
+    explicit NavFilter(const std::string& key = "NavFilter");
+
+    /**
+     * @brief Reset the filter to a position and velocity, levelled to an
+     * accelerometer reading with zero yaw and zero biases.
+     *
+     * @param position Position (m).
+     * @param velocity Velocity (m/s).
+     * @param accel Accelerometer reading, body frame (m/s^2).
+     */
+    void reset(const Vector3& position, const Vector3& velocity,
+               const Vector3& accel);
+
+    /**
+     * @brief Propagate the state and covariance by one IMU sample.
+     *
+     * @param gyro Gyroscope reading, body frame (rad/s).
+     * @param accel Accelerometer reading, body frame (m/s^2).
+     * @param dt Time since the last sample (s).
+     */
+    void predict(const Vector3& gyro, const Vector3& accel, double dt);
+
+    /**
+     * @brief Fuse a GPS fix.
+     *
+     * @param position Measured position (m).
+     * @param velocity Measured velocity (m/s).
+     */
+    void fuseGps(const Vector3& position, const Vector3& velocity);
+
+    /**
+     * @brief Advance the filter by one telemetry sample. The IMU fields
+     * propagate the state, and the position and velocity fields stand in
+     * for a GPS fix at the configured rate. The first sample resets the
+     * filter.
+     *
+     * @param telemetry The telemetry.
+     */
+    void update(const Telemetry& telemetry);
+
+    /// @brief Get the position estimate (m).
+    const Vector3& position(void) const { return pos; }
+
+    /// @brief Get the velocity estimate (m/s).
+    const Vector3& velocity(void) const { return vel; }
+
+    /// @brief Get the attitude estimate, body to Earth.
+    const Quaternion& attitude(void) const { return att; }
+
+    /// @brief Get the gyro bias estimate (rad/s).
+    const Vector3& gyroBias(void) const { return gyroOffset; }
+
+    /// @brief Get the accelerometer bias estimate (m/s^2).
+    const Vector3& accelBias(void) const { return accelOffset; }
+
+    /// @brief Get the covariance of the error states.
+    const Covariance& covariance(void) const { return P; }
+
+    /**
+     * @brief Get the dense transition matrix of the error states for an IMU
+     * sample. `predict` never builds it; it is the reference the block
+     * propagation is checked against. The attitude error is in the Earth
+     * frame, so the transition does not depend on the gyro.
+     *
+     * @param accel Accelerometer reading, body frame (m/s^2).
+     * @param dt Time since the last sample (s).
+     * @return Covariance The transition matrix.
+     */
+    Covariance transition(const Vector3& accel, double dt) const;
+
+    /**
+     * @brief Get the process noise added to the covariance by an IMU sample.
+     *
+     * @param dt Time since the last sample (s).
+     * @return Vector<STATES> The diagonal of the process noise.
+     */
+    Vector<STATES> processNoise(double dt) const;
+
+    /// @copydoc Dae::Configurable::configure
+    void configure(void) override;
+
+private:
+    // Configs
+
+    /// @brief Gyro noise density (rad/s/sqrt(Hz)). Config 'gyro_noise'.
+    DAE_PARAM(double, GYRO_NOISE, "NavFilter", "gyro_noise", 0.005);
+
+    /// @brief Accelerometer noise density (m/s^2/sqrt(Hz)). Config
+    /// 'accel_noise'.
+    DAE_PARAM(double, ACCEL_NOISE, "NavFilter", "accel_noise", 0.05);
+
+    /// @brief Gyro bias random walk (rad/s^2/sqrt(Hz)). Config
+    /// 'gyro_bias_noise'.
+    DAE_PARAM(double, GYRO_BIAS_NOISE, "NavFilter", "gyro_bias_noise", 1e-4);
+
+    /// @brief Accelerometer bias random walk (m/s^3/sqrt(Hz)). Config
+    /// 'accel_bias_noise'.
+    DAE_PARAM(double, ACCEL_BIAS_NOISE, "NavFilter", "accel_bias_noise",
+              1e-3);
+
+    /// @brief GPS position standard deviation (m). Config 'gps_position'.
+    DAE_PARAM(double, GPS_POSITION, "NavFilter", "gps_position", 0.5);
+
+    /// @brief GPS velocity standard deviation (m/s). Config 'gps_velocity'.
+    DAE_PARAM(double, GPS_VELOCITY, "NavFilter", "gps_velocity", 0.1);
+
+    /// @brief Period between simulated GPS fixes (s). Config 'gps_period'.
+    DAE_PARAM(double, GPS_PERIOD, "NavFilter", "gps_period", 0.1);
+
+    // State
+
+    /// @brief Position estimate (m).
+    Vector3 pos = Vector3::zero();
+
+    /// @brief Velocity estimate (m/s).
+    Vector3 vel = Vector3::zero();
+
+    /// @brief Attitude estimate, body to Earth.
+    Quaternion att = Quaternion::identity();
+
+    /// @brief Gyro bias estimate (rad/s).
+    Vector3 gyroOffset = Vector3::zero();
+
+    /// @brief Accelerometer bias estimate (m/s^2).
+    Vector3 accelOffset = Vector3::zero();
+
+    /// @brief Covariance of the error states.
+    Covariance P = Covariance::zero();
+
+    /// @brief Timestamp of the last telemetry (s).
+    double lastTime = 0;
+
+    /// @brief Timestamp of the last simulated GPS fix (s).
+    double lastFix = 0;
+
+    /// @brief Whether telemetry has been received since construction.
+    bool started = false;
+
+    /**
+     * @brief Fuse a measurement of one error state, updating the error
+     * estimate and the covariance.
+     *
+     * @param state Index of the measured state.
+     * @param innovation Measurement less the predicted value.
+     * @param variance Variance of the measurement.
+     * @param error The error estimate.
+     */
+    void fuseScalar(size_t state, double innovation, double variance,
+                    Vector<STATES>& error);
+
+    /**
+     * @brief Fold an error estimate into the nominal state.
+     *
+     * @param error The error estimate.
+     */
+    void inject(const Vector<STATES>& error);
+};
+
+} // namespace Dae
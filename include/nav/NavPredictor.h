@@ -0,0 +1,215 @@
+/**
+ * @file NavPredictor.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the NavPredictor class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <string>
+
+#include "common/Configurable.h"
+#include "common/RingBuffer.h"
+#include "nav/NavFilter.h"
+
+namespace Dae {
+
+/**
+ * @brief Runs the navigation filter on a delayed fusion horizon, and
+ * predicts its state forward to the present for the controller.
+ *
+ * IMU samples are buffered, and the filter only integrates a sample once
+ * it is older than the configured delay. A late measurement is fused once
+ * the filter reaches its timestamp, so it meets the state it describes. The
+ * delay must cover the latest a measurement can arrive.
+ *
+ * The output predictor integrates every IMU sample as it arrives, with the
+ * filter's bias estimates, and keeps its state alongside each buffered
+ * sample. When the filter integrates a sample, the difference between the
+ * filter state and the output state at that time is fed back into the
+ * output, through a complementary filter with the configured time
+ * constant. The output therefore has the latency of the IMU and the
+ * accuracy of the filter, and the filter is never run twice.
+ */
+class NavPredictor : public Configurable {
+public:
+    using Telemetry = PhysicsBackend::Telemetry;
+
+    /// @brief Number of IMU samples held, more than the delay spans.
+    static constexpr size_t IMU_BUFFER = 256;
+
+    /// @brief Number of measurements held while waiting to be fused.
+    static constexpr size_t GPS_BUFFER = 16;
+
+    /**
+     * @brief Construct a new NavPredictor object.
+     *
+     * @param key Configuration key.
+     * @param filterKey Configuration key of the filter.
+     */
+    explicit NavPredictor(const std::string& key       = "NavPredictor",
+                          const std::string& filterKey = "NavFilter");
+
+    /**
+     * @brief Reset the filter and the output to a position and velocity,
+     * levelled to an accelerometer reading, and drop everything buffered.
+     *
+     * @param timestamp Time of the state (s).
+     * @param position Position (m).
+     * @param velocity Velocity (m/s).
+     * @param accel Accelerometer reading, body frame (m/s^2).
+     */
+    void reset(double timestamp, const Vector3& position,
+               const Vector3& velocity, const Vector3& accel);
+
+    /**
+     * @brief Add an IMU sample, predicting the output to it and advancing the
+     * filter to the delayed horizon.
+     *
+     * @param timestamp Time of the sample (s).
+     * @param gyro Gyroscope reading, body frame (rad/s).
+     * @param accel Accelerometer reading, body frame (m/s^2).
+     */
+    void pushImu(double timestamp, const Vector3& gyro, const Vector3& accel);
+
+    /**
+     * @brief Add a GPS fix, to be fused when the filter reaches its time.
+     *
+     * @param timestamp Time the fix was measured (s).
+     * @param position Measured position (m).
+     * @param velocity Measured velocity (m/s).
+     * @return bool False if the fix is already behind the fusion horizon.
+     */
+    bool pushGps(double timestamp, const Vector3& position,
+                 const Vector3& velocity);
+
+    /**
+     * @brief Advance by one telemetry sample. The IMU fields are pushed, and
+     * the position and velocity fields stand in for a GPS fix at the
+     * configured rate, stamped with the telemetry time. The first sample
+     * resets the predictor.
+     *
+     * @param telemetry The telemetry.
+     */
+    void update(const Telemetry& telemetry);
+
+    /// @brief Get the predicted position now (m).
+    const Vector3& position(void) const { return output.position; }
+
+    /// @brief Get the predicted velocity now (m/s).
+    const Vector3& velocity(void) const { return output.velocity; }
+
+    /// @brief Get the predicted attitude now, body to Earth.
+    const Quaternion& attitude(void) const { return output.attitude; }
+
+    /// @brief Get the filter, on the delayed horizon.
+    const NavFilter& delayed(void) const { return filter; }
+
+    /// @brief Get the time of the delayed horizon (s).
+    double horizon(void) const { return filterTime; }
+
+    /// @copydoc Dae::Configurable::configure
+    void configure(void) override;
+
+private:
+    /**
+     * @brief State of the output predictor.
+     */
+    struct Output {
+        /// @brief Position (m).
+        Vector3 position;
+        /// @brief Velocity (m/s).
+        Vector3 velocity;
+        /// @brief Attitude, body to Earth.
+        Quaternion attitude;
+    };
+
+    /**
+     * @brief A buffered IMU sample, with the output state after it.
+     */
+    struct Sample {
+        /// @brief Time of the sample (s).
+        double timestamp;
+        /// @brief Time since the previous sample (s).
+        double dt;
+        /// @brief Gyroscope reading (rad/s).
+        Vector3 gyro;
+        /// @brief Accelerometer reading (m/s^2).
+        Vector3 accel;
+        /// @brief Output state after the sample.
+        Output output;
+    };
+
+    /**
+     * @brief A buffered GPS fix.
+     */
+    struct Fix {
+        /// @brief Time the fix was measured (s).
+        double timestamp;
+        /// @brief Measured position (m).
+        Vector3 position;
+        /// @brief Measured velocity (m/s).
+        Vector3 velocity;
+    };
+
+    // Configs
+
+    /// @brief Delay of the fusion horizon behind the newest sample (s).
+    /// Config 'delay'.
+    DAE_PARAM(double, DELAY, "NavPredictor", "delay", 0.15);
+
+    /// @brief Time constant of the output correction (s). Config
+    /// 'time_constant'.
+    DAE_PARAM(double, TIME_CONSTANT, "NavPredictor", "time_constant", 0.2);
+
+    /// @brief Period between simulated GPS fixes (s). Config 'gps_period'.
+    DAE_PARAM(double, GPS_PERIOD, "NavPredictor", "gps_period", 0.1);
+
+    // State
+
+    /// @brief The filter, on the delayed horizon.
+    NavFilter filter;
+
+    /// @brief Samples the filter has not yet integrated, oldest first.
+    RingBuffer<Sample, IMU_BUFFER> samples;
+
+    /// @brief Fixes the filter has not yet fused, oldest first.
+    RingBuffer<Fix, GPS_BUFFER> fixes;
+
+    /// @brief Output state now.
+    Output output{};
+
+    /// @brief Time of the newest sample (s).
+    double newest = 0;
+
+    /// @brief Time of the filter state (s).
+    double filterTime = 0;
+
+    /// @brief Time of the last simulated GPS fix (s).
+    double lastFix = 0;
+
+    /// @brief Whether the predictor has been reset.
+    bool started = false;
+
+    /**
+     * @brief Integrate the oldest buffered sample into the filter, fuse the
+     * fixes it reaches, and correct the output.
+     */
+    void advance(void);
+
+    /**
+     * @brief Integrate an IMU sample into an output state.
+     *
+     * @param state The output state.
+     * @param gyro Gyroscope reading (rad/s).
+     * @param accel Accelerometer reading (m/s^2).
+     * @param dt Time step (s).
+     */
+    void integrate(Output& state, const Vector3& gyro, const Vector3& accel,
+                   double dt) const;
+};
+
+} // namespace Dae
@@ -123,11 +123,11 @@ private:
 
     /// @brief Timeout to wait for telemetry to be received (s). Config
     /// 'telem_timeout'
-    double TELEM_TIMEOUT = 10;
+    DAE_PARAM(double, TELEM_TIMEOUT, "JSONBackend", "telem_timeout", 10);
 
     /// @brief Timeout to wait between trying to receive from the server (s).
     /// Config 'receive_timeout'.
-    double RECEIVE_TIMEOUT = 0.01;
+    DAE_PARAM(double, RECEIVE_TIMEOUT, "JSONBackend", "receive_timeout", 0.01);
 
     /// @brief Port that the UDP server is hosted on. Config 'port'.
     uint16_t SERVER_PORT = 9002;
@@ -140,6 +140,9 @@ private:
     /// @brief Size of the input buffer for telemetry.
     static constexpr int BUFFER_SIZE = 1 << 10;
 
+    /// @brief Rate limit period of repeated per-frame warnings (ms).
+    static constexpr int LOG_PERIOD = 1000;
+
     // State
 
     /// @brief Socket file descriptor for UDP server.
@@ -0,0 +1,148 @@
+/**
+ * @file TelemetryHistory.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Definition of the TelemetryHistory class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "sim/PhysicsBackend.h"
+
+namespace Dae {
+
+/**
+ * @brief Fixed capacity ring of the most recent telemetry, indexed by time.
+ *
+ * One thread pushes samples in timestamp order, and any thread may read.
+ * Every slot is on its own cache lines and guarded by a sequence number
+ * that records which sample it holds, so reads take no lock and a read
+ * that races an overwrite is detected and retried.
+ *
+ * Lookups by time are a binary search over the ring, and interpolate
+ * between the two samples either side: vectors linearly, and the attitude
+ * by spherical linear interpolation.
+ */
+class TelemetryHistory {
+public:
+    using Telemetry = PhysicsBackend::Telemetry;
+
+    /**
+     * @brief Construct a new TelemetryHistory object.
+     *
+     * @param capacity Number of samples kept, rounded up to a power of two.
+     */
+    explicit TelemetryHistory(size_t capacity = 256);
+
+    TelemetryHistory(const TelemetryHistory& other)            = delete;
+    TelemetryHistory& operator=(const TelemetryHistory& other) = delete;
+
+    /**
+     * @brief Add a sample, called by the writer only. The oldest sample is
+     * dropped once the history is full.
+     *
+     * @param sample The sample.
+     * @return bool False if the sample is older than the newest one.
+     */
+    bool push(const Telemetry& sample);
+
+    /**
+     * @brief Copy the newest sample.
+     *
+     * @param out Set to the sample on success.
+     * @return bool False if the history is empty.
+     */
+    bool latest(Telemetry& out) const;
+
+    /**
+     * @brief Get the interpolated state at a time.
+     *
+     * @param timestamp Physics timestamp (s).
+     * @param out Set to the state on success.
+     * @return bool False if the time is outside the history.
+     */
+    bool at(double timestamp, Telemetry& out) const;
+
+    /**
+     * @brief Copy the newest samples, oldest first. Samples overwritten
+     * while copying are left out.
+     *
+     * @param out Set to the samples.
+     * @param count Maximum number of samples, 0 for all of them.
+     * @return size_t The number of samples copied.
+     */
+    size_t snapshot(std::vector<Telemetry>& out, size_t count = 0) const;
+
+    /**
+     * @brief Get the number of samples held.
+     *
+     * @return size_t The number of samples.
+     */
+    size_t size(void) const;
+
+    /**
+     * @brief Get the capacity of the history.
+     *
+     * @return size_t The capacity.
+     */
+    size_t capacity(void) const { return slots.size(); }
+
+    /**
+     * @brief Interpolate between two samples.
+     *
+     * @param a The sample before.
+     * @param b The sample after.
+     * @param timestamp Physics timestamp between the two (s).
+     * @param out Set to the interpolated state.
+     */
+    static void interpolate(const Telemetry& a, const Telemetry& b,
+                            double timestamp, Telemetry& out);
+
+private:
+    /**
+     * @brief A sample, aligned so neighbours never share a cache line.
+     */
+    struct alignas(64) Slot {
+        /// @brief 2 * (index + 1) of the sample held, odd while writing.
+        std::atomic<uint64_t> sequence{0};
+        /// @brief The sample.
+        Telemetry sample{};
+    };
+
+    /// @brief Sample storage.
+    std::vector<Slot> slots;
+
+    /// @brief Number of samples ever pushed, on its own cache line.
+    alignas(64) std::atomic<uint64_t> head{0};
+
+    /// @brief Timestamp of the newest sample, used by the writer only.
+    double newest = 0;
+
+    /**
+     * @brief Copy a sample, checking that it was not overwritten.
+     *
+     * @param index Index of the sample.
+     * @param out Set to the sample.
+     * @return bool False if the slot no longer holds the sample.
+     */
+    bool read(uint64_t index, Telemetry& out) const;
+
+    /**
+     * @brief Read the timestamp of a sample, checking that it was not
+     * overwritten.
+     *
+     * @param index Index of the sample.
+     * @param out Set to the timestamp.
+     * @return bool False if the slot no longer holds the sample.
+     */
+    bool stamp(uint64_t index, double& out) const;
+};
+
+} // namespace Dae
@@ -0,0 +1,308 @@
+/**
+ * @file ConfigSnapshot.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the ConfigSnapshot class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "common/ConfigSnapshot.h"
+#include "common/Logging.h"
+
+using namespace Dae;
+using json = nlohmann::json;
+
+/// @brief Expected snapshot magic.
+static constexpr char MAGIC[8] = {'D', 'A', 'E', 'C', 'F', 'G', '\0', '\0'};
+
+/**
+ * @brief Round a size up to 8 bytes.
+ */
+static size_t align8(size_t size) { return (size + 7) & ~size_t{7}; }
+
+/**
+ * @brief Hash an "<object>.<key>" name without building it.
+ */
+static uint64_t hashName(std::string_view object, std::string_view key) {
+    uint64_t hash = ConfigSnapshot::hash(object.data(), object.size());
+    if (!object.empty()) hash = ConfigSnapshot::hash(".", 1, hash);
+    return ConfigSnapshot::hash(key.data(), key.size(), hash);
+}
+
+ConfigSnapshot::~ConfigSnapshot() { close(); }
+
+int ConfigSnapshot::open(const std::string& filepath, uint64_t checksum) {
+    close();
+
+    int fd = ::open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return ST_FOPEN_FAIL;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 ||
+        static_cast<size_t>(info.st_size) < sizeof(Header)) {
+        ::close(fd);
+        return ST_BAD_FORMAT;
+    }
+
+    const size_t size = static_cast<size_t>(info.st_size);
+    void*        map  = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        stl_warn(errno, "Failed to map configuration snapshot '%s'",
+                 filepath.c_str());
+        return ST_MMAP_FAIL;
+    }
+
+    header = static_cast<const Header*>(map);
+    mapped = size;
+
+    if (memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        header->version != VERSION || header->size != size) {
+        close();
+        return ST_BAD_FORMAT;
+    }
+    if (header->checksum != checksum) {
+        close();
+        return ST_STALE;
+    }
+
+    // Check every offset once, so lookups can trust them
+    const size_t slotCount  = header->slots;
+    const size_t entryCount = header->entries;
+    const size_t index      = sizeof(Header);
+    const size_t entryStart = index + align8(slotCount * sizeof(uint32_t));
+    const size_t stringBase = entryStart + entryCount * sizeof(Entry);
+    if (slotCount == 0 || (slotCount & (slotCount - 1)) != 0 ||
+        entryCount >= slotCount || stringBase > size) {
+        close();
+        return ST_BAD_FORMAT;
+    }
+
+    const auto* base = static_cast<const uint8_t*>(map);
+    slots            = reinterpret_cast<const uint32_t*>(base + index);
+    entries          = reinterpret_cast<const Entry*>(base + entryStart);
+    strings          = reinterpret_cast<const char*>(base + stringBase);
+    stringsSize      = size - stringBase;
+
+    for (size_t i = 0; i < slotCount; i++) {
+        if (slots[i] != EMPTY && slots[i] >= entryCount) {
+            close();
+            return ST_BAD_FORMAT;
+        }
+    }
+    for (size_t i = 0; i < entryCount; i++) {
+        const Entry& entry = entries[i];
+        if (size_t{entry.name} + entry.nameLength > stringsSize ||
+            size_t{entry.string} + entry.stringLength > stringsSize ||
+            entry.type > TY_STRING) {
+            close();
+            return ST_BAD_FORMAT;
+        }
+    }
+
+    return ST_GOOD;
+}
+
+void ConfigSnapshot::close(void) {
+    if (header != nullptr) {
+        munmap(const_cast<Header*>(header), mapped);
+    }
+
+    header      = nullptr;
+    slots       = nullptr;
+    entries     = nullptr;
+    strings     = nullptr;
+    stringsSize = 0;
+    mapped      = 0;
+}
+
+const ConfigSnapshot::Entry* ConfigSnapshot::find(std::string_view object,
+                                                  std::string_view key) const {
+    if (header == nullptr) return nullptr;
+
+    const uint64_t hash   = hashName(object, key);
+    const size_t   length = object.empty() ? key.size()
+                                           : object.size() + 1 + key.size();
+    const size_t   mask   = header->slots - 1;
+
+    // Linear probing, the index is never full
+    for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+        if (slots[slot] == EMPTY) return nullptr;
+
+        const Entry& entry = entries[slots[slot]];
+        if (entry.hash != hash || entry.nameLength != length) continue;
+
+        const char* name = strings + entry.name;
+        if (object.empty()) {
+            if (key.compare(0, key.size(), name, length) == 0) return &entry;
+            continue;
+        }
+        if (object.compare(0, object.size(), name, object.size()) == 0 &&
+            name[object.size()] == '.' &&
+            key.compare(0, key.size(), name + object.size() + 1,
+                        key.size()) == 0) {
+            return &entry;
+        }
+    }
+}
+
+bool ConfigSnapshot::number(std::string_view object, std::string_view key,
+                            double& value) const {
+    const Entry* entry = find(object, key);
+    if (entry == nullptr) return false;
+    if (entry->type != TY_NUMBER && entry->type != TY_BOOL) return false;
+
+    value = entry->number;
+    return true;
+}
+
+bool ConfigSnapshot::string(std::string_view object, std::string_view key,
+                            std::string& value) const {
+    const Entry* entry = find(object, key);
+    if (entry == nullptr || entry->type != TY_STRING) return false;
+
+    value.assign(strings + entry->string, entry->stringLength);
+    return true;
+}
+
+std::vector<std::string> ConfigSnapshot::keys(std::string_view object) const {
+    std::vector<std::string> out;
+    if (header == nullptr) return out;
+
+    for (size_t i = 0; i < header->entries; i++) {
+        const std::string_view name(strings + entries[i].name,
+                                    entries[i].nameLength);
+        if (name.size() > object.size() && name[object.size()] == '.' &&
+            name.compare(0, object.size(), object) == 0) {
+            out.emplace_back(name.substr(object.size() + 1));
+        }
+    }
+    return out;
+}
+
+int ConfigSnapshot::build(const json& config, uint64_t checksum,
+                          const std::string& filepath) {
+    std::vector<Entry> list;
+    std::string        text;
+
+    auto add = [&](const std::string& name, const json& value) {
+        Entry entry      = {};
+        entry.hash       = hash(name.data(), name.size());
+        entry.name       = static_cast<uint32_t>(text.size());
+        entry.nameLength = static_cast<uint32_t>(name.size());
+        text += name;
+
+        if (value.is_null()) {
+            entry.type = TY_NULL;
+        } else if (value.is_boolean()) {
+            entry.type   = TY_BOOL;
+            entry.number = value.get<bool>() ? 1.0 : 0.0;
+        } else if (value.is_number()) {
+            entry.type   = TY_NUMBER;
+            entry.number = value.get<double>();
+        } else if (value.is_string()) {
+            const std::string& str = value.get_ref<const std::string&>();
+            entry.type             = TY_STRING;
+            entry.string           = static_cast<uint32_t>(text.size());
+            entry.stringLength     = static_cast<uint32_t>(str.size());
+            text += str;
+        } else {
+            // Nested arrays and objects are not stored
+            text.resize(entry.name);
+            return;
+        }
+        list.push_back(entry);
+    };
+
+    if (!config.is_object()) {
+        warn("Configuration root is not an object");
+        return ST_BAD_FORMAT;
+    }
+    for (auto it = config.begin(); it != config.end(); ++it) {
+        if (!it->is_object()) {
+            add(it.key(), *it);
+            continue;
+        }
+        for (auto field = it->begin(); field != it->end(); ++field) {
+            add(it.key() + "." + field.key(), *field);
+        }
+    }
+
+    if (text.size() > UINT32_MAX || list.size() >= EMPTY / 2) {
+        warn("Configuration is too large for a snapshot");
+        return ST_BAD_FORMAT;
+    }
+
+    // At most half full, so probe sequences stay short
+    uint32_t slotCount = 8;
+    while (slotCount < list.size() * 2) {
+        slotCount *= 2;
+    }
+
+    std::vector<uint32_t> index(slotCount, EMPTY);
+    for (size_t i = 0; i < list.size(); i++) {
+        size_t slot = list[i].hash & (slotCount - 1);
+        while (index[slot] != EMPTY) {
+            slot = (slot + 1) & (slotCount - 1);
+        }
+        index[slot] = static_cast<uint32_t>(i);
+    }
+
+    const size_t indexSize = align8(slotCount * sizeof(uint32_t));
+    const size_t entrySize = list.size() * sizeof(Entry);
+
+    Header head = {};
+    memcpy(head.magic, MAGIC, sizeof(MAGIC));
+    head.version  = VERSION;
+    head.entries  = static_cast<uint32_t>(list.size());
+    head.checksum = checksum;
+    head.slots    = slotCount;
+    head.size     = sizeof(Header) + indexSize + entrySize + text.size();
+
+    std::vector<uint8_t> out(head.size, 0);
+    uint8_t*             ptr = out.data();
+    memcpy(ptr, &head, sizeof(head));
+    ptr += sizeof(head);
+    memcpy(ptr, index.data(), index.size() * sizeof(uint32_t));
+    ptr += indexSize;
+    memcpy(ptr, list.data(), entrySize);
+    ptr += entrySize;
+    memcpy(ptr, text.data(), text.size());
+
+    FILE* file = fopen(filepath.c_str(), "wb");
+    if (file == nullptr) {
+        stl_warn(errno, "Failed to open '%s'", filepath.c_str());
+        return ST_FOPEN_FAIL;
+    }
+
+    const bool written = fwrite(out.data(), 1, out.size(), file) == out.size();
+    if (fclose(file) != 0 || !written) {
+        warn("Failed to write configuration snapshot '%s'", filepath.c_str());
+        return ST_WRITE_FAIL;
+    }
+
+    return ST_GOOD;
+}
+
+int ConfigSnapshot::checksum(const std::string& filepath, uint64_t& checksum) {
+    FILE* file = fopen(filepath.c_str(), "rb");
+    if (file == nullptr) return ST_FOPEN_FAIL;
+
+    uint8_t buffer[1 << 16];
+    size_t  n;
+    checksum = hash(nullptr, 0);
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        checksum = hash(buffer, n, checksum);
+    }
+
+    fclose(file);
+    return ST_GOOD;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file ConfigStore.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the ConfigStore class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "common/ConfigStore.h"
+#include "common/Logging.h"
+
+using namespace Dae;
+
+namespace {
+
+/**
+ * @brief A reader slot, on its own cache line so readers do not contend.
+ */
+struct alignas(64) Slot {
+    /// @brief Epoch the reader entered in, 0 when it is not reading.
+    std::atomic<uint64_t> epoch{0};
+
+    /// @brief Set while a thread owns the slot.
+    std::atomic<bool> claimed{false};
+};
+
+/**
+ * @brief The published version, the reader slots and the retired versions.
+ */
+struct Store {
+    /// @brief Publishing lock, also held by readers without a slot.
+    std::mutex mutex;
+
+    /// @brief The current version.
+    std::atomic<const ConfigStore::Version*> version{
+        new ConfigStore::Version()};
+
+    /// @brief Global epoch, advanced on every publish.
+    std::atomic<uint64_t> epoch{1};
+
+    /// @brief Reader slots.
+    Slot slots[ConfigStore::MAX_READERS];
+
+    /// @brief Replaced versions, and the epoch they were replaced in.
+    std::vector<std::pair<uint64_t, const ConfigStore::Version*>> retired;
+};
+
+/**
+ * @brief Get the store, created on first use.
+ *
+ * @return Store& The store.
+ */
+Store& store() {
+    static Store instance;
+    return instance;
+}
+
+/**
+ * @brief The reader state of a thread.
+ */
+struct Local {
+    /// @brief Claimed slot, or -1 if the thread has none.
+    int slot = -1;
+
+    /// @brief Number of nested readers.
+    unsigned depth = 0;
+
+    ~Local() {
+        if (slot >= 0) {
+            store().slots[slot].claimed.store(false, std::memory_order_release);
+        }
+    }
+};
+
+thread_local Local local;
+
+/**
+ * @brief Claim a free reader slot.
+ *
+ * @return int The slot, or -1 if they are all claimed.
+ */
+int claim(Store& s) {
+    for (size_t i = 0; i < ConfigStore::MAX_READERS; i++) {
+        bool free = false;
+        if (s.slots[i].claimed.compare_exchange_strong(
+                free, true, std::memory_order_acquire)) {
+            return static_cast<int>(i);
+        }
+    }
+
+    warn_once("Configuration reader slots are full, reading under a lock");
+    return -1;
+}
+
+} // namespace
+
+ConfigStore::Reader::Reader() : locked(false) {
+    Store& s = store();
+
+    // Only the outermost reader announces itself
+    if (local.depth == 0) {
+        if (local.slot < 0) local.slot = claim(s);
+
+        if (local.slot >= 0) {
+            s.slots[local.slot].epoch.store(s.epoch.load());
+        } else {
+            s.mutex.lock();
+            locked = true;
+        }
+    }
+    local.depth++;
+
+    version = s.version.load();
+}
+
+ConfigStore::Reader::~Reader() {
+    Store& s = store();
+
+    if (--local.depth > 0) return;
+    if (locked) {
+        s.mutex.unlock();
+    } else {
+        s.slots[local.slot].epoch.store(0, std::memory_order_release);
+    }
+}
+
+uint64_t ConfigStore::publish(std::unique_ptr<Version> version) {
+    Store&                      s = store();
+    std::lock_guard<std::mutex> lock(s.mutex);
+
+    const uint64_t number = s.version.load()->number + 1;
+    version->number       = number;
+
+    // Readers that enter after the epoch advances can only see the new one
+    const Version* old = s.version.exchange(version.release());
+    s.retired.emplace_back(s.epoch.fetch_add(1), old);
+
+    uint64_t oldest = UINT64_MAX;
+    for (const Slot& slot : s.slots) {
+        const uint64_t epoch = slot.epoch.load();
+        if (epoch != 0 && epoch < oldest) oldest = epoch;
+    }
+
+    // Free every version that no active reader entered early enough to see
+    size_t kept = 0;
+    for (auto& [epoch, retired] : s.retired) {
+        if (epoch < oldest) {
+            delete retired;
+        } else {
+            s.retired[kept++] = {epoch, retired};
+        }
+    }
+    s.retired.resize(kept);
+
+    return number;
+}
+
+uint64_t ConfigStore::current(void) {
+    Reader reader;
+    return reader->number;
+}
+
+size_t ConfigStore::retired(void) {
+    Store&                      s = store();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    return s.retired.size();
+}
@@ -0,0 +1,247 @@
+/**
+ * @file ConfigWatcher.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the ConfigWatcher class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <set>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include "common/ConfigWatcher.h"
+#include "common/Logging.h"
+
+using namespace Dae;
+using json = nlohmann::json;
+
+namespace {
+
+/**
+ * @brief Get an object section of a configuration, or an empty object.
+ */
+const json& section(const json& root, const std::string& key) {
+    static const json empty = json::object();
+
+    if (!root.is_object()) return empty;
+    auto it = root.find(key);
+    return it != root.end() && it->is_object() ? *it : empty;
+}
+
+/**
+ * @brief Find every key that was added, removed or changed, by object key.
+ */
+std::map<std::string, std::vector<std::string>> diff(const json& previous,
+                                                     const json& next) {
+    std::set<std::string> objects;
+    for (const json* root : {&previous, &next}) {
+        if (!root->is_object()) continue;
+        for (auto it = root->begin(); it != root->end(); ++it) {
+            if (it->is_object()) objects.insert(it.key());
+        }
+    }
+
+    std::map<std::string, std::vector<std::string>> changed;
+    for (const std::string& object : objects) {
+        const json& before = section(previous, object);
+        const json& after  = section(next, object);
+
+        std::set<std::string> keys;
+        for (auto it = before.begin(); it != before.end(); ++it) {
+            keys.insert(it.key());
+        }
+        for (auto it = after.begin(); it != after.end(); ++it) {
+            keys.insert(it.key());
+        }
+
+        for (const std::string& key : keys) {
+            auto a = before.find(key);
+            auto b = after.find(key);
+            if (a == before.end() || b == after.end() || *a != *b) {
+                changed[object].push_back(key);
+            }
+        }
+    }
+
+    return changed;
+}
+
+} // namespace
+
+ConfigWatcher::ConfigWatcher(const std::string& filepath, double period)
+    : filepath(filepath), period(period) {}
+
+ConfigWatcher::~ConfigWatcher() { stop(); }
+
+int ConfigWatcher::start(void) {
+    stop();
+
+    const int status = parse(current);
+    if (status != ST_GOOD) return status;
+
+    int fd = -1;
+#ifdef __linux__
+    // Watch the directory, editors often replace the file rather than write it
+    const std::filesystem::path dir =
+        std::filesystem::path(filepath).parent_path();
+
+    fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0 ||
+        inotify_add_watch(fd, dir.empty() ? "." : dir.c_str(),
+                          IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0) {
+        stl_warn(errno, "Failed to watch '%s', polling it instead",
+                 filepath.c_str());
+        if (fd >= 0) close(fd);
+        fd = -1;
+    }
+#endif
+
+    running.store(true, std::memory_order_relaxed);
+    watcher = std::thread(&ConfigWatcher::run, this, fd);
+    return ST_GOOD;
+}
+
+void ConfigWatcher::stop(void) {
+    if (!watcher.joinable()) return;
+
+    running.store(false, std::memory_order_relaxed);
+    watcher.join();
+
+    delete pending.exchange(nullptr, std::memory_order_acquire);
+    freeRetired();
+}
+
+bool ConfigWatcher::poll(void) {
+    Configurable::Reload* update =
+        pending.exchange(nullptr, std::memory_order_acquire);
+    if (update == nullptr) return false;
+
+    Configurable::reload(*update);
+    reloadCount.fetch_add(1, std::memory_order_relaxed);
+
+    // Freed by the watcher, which keeps up with one update per check
+    if (!retired.push(update)) {
+        warn_once("Configuration watcher is not freeing updates");
+        delete update;
+    }
+    return true;
+}
+
+void ConfigWatcher::run(int fd) {
+    const auto interval = std::chrono::duration<double>(period);
+
+    std::error_code ec;
+    auto modified = std::filesystem::last_write_time(filepath, ec);
+
+    while (running.load(std::memory_order_relaxed)) {
+        freeRetired();
+
+#ifdef __linux__
+        if (fd >= 0) {
+            pollfd events = {fd, POLLIN, 0};
+            if (::poll(&events, 1, static_cast<int>(period * 1000)) <= 0) {
+                continue;
+            }
+
+            // Drain every event, looking for the configuration file
+            const std::string name =
+                std::filesystem::path(filepath).filename().string();
+            alignas(inotify_event) char buffer[4096];
+            bool                        changed = false;
+
+            ssize_t n;
+            while ((n = read(fd, buffer, sizeof(buffer))) > 0) {
+                for (char* ptr = buffer; ptr < buffer + n;) {
+                    const auto* event = reinterpret_cast<inotify_event*>(ptr);
+                    if (event->len > 0 && name == event->name) changed = true;
+                    ptr += sizeof(inotify_event) + event->len;
+                }
+            }
+
+            if (changed) check();
+            continue;
+        }
+#endif
+
+        std::this_thread::sleep_for(interval);
+
+        const auto now = std::filesystem::last_write_time(filepath, ec);
+        if (!ec && now != modified) {
+            modified = now;
+            check();
+        }
+    }
+
+#ifdef __linux__
+    if (fd >= 0) close(fd);
+#endif
+}
+
+void ConfigWatcher::check(void) {
+    json next;
+    if (parse(next) != ST_GOOD) return;
+
+    auto changed = diff(current, next);
+    if (changed.empty()) return;
+
+    auto* update    = new Configurable::Reload();
+    update->config  = next;
+    update->changed = std::move(changed);
+    current         = std::move(next);
+
+    // Fold in an update that has not been applied yet
+    Configurable::Reload* old =
+        pending.exchange(nullptr, std::memory_order_acquire);
+    if (old != nullptr) {
+        for (const auto& [object, keys] : old->changed) {
+            std::vector<std::string>& merged = update->changed[object];
+            for (const std::string& key : keys) {
+                if (std::find(merged.begin(), merged.end(), key) ==
+                    merged.end()) {
+                    merged.push_back(key);
+                }
+            }
+        }
+        delete old;
+    }
+
+    // Published whole, poll only has to apply it
+    Configurable::prepare(*update);
+    pending.store(update, std::memory_order_release);
+    info("Configuration file '%s' changed", filepath.c_str());
+}
+
+void ConfigWatcher::freeRetired(void) {
+    Configurable::Reload* update;
+    while (retired.pop(update)) {
+        delete update;
+    }
+}
+
+int ConfigWatcher::parse(json& out) const {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        stl_warn(errno, "Failed to open configuration file at '%s'",
+                 filepath.c_str());
+        return ST_FOPEN_FAIL;
+    }
+
+    // Parse configurations without throwing
+    out = json::parse(file, nullptr, false, true, true);
+    if (out.is_discarded()) {
+        warn("Failed to parse JSON in file '%s'", filepath.c_str());
+        return ST_PARSE_FAIL;
+    }
+
+    return ST_GOOD;
+}
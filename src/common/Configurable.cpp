@@ -7,22 +7,155 @@
  *
  * Copyright (c) Riley Horrix 2025
  */
+#include <algorithm>
 #include <iostream>
 #include <fstream>
+#include <memory>
+#include <mutex>
 
 #include "common/Logging.h"
 #include "common/Configurable.h"
 
 using namespace Dae;
 
-Configurable::json Configurable::global;
+namespace {
+
+/**
+ * @brief Every live Configurable object, so reloads can reach them.
+ */
+struct Instances {
+    /// @brief Guards the list.
+    std::mutex mutex;
+
+    /// @brief The live objects.
+    std::vector<Configurable*> list;
+
+    /// @brief Prepared reloads, whose targets are cleared as they die.
+    std::vector<Configurable::Reload*> prepared;
+};
+
+/**
+ * @brief Get the live object list, created on first use.
+ *
+ * @return Instances& The live object list.
+ */
+Instances& instances() {
+    static Instances instance;
+    return instance;
+}
+
+/**
+ * @brief Read a number from a configuration version. Booleans read as 0 or 1.
+ *
+ * @return bool False if the key is not a number or boolean.
+ */
+bool number(const ConfigStore::Version& version, const std::string& object,
+            const std::string& key, double& value) {
+    if (version.snapshot.isOpen()) {
+        return version.snapshot.number(object, key, value);
+    }
+
+    auto section = version.config.find(object);
+    if (section == version.config.end() || !section->is_object()) return false;
+
+    auto found = section->find(key);
+    if (found == section->end()) return false;
+    if (found->is_boolean()) {
+        value = found->get<bool>() ? 1.0 : 0.0;
+        return true;
+    }
+    if (!found->is_number()) return false;
+    value = found->get<double>();
+    return true;
+}
+
+/**
+ * @brief Set every declared param from the published configuration.
+ */
+void refreshParams(void) {
+    ConfigStore::Reader reader;
+    ParamRegistry::refresh(
+        [&reader](const ParamRegistry::Entry& param, double& value) {
+            return number(*reader, param.object, param.key, value);
+        });
+}
+
+/**
+ * @brief Add an object to the live object list.
+ */
+void track(Configurable* object) {
+    Instances&                  live = instances();
+    std::lock_guard<std::mutex> lock(live.mutex);
+    live.list.push_back(object);
+}
+
+} // namespace
 
 Configurable::Configurable(const std::string& key)
-    : key(key), config(global[key]) {}
+    : key(key), config(json::object()) {
+    track(this);
+}
+
+Configurable::Configurable(const Configurable& other)
+    : key(other.key), config(other.config), params(other.params),
+      hooks(other.hooks) {
+#ifdef DAE_FROZEN_CONFIG
+    frozen = other.frozen;
+#endif
+    track(this);
+}
+
+Configurable::Configurable(Configurable&& other)
+    : key(std::move(other.key)), config(std::move(other.config)),
+      params(std::move(other.params)), hooks(std::move(other.hooks)) {
+#ifdef DAE_FROZEN_CONFIG
+    frozen = std::move(other.frozen);
+#endif
+    track(this);
+}
+
+Configurable::~Configurable() {
+    Instances&                  live = instances();
+    std::lock_guard<std::mutex> lock(live.mutex);
+    live.list.erase(std::find(live.list.begin(), live.list.end(), this));
+
+    for (Reload* update : live.prepared) {
+        for (Target& target : update->targets) {
+            if (target.object.load(std::memory_order_relaxed) == this) {
+                target.object.store(nullptr, std::memory_order_release);
+            }
+        }
+    }
+}
 
-Configurable::~Configurable() {}
+Configurable::Reload::~Reload() {
+    if (!prepared) return;
+
+    Instances&                  live = instances();
+    std::lock_guard<std::mutex> lock(live.mutex);
+    live.prepared.erase(
+        std::find(live.prepared.begin(), live.prepared.end(), this));
+}
 
 int Configurable::initialize(const std::string& filepath) {
+    auto version = std::make_unique<ConfigStore::Version>();
+
+    // Map an up to date snapshot of the file if there is one
+    uint64_t checksum;
+    if (ConfigSnapshot::checksum(filepath, checksum) ==
+        ConfigSnapshot::ST_GOOD) {
+        const std::string path   = ConfigSnapshot::pathFor(filepath);
+        const int         status = version->snapshot.open(path, checksum);
+        if (status == ConfigSnapshot::ST_GOOD) {
+            ConfigStore::publish(std::move(version));
+            refreshParams();
+            return ST_GOOD;
+        }
+        if (status == ConfigSnapshot::ST_STALE) {
+            warn("Configuration snapshot '%s' is out of date", path.c_str());
+        }
+    }
+
     // Open the configuration file
     std::ifstream file(filepath);
     if (!file.is_open()) {
@@ -32,30 +165,239 @@ int Configurable::initialize(const std::string& filepath) {
     }
 
     // Parse configurations without throwing
-    global = json::parse(file, nullptr, false, true, true);
-    if (global.is_discarded()) {
+    version->config = json::parse(file, nullptr, false, true, true);
+    if (version->config.is_discarded()) {
         warn("Failed to parse JSON in file '%s'", filepath.c_str());
         return ST_PARSE_FAIL;
     }
 
+    ConfigStore::publish(std::move(version));
+    refreshParams();
     return 0;
 }
 
+void Configurable::prepare(Reload& update) {
+    auto version    = std::make_unique<ConfigStore::Version>();
+    version->config = std::move(update.config);
+    ConfigStore::publish(std::move(version));
+
+    // Removed keys go back to their default
+    update.params.clear();
+    {
+        ConfigStore::Reader reader;
+        for (const auto& [object, keys] : update.changed) {
+            for (const std::string& name : keys) {
+                const ParamRegistry::Entry* param =
+                    ParamRegistry::entry(object + "." + name);
+                if (param == nullptr) continue;
+
+                double value;
+                if (!number(*reader, object, name, value)) {
+                    value = param->fallback;
+                }
+                update.params.push_back({param->slot, value});
+            }
+        }
+    }
+
+    Instances&                  live = instances();
+    std::lock_guard<std::mutex> lock(live.mutex);
+
+    update.targets.clear();
+    for (Configurable* object : live.list) {
+        auto changed = update.changed.find(object->key);
+        if (changed == update.changed.end()) continue;
+
+        Target& target = update.targets.emplace_back();
+        target.object.store(object, std::memory_order_relaxed);
+        target.keys = &changed->second;
+    }
+
+    if (!update.prepared) {
+        live.prepared.push_back(&update);
+        update.prepared = true;
+    }
+}
+
+void Configurable::reload(Reload& update) {
+    if (!update.prepared) prepare(update);
+
+    // Write params first, so reconfigured objects see the new values
+    ParamRegistry::store(update.params);
+
+    for (Target& target : update.targets) {
+        // Cleared if an earlier object's configure destroyed it
+        Configurable* object = target.object.load(std::memory_order_acquire);
+        if (object == nullptr) continue;
+
+        for (const std::string& name : *target.keys) {
+            object->config.erase(name);
+        }
+        object->apply(*target.keys);
+    }
+}
+
 void Dae::Configurable::cnf(const std::string& key, const double value) {
-    config[key] = value;
-    configure();
+    write(key, value);
+    apply({key});
 }
 
 void Dae::Configurable::cnf(const std::string& key, const std::string& value) {
-    config[key] = value;
-    configure();
+    write(key, value);
+    apply({key});
+}
+
+void Configurable::cnf(const json& values) {
+    if (!values.is_object()) {
+        warn("Configuration update for '%s' is not an object", key.c_str());
+        return;
+    }
+
+    std::vector<std::string> keys;
+    for (auto it = values.begin(); it != values.end(); ++it) {
+        write(it.key(), it.value());
+        keys.push_back(it.key());
+    }
+    apply(keys);
 }
 
 double Configurable::confNum(const std::string& key, const double defaultVal) {
-    return getOrDefault<double>(config, key, defaultVal);
+    // A declared param is the only copy of its value
+    std::atomic<double>* slot = ParamRegistry::find(this->key + "." + key);
+    if (slot != nullptr) return slot->load(std::memory_order_relaxed);
+
+    ConfigStore::Reader reader;
+
+    // Overrides are always JSON
+    if (reader->snapshot.isOpen() && !config.contains(key)) {
+        double value;
+        return reader->snapshot.number(this->key, key, value) ? value
+                                                              : defaultVal;
+    }
+
+    // Booleans read as 0 or 1
+    const json* value = lookup(key, reader->config);
+    if (value != nullptr && value->is_boolean()) {
+        return value->get<bool>() ? 1.0 : 0.0;
+    }
+    return getOrDefault<double>(key, defaultVal);
 }
 
 std::string Configurable::confStr(const std::string& key,
                                   const std::string& defaultVal) {
-    return getOrDefault<std::string>(config, key, defaultVal);
-}
\ No newline at end of file
+    ConfigStore::Reader reader;
+
+    if (reader->snapshot.isOpen() && !config.contains(key)) {
+        std::string value;
+        return reader->snapshot.string(this->key, key, value) ? value
+                                                              : defaultVal;
+    }
+    return getOrDefault<std::string>(key, defaultVal);
+}
+
+std::vector<std::string> Configurable::keys(void) const {
+    std::set<std::string> names;
+    for (auto it = config.begin(); it != config.end(); ++it) {
+        names.insert(it.key());
+    }
+
+    ConfigStore::Reader reader;
+    if (reader->snapshot.isOpen()) {
+        for (std::string& name : reader->snapshot.keys(key)) {
+            names.insert(std::move(name));
+        }
+    } else {
+        auto section = reader->config.find(key);
+        if (section != reader->config.end() && section->is_object()) {
+            for (auto it = section->begin(); it != section->end(); ++it) {
+                names.insert(it.key());
+            }
+        }
+    }
+    return {names.begin(), names.end()};
+}
+
+std::atomic<double>* Configurable::bind(const std::string& key,
+                                        double             defaultVal) {
+    auto it = params.find(key);
+    if (it != params.end()) return it->second;
+
+    std::atomic<double>* slot = ParamRegistry::resolve(
+        this->key, key, confNum(key, defaultVal), defaultVal);
+    params.emplace(key, slot);
+    return slot;
+}
+
+const Configurable::json* Configurable::lookup(const std::string& key,
+                                              const json&        root) const {
+    auto override = config.find(key);
+    if (override != config.end()) return &*override;
+
+    // Never insert into the global configuration
+    auto section = root.find(this->key);
+    if (section == root.end() || !section->is_object()) return nullptr;
+
+    auto value = section->find(key);
+    return value == section->end() ? nullptr : &*value;
+}
+
+void Configurable::write(const std::string& key, const json& value) {
+#ifdef DAE_FROZEN_CONFIG
+    if (frozen.count(key) != 0) return;
+#endif
+
+    std::atomic<double>* slot = ParamRegistry::find(this->key + "." + key);
+    if (slot == nullptr || (!value.is_number() && !value.is_boolean())) {
+        config[key] = value;
+        return;
+    }
+
+    // Shared by every object with this key, so never a private override
+    config.erase(key);
+    slot->store(value.is_boolean() ? (value.get<bool>() ? 1.0 : 0.0)
+                                    : value.get<double>(),
+                std::memory_order_relaxed);
+}
+
+void Configurable::apply(const std::vector<std::string>& changes) {
+#ifdef DAE_FROZEN_CONFIG
+    // Frozen params are compiled in, so no update can reach them
+    std::vector<std::string> keys;
+    for (const std::string& name : changes) {
+        if (frozen.count(name) == 0) {
+            keys.push_back(name);
+        } else {
+            warn("Config '%s.%s' is frozen in this build, ignoring the update",
+                 this->key.c_str(), name.c_str());
+        }
+    }
+#else
+    const std::vector<std::string>& keys = changes;
+#endif
+
+    dirty.insert(keys.begin(), keys.end());
+    updating = true;
+
+    // Work out what depends on the changed keys before running anything
+    std::vector<bool> run(hooks.size(), false);
+    bool              reconfigure = false;
+    for (const std::string& name : keys) {
+        bool hooked = false;
+        for (size_t i = 0; i < hooks.size(); i++) {
+            const std::vector<std::string>& deps = hooks[i].keys;
+            if (std::find(deps.begin(), deps.end(), name) != deps.end()) {
+                run[i] = true;
+                hooked = true;
+            }
+        }
+        if (!hooked && params.count(name) == 0) reconfigure = true;
+    }
+
+    if (reconfigure) configure();
+    for (size_t i = 0; i < hooks.size(); i++) {
+        if (run[i]) hooks[i].call(*this);
+    }
+
+    dirty.clear();
+    updating = false;
+}
@@ -1 +1,494 @@
-#include "common/Logging.h"
\ No newline at end of file
+/**
+ * @file Logging.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the asynchronous Logger.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdarg>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/Logging.h"
+
+using namespace Dae;
+
+namespace {
+
+/**
+ * @brief Header written in front of every record in a ring.
+ */
+struct RecordHeader {
+    /// @brief Call site of the record, nullptr for padding records.
+    const Logger::Site* site;
+    /// @brief Payload decoder.
+    Logger::Decoder decoder;
+    /// @brief Total record size including this header.
+    size_t size;
+};
+
+/// @brief Alignment of every record in a ring.
+constexpr size_t RECORD_ALIGN = alignof(RecordHeader);
+
+/**
+ * @brief Single producer, single consumer record ring, one per logging thread.
+ */
+struct Ring {
+    /// @brief Bytes written by the producer.
+    alignas(64) std::atomic<size_t> head{0};
+    /// @brief Bytes pending publication by the producer.
+    size_t pending = 0;
+    /// @brief Bytes consumed by the background thread.
+    alignas(64) std::atomic<size_t> tail{0};
+    /// @brief Set once the producing thread has exited.
+    std::atomic<bool> retired{false};
+    /// @brief Record storage.
+    alignas(64) uint8_t buffer[Logger::RING_SIZE];
+};
+
+/**
+ * @brief Shared logger state, owning the background thread.
+ */
+class Backend {
+public:
+    Backend() : thread([this] { run(); }) { tick(); }
+
+    ~Backend() {
+        running.store(false, std::memory_order_relaxed);
+        thread.join();
+
+        for (Ring* ring : rings) {
+            delete ring;
+        }
+    }
+
+    /**
+     * @brief Get a ring for a new logging thread. Rings of exited threads are
+     * reused once drained, so rings are only freed at shutdown.
+     *
+     * @return Ring* The ring.
+     */
+    Ring* acquire() {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (Ring* ring : rings) {
+            if (ring->retired.load(std::memory_order_acquire) &&
+                ring->tail.load(std::memory_order_relaxed) ==
+                    ring->head.load(std::memory_order_relaxed)) {
+                ring->retired.store(false, std::memory_order_relaxed);
+                return ring;
+            }
+        }
+
+        rings.push_back(new Ring());
+        return rings.back();
+    }
+
+    /**
+     * @brief Snapshot the head of every ring.
+     *
+     * @return std::vector<std::pair<Ring*, size_t>> Rings and their heads.
+     */
+    std::vector<std::pair<Ring*, size_t>> heads() {
+        std::lock_guard<std::mutex>           lock(mutex);
+        std::vector<std::pair<Ring*, size_t>> out;
+        for (Ring* ring : rings) {
+            out.emplace_back(ring, ring->head.load(std::memory_order_acquire));
+        }
+        return out;
+    }
+
+    /**
+     * @brief Add a rate limited call site to the ones checked for unreported
+     * suppressed counts.
+     *
+     * @param limit The call site.
+     */
+    void track(Logger::RateLimit& limit) {
+        Logger::RateLimit* first = limits.load(std::memory_order_relaxed);
+        do {
+            limit.next = first;
+        } while (!limits.compare_exchange_weak(first, &limit,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed));
+    }
+
+    /// @brief Number of records dropped because a ring was full.
+    std::atomic<uint64_t> dropped{0};
+
+    /// @brief Stream for debug, info and warning records.
+    std::atomic<FILE*> out{stdout};
+
+    /// @brief Stream for error records.
+    std::atomic<FILE*> err{stderr};
+
+private:
+    /// @brief Period the background thread sleeps for when idle.
+    static constexpr std::chrono::microseconds IDLE_PERIOD{500};
+
+    /// @brief Guards the list of rings.
+    std::mutex mutex;
+
+    /// @brief Every registered ring.
+    std::vector<Ring*> rings;
+
+    /// @brief Rate limited call sites that have suppressed a record.
+    std::atomic<Logger::RateLimit*> limits{nullptr};
+
+    /// @brief Cleared to stop the background thread.
+    std::atomic<bool> running{true};
+
+    /// @brief Dropped count that has already been reported.
+    uint64_t reported = 0;
+
+    /// @brief The background thread.
+    std::thread thread;
+
+    /**
+     * @brief Advance the coarse clock used by rate limited call sites.
+     */
+    static void tick() {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        Logger::coarseMicros.store(
+            static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(now)
+                    .count()),
+            std::memory_order_relaxed);
+    }
+
+    void run() {
+        while (running.load(std::memory_order_relaxed)) {
+            tick();
+            if (!drainAll()) std::this_thread::sleep_for(IDLE_PERIOD);
+        }
+
+        // Write out anything queued or suppressed before shutdown
+        drainAll(true);
+    }
+
+    bool drainAll(bool shutdown = false) {
+        bool wrote = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            for (Ring* ring : rings) {
+                wrote |= drain(*ring);
+            }
+        }
+
+        wrote |= summarise(shutdown);
+
+        const uint64_t lost = dropped.load(std::memory_order_relaxed);
+        if (lost != reported) {
+            Logger::print(err.load(std::memory_order_relaxed),
+                          "\033[31m[Logging.cpp]\033[0m Dropped %" PRIu64
+                          " log records, queue full!\n",
+                          lost - reported);
+            reported = lost;
+            wrote    = true;
+        }
+
+        if (wrote) {
+            fflush(out.load(std::memory_order_relaxed));
+            fflush(err.load(std::memory_order_relaxed));
+        }
+
+        return wrote;
+    }
+
+    /**
+     * @brief Report the suppressed counts of rate limited call sites that
+     * have gone quiet. A call site still being suppressed reports its own
+     * count when it is next let through.
+     *
+     * @param all Report every suppressed count, as at shutdown.
+     * @return bool True if a summary was written.
+     */
+    bool summarise(bool all) {
+        const uint64_t now =
+            Logger::coarseMicros.load(std::memory_order_relaxed);
+        bool wrote = false;
+
+        for (Logger::RateLimit* limit = limits.load(std::memory_order_acquire);
+             limit != nullptr; limit = limit->next) {
+            if (limit->suppressed.load(std::memory_order_relaxed) == 0) {
+                continue;
+            }
+
+            // Out of tokens, so the call site may still be suppressing
+            if (!all && limit->tat.load(std::memory_order_relaxed) > now) {
+                continue;
+            }
+
+            const uint32_t count =
+                limit->suppressed.exchange(0, std::memory_order_relaxed);
+            if (count == 0) continue;
+
+            FILE* stream = limit->summary->level == Logger::LV_ERROR
+                               ? err.load(std::memory_order_relaxed)
+                               : out.load(std::memory_order_relaxed);
+            Logger::print(stream, limit->summary->fmt, count);
+            wrote = true;
+        }
+
+        return wrote;
+    }
+
+    bool drain(Ring& ring) {
+        size_t       tail = ring.tail.load(std::memory_order_relaxed);
+        const size_t head = ring.head.load(std::memory_order_acquire);
+
+        if (tail == head) return false;
+
+        while (tail != head) {
+            const size_t offset = tail % Logger::RING_SIZE;
+
+            // Too little space at the end of the ring for a header
+            if (Logger::RING_SIZE - offset < sizeof(RecordHeader)) {
+                tail += Logger::RING_SIZE - offset;
+                continue;
+            }
+
+            RecordHeader header;
+            memcpy(&header, ring.buffer + offset, sizeof(header));
+
+            if (header.site != nullptr) {
+                FILE* stream = header.site->level == Logger::LV_ERROR
+                                   ? err.load(std::memory_order_relaxed)
+                                   : out.load(std::memory_order_relaxed);
+                header.decoder(stream, header.site->fmt,
+                               ring.buffer + offset + sizeof(header));
+            }
+
+            tail += header.size;
+        }
+
+        ring.tail.store(tail, std::memory_order_release);
+        return true;
+    }
+};
+
+/**
+ * @brief Get the shared logger state, starting the background thread on first
+ * use.
+ *
+ * @return Backend& The logger state.
+ */
+Backend& backend() {
+    static Backend instance;
+    return instance;
+}
+
+/**
+ * @brief Owns the calling thread's ring, and retires it on thread exit.
+ */
+struct ThreadRing {
+    Ring* ring = nullptr;
+
+    ~ThreadRing() {
+        if (ring != nullptr) {
+            ring->retired.store(true, std::memory_order_release);
+        }
+    }
+
+    Ring& get() {
+        if (ring == nullptr) ring = backend().acquire();
+        return *ring;
+    }
+};
+
+thread_local ThreadRing threadRing;
+
+/**
+ * @brief Registry of the runtime levels of every subsystem tag.
+ */
+struct TagRegistry {
+    /// @brief Guards the registry.
+    std::mutex mutex;
+
+    /// @brief Level given to every tag without an explicit level.
+#ifdef DEBUG
+    Logger::Level defaultLevel = Logger::LV_DEBUG;
+#else
+    Logger::Level defaultLevel = Logger::LV_INFO;
+#endif
+
+    /**
+     * @brief The level of a tag, and the level variable of every call site
+     * file that has it.
+     */
+    struct Entry {
+        /// @brief Minimum level that is logged.
+        Logger::Level level;
+        /// @brief Registered level variables, empty until one registers.
+        std::vector<std::atomic<uint8_t>*> levels;
+    };
+
+    /// @brief Every registered or set tag, by name.
+    std::map<std::string, Entry> tags;
+};
+
+/**
+ * @brief Get the tag registry. Constructed on first use, since tags register
+ * themselves during static initialisation.
+ *
+ * @return TagRegistry& The tag registry.
+ */
+TagRegistry& tagRegistry() {
+    static TagRegistry instance;
+    return instance;
+}
+
+} // namespace
+
+uint8_t* Logger::reserve(const Site& site, Decoder decoder, size_t size) {
+    Ring&  ring  = threadRing.get();
+    size_t total = (sizeof(RecordHeader) + size + RECORD_ALIGN - 1) &
+                   ~(RECORD_ALIGN - 1);
+
+    const size_t head   = ring.head.load(std::memory_order_relaxed);
+    const size_t offset = head % RING_SIZE;
+    size_t       skip   = 0;
+
+    // Records never wrap, pad out the end of the ring instead.
+    if (RING_SIZE - offset < total) skip = RING_SIZE - offset;
+
+    const size_t used = head - ring.tail.load(std::memory_order_acquire);
+    if (total > RING_SIZE / 2 || used + skip + total > RING_SIZE) {
+        backend().dropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    if (skip >= sizeof(RecordHeader)) {
+        const RecordHeader pad{nullptr, nullptr, skip};
+        memcpy(ring.buffer + offset, &pad, sizeof(pad));
+    }
+
+    uint8_t*           record = ring.buffer + (head + skip) % RING_SIZE;
+    const RecordHeader header{&site, decoder, total};
+    memcpy(record, &header, sizeof(header));
+
+    ring.pending = skip + total;
+    return record + sizeof(header);
+}
+
+void Logger::commit(void) {
+    Ring& ring = *threadRing.ring;
+    ring.head.store(ring.head.load(std::memory_order_relaxed) + ring.pending,
+                    std::memory_order_release);
+    ring.pending = 0;
+}
+
+void Logger::flush(void) {
+    for (const auto& [ring, head] : backend().heads()) {
+        while (ring->tail.load(std::memory_order_acquire) < head) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+    fflush(backend().out.load(std::memory_order_relaxed));
+    fflush(backend().err.load(std::memory_order_relaxed));
+}
+
+void Logger::RateLimit::track(const Site& site) {
+    if (tracked.exchange(true, std::memory_order_relaxed)) return;
+
+    summary = &site;
+    backend().track(*this);
+}
+
+bool Logger::registerTag(const char* name, std::atomic<uint8_t>& level) {
+    TagRegistry&                registry = tagRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    // A level set before the tag registered is kept
+    auto [it, created] = registry.tags.try_emplace(name);
+    if (created) it->second.level = registry.defaultLevel;
+
+    level.store(it->second.level, std::memory_order_relaxed);
+    it->second.levels.push_back(&level);
+    return true;
+}
+
+void Logger::setLevel(Level level) {
+    TagRegistry&                registry = tagRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    registry.defaultLevel = level;
+    for (auto& [name, entry] : registry.tags) {
+        entry.level = level;
+        for (std::atomic<uint8_t>* tagLevel : entry.levels) {
+            tagLevel->store(level, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool Logger::setLevel(const std::string& tag, Level level) {
+    TagRegistry&                registry = tagRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    TagRegistry::Entry& entry = registry.tags[tag];
+    entry.level               = level;
+    for (std::atomic<uint8_t>* tagLevel : entry.levels) {
+        tagLevel->store(level, std::memory_order_relaxed);
+    }
+    return !entry.levels.empty();
+}
+
+Logger::Level Logger::getLevel(const std::string& tag) {
+    TagRegistry&                registry = tagRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto it = registry.tags.find(tag);
+    if (it == registry.tags.end()) return LV_OFF;
+
+    return it->second.level;
+}
+
+std::vector<std::string> Logger::tags(void) {
+    TagRegistry&                registry = tagRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    std::vector<std::string> names;
+    for (const auto& [name, entry] : registry.tags) {
+        if (!entry.levels.empty()) names.push_back(name);
+    }
+    return names;
+}
+
+bool Logger::parseLevel(const std::string& name, Level& level) {
+    static const std::pair<const char*, Level> names[] = {
+        {"trace", LV_TRACE}, {"debug", LV_DEBUG}, {"info", LV_INFO},
+        {"warn", LV_WARN},   {"error", LV_ERROR}, {"off", LV_OFF}};
+
+    for (const auto& [str, value] : names) {
+        if (name == str) {
+            level = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+void Logger::redirect(FILE* out, FILE* err) {
+    flush();
+    backend().out.store(out, std::memory_order_relaxed);
+    backend().err.store(err, std::memory_order_relaxed);
+}
+
+uint64_t Logger::dropped(void) {
+    return backend().dropped.load(std::memory_order_relaxed);
+}
+
+void Logger::print(FILE* out, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    vfprintf(out, fmt, args);
+    va_end(args);
+}
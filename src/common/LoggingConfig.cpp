@@ -0,0 +1,47 @@
+/**
+ * @file LoggingConfig.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the LoggingConfig class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include "common/LoggingConfig.h"
+
+using namespace Dae;
+
+LoggingConfig::LoggingConfig(const std::string& key) : Configurable(key) {
+    configure();
+}
+
+void LoggingConfig::configure(void) {
+    Logger::Level level;
+
+    // A new default level resets every tag, so they are all reapplied
+    const bool all = changed("level");
+
+    const std::string name = confStr("level");
+    if (all && !name.empty()) {
+        if (Logger::parseLevel(name, level)) {
+            Logger::setLevel(level);
+        } else {
+            warn("Unknown log level '%s'", name.c_str());
+        }
+    }
+
+    // Tags that have not registered yet keep their level until they do
+    for (const std::string& tag : keys()) {
+        if (tag == "level" || (!all && !changed(tag))) continue;
+
+        const std::string tagName = confStr(tag);
+        if (tagName.empty()) continue;
+
+        if (Logger::parseLevel(tagName, level)) {
+            Logger::setLevel(tag, level);
+        } else {
+            warn("Unknown log level '%s' for tag '%s'", tagName.c_str(),
+                 tag.c_str());
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/**
+ * @file MessageBus.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the MessageBus class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <map>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+
+#include "common/Logging.h"
+#include "common/MessageBus.h"
+
+using namespace Dae;
+
+namespace {
+
+/**
+ * @brief A registered topic.
+ */
+struct Entry {
+    /// @brief Type of the topic.
+    std::type_index type;
+    /// @brief The topic.
+    std::unique_ptr<TopicBase> topic;
+};
+
+/**
+ * @brief Topic storage and name lookup.
+ */
+struct Registry {
+    /// @brief Guards the registry.
+    std::mutex mutex;
+
+    /// @brief Every topic, by name.
+    std::map<std::string, Entry> topics;
+};
+
+/**
+ * @brief Get the topic registry, created on first use.
+ *
+ * @return Registry& The topic registry.
+ */
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+} // namespace
+
+TopicBase* MessageBus::find(const std::string& name, const std::type_info& type,
+                            TopicBase* (*create)(void)) {
+    Registry&                   reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    auto it = reg.topics.find(name);
+    if (it == reg.topics.end()) {
+        Entry entry{type, std::unique_ptr<TopicBase>(create())};
+        it = reg.topics.emplace(name, std::move(entry)).first;
+    }
+
+    if (it->second.type != std::type_index(type)) {
+        warn("Topic '%s' already exists with another message type",
+             name.c_str());
+        return nullptr;
+    }
+    return it->second.topic.get();
+}
+
+std::vector<std::string> MessageBus::names(void) {
+    Registry&                   reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    std::vector<std::string> out;
+    for (const auto& [name, entry] : reg.topics) {
+        out.push_back(name);
+    }
+    return out;
+}
@@ -0,0 +1,193 @@
+/**
+ * @file Param.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the ParamRegistry class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string_view>
+
+#include "common/Logging.h"
+#include "common/Param.h"
+
+using namespace Dae;
+
+namespace {
+
+/// @brief Number of buckets in the lookup table.
+constexpr size_t BUCKETS = 4 * ParamRegistry::MAX_PARAMS;
+
+/// @brief Number of parameters in the lookup table, kept below the bucket
+/// count so a probe always ends at an empty bucket.
+constexpr size_t TABLE_LIMIT = BUCKETS * 3 / 4;
+
+/**
+ * @brief Parameter storage and name lookup.
+ */
+struct Registry {
+    /// @brief Guards registration.
+    std::mutex mutex;
+
+    /// @brief Flat value array.
+    std::atomic<double> values[ParamRegistry::MAX_PARAMS];
+
+    /// @brief Number of used slots in the value array.
+    size_t used = 0;
+
+    /// @brief Slots of parameters that did not fit in the value array.
+    std::deque<std::atomic<double>> overflow;
+
+    /// @brief Every parameter, in registration order.
+    std::deque<ParamRegistry::Entry> entries;
+
+    /// @brief Open addressed table of the entries, hashed by name. Filled in
+    /// under the lock, and read without it.
+    std::atomic<const ParamRegistry::Entry*> table[BUCKETS];
+
+    /// @brief Parameters that did not fit in the table, by name.
+    std::map<std::string, const ParamRegistry::Entry*> spill;
+
+    /// @brief Set once a parameter is in `spill`.
+    std::atomic<bool> spilled{false};
+};
+
+/**
+ * @brief Get the parameter registry, created on first use.
+ *
+ * @return Registry& The parameter registry.
+ */
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+/**
+ * @brief Check whether an entry is called "<object>.<key>".
+ */
+bool named(const ParamRegistry::Entry& entry, std::string_view name) {
+    return name.size() == entry.object.size() + 1 + entry.key.size() &&
+           name.substr(0, entry.object.size()) == entry.object &&
+           name[entry.object.size()] == '.' &&
+           name.substr(entry.object.size() + 1) == entry.key;
+}
+
+/**
+ * @brief Find a parameter in the lookup table, without the lock.
+ *
+ * @return const ParamRegistry::Entry* The parameter, or nullptr.
+ */
+const ParamRegistry::Entry* lookup(const Registry& reg,
+                                   std::string_view name) {
+    size_t bucket = std::hash<std::string_view>{}(name) & (BUCKETS - 1);
+    for (;;) {
+        const ParamRegistry::Entry* entry =
+            reg.table[bucket].load(std::memory_order_acquire);
+        if (entry == nullptr || named(*entry, name)) return entry;
+        bucket = (bucket + 1) & (BUCKETS - 1);
+    }
+}
+
+/**
+ * @brief Find a parameter, with the lock held.
+ *
+ * @return const ParamRegistry::Entry* The parameter, or nullptr.
+ */
+const ParamRegistry::Entry* lookupLocked(const Registry&    reg,
+                                         const std::string& name) {
+    const ParamRegistry::Entry* entry = lookup(reg, name);
+    if (entry != nullptr) return entry;
+
+    auto it = reg.spill.find(name);
+    return it == reg.spill.end() ? nullptr : it->second;
+}
+
+} // namespace
+
+std::atomic<double>* ParamRegistry::resolve(const std::string& object,
+                                            const std::string& key,
+                                            double value, double fallback) {
+    Registry&                   reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    const std::string name  = object + "." + key;
+    const Entry*      found = lookupLocked(reg, name);
+    if (found != nullptr) return found->slot;
+
+    std::atomic<double>* slot;
+    if (reg.used < MAX_PARAMS) {
+        slot = &reg.values[reg.used++];
+    } else {
+        warn_once("Parameter registry is full, storing '%s' out of line",
+                  name.c_str());
+        slot = &reg.overflow.emplace_back();
+    }
+    slot->store(value, std::memory_order_relaxed);
+
+    const Entry& entry = reg.entries.emplace_back(
+        Entry{object, key, slot, fallback});
+
+    // Published last, lookups see the entry complete or not at all
+    if (reg.entries.size() <= TABLE_LIMIT) {
+        size_t bucket = std::hash<std::string_view>{}(name) & (BUCKETS - 1);
+        while (reg.table[bucket].load(std::memory_order_relaxed) != nullptr) {
+            bucket = (bucket + 1) & (BUCKETS - 1);
+        }
+        reg.table[bucket].store(&entry, std::memory_order_release);
+    } else {
+        reg.spill.emplace(name, &entry);
+        reg.spilled.store(true, std::memory_order_release);
+    }
+    return slot;
+}
+
+const ParamRegistry::Entry* ParamRegistry::entry(const std::string& name) {
+    Registry&    reg   = registry();
+    const Entry* found = lookup(reg, name);
+    if (found != nullptr || !reg.spilled.load(std::memory_order_acquire)) {
+        return found;
+    }
+
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    return lookupLocked(reg, name);
+}
+
+void ParamRegistry::refresh(
+    const std::function<bool(const Entry&, double&)>& read) {
+    Registry&                   reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    for (const Entry& entry : reg.entries) {
+        double value;
+        if (!read(entry, value)) value = entry.fallback;
+        entry.slot->store(value, std::memory_order_relaxed);
+    }
+}
+
+void ParamRegistry::store(const std::vector<Write>& writes) {
+    // Odd while the batch is being written
+    batch.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (const Write& write : writes) {
+        write.slot->store(write.value, std::memory_order_relaxed);
+    }
+
+    batch.fetch_add(1, std::memory_order_release);
+}
+
+std::vector<std::string> ParamRegistry::names(void) {
+    Registry&                   reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    std::vector<std::string> out;
+    for (const Entry& entry : reg.entries) {
+        out.push_back(entry.object + "." + entry.key);
+    }
+    return out;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file Watchdog.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the Watchdog class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <chrono>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
+#include "common/Logging.h"
+#include "common/Watchdog.h"
+
+using namespace Dae;
+
+Watchdog::Watchdog(const std::string& key) : Configurable(key) {
+    onChange({"period"}, &Watchdog::rearm);
+    configure();
+}
+
+Watchdog::~Watchdog() { stop(); }
+
+void Watchdog::configure(void) {
+    if (LATE_FRAMES.get() > FAILSAFE_FRAMES.get() ||
+        FAILSAFE_FRAMES.get() * FRAME_PERIOD.get() > LOST_TIMEOUT.get()) {
+        warn("Watchdog timeouts are out of order, levels will be skipped");
+    }
+}
+
+void Watchdog::setAction(Level level, std::function<void(void)> action) {
+    if (level < LV_OK || level >= LV_COUNT) return;
+    actions[level] = std::move(action);
+}
+
+int Watchdog::start(void) {
+    if (watcher.joinable()) return ST_RUNNING;
+
+#ifdef __linux__
+    timer = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    if (timer < 0) {
+        stl_error(errno, "Failed to create the watchdog timer");
+        return ST_TIMER_FAIL;
+    }
+    if (!arm()) {
+        close(timer);
+        timer = -1;
+        return ST_TIMER_FAIL;
+    }
+#endif
+
+    lastFeed.store(now(), std::memory_order_relaxed);
+    current.store(LV_OK, std::memory_order_relaxed);
+    running.store(true, std::memory_order_relaxed);
+    watcher = std::thread(&Watchdog::run, this);
+    return ST_GOOD;
+}
+
+void Watchdog::stop(void) {
+    if (!watcher.joinable()) return;
+
+    running.store(false, std::memory_order_relaxed);
+    watcher.join();
+
+#ifdef __linux__
+    if (timer >= 0) close(timer);
+    timer = -1;
+#endif
+}
+
+double Watchdog::age(void) const {
+    const uint64_t last = lastFeed.load(std::memory_order_acquire);
+    const uint64_t time = now();
+    return time > last ? static_cast<double>(time - last) * 1e-9 : 0.0;
+}
+
+const char* Watchdog::levelName(Level level) {
+    switch (level) {
+    case LV_OK:
+        return "ok";
+    case LV_LATE:
+        return "late";
+    case LV_FAILSAFE:
+        return "failsafe";
+    case LV_LOST:
+        return "lost";
+    default:
+        return "unknown";
+    }
+}
+
+void Watchdog::run(void) {
+    while (running.load(std::memory_order_relaxed)) {
+#ifdef __linux__
+        if (timer >= 0) {
+            // Wake on each expiry, or after a while to check `running`
+            pollfd events = {timer, POLLIN, 0};
+            if (poll(&events, 1, 100) <= 0) continue;
+
+            uint64_t expiries;
+            if (read(timer, &expiries, sizeof(expiries)) < 0) continue;
+
+            check();
+            continue;
+        }
+#endif
+
+        // Read every time, so a new period applies at once
+        std::this_thread::sleep_for(
+            std::chrono::duration<double>(PERIOD.get()));
+        check();
+    }
+}
+
+bool Watchdog::arm(void) {
+#ifdef __linux__
+    const auto ns = static_cast<long>(PERIOD.get() * 1e9);
+    if (ns <= 0) {
+        warn("Watchdog period must be positive");
+        return false;
+    }
+
+    itimerspec spec;
+    spec.it_interval.tv_sec  = ns / 1000000000;
+    spec.it_interval.tv_nsec = ns % 1000000000;
+    spec.it_value            = spec.it_interval;
+    if (timerfd_settime(timer, 0, &spec, nullptr) != 0) {
+        stl_error(errno, "Failed to arm the watchdog timer");
+        return false;
+    }
+#endif
+    return true;
+}
+
+void Watchdog::rearm(void) {
+    if (timer >= 0) arm();
+}
+
+void Watchdog::check(void) {
+    const double age   = this->age();
+    const double frame = FRAME_PERIOD.get();
+
+    Level target = LV_OK;
+    if (age >= LOST_TIMEOUT.get()) {
+        target = LV_LOST;
+    } else if (age >= FAILSAFE_FRAMES.get() * frame) {
+        target = LV_FAILSAFE;
+    } else if (age >= LATE_FRAMES.get() * frame) {
+        target = LV_LATE;
+    }
+
+    const Level level = this->level();
+    if (target == level) return;
+
+    if (target == LV_OK) {
+        info("Telemetry recovered after %s", levelName(level));
+        current.store(LV_OK, std::memory_order_release);
+        if (actions[LV_OK]) actions[LV_OK]();
+        return;
+    }
+
+    // Only escalate, telemetry only gets older until it is fed again
+    if (target < level) return;
+    if (level == LV_OK) tripCount.fetch_add(1, std::memory_order_relaxed);
+
+    for (int next = level + 1; next <= target; next++) {
+        warn("Watchdog %s, no telemetry for %.1f ms",
+             levelName(static_cast<Level>(next)), age * 1e3);
+        current.store(next, std::memory_order_release);
+        if (actions[next]) actions[next]();
+    }
+}
+
+uint64_t Watchdog::now(void) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
@@ -0,0 +1,251 @@
+/**
+ * @file ControlAllocator.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the ControlAllocator class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "common/Logging.h"
+#include "control/ControlAllocator.h"
+
+using namespace Dae;
+
+namespace {
+
+/// @brief Row stride of the factor of the free block.
+constexpr size_t STRIDE = ControlAllocator::CHANNELS;
+
+/// @brief Smallest channel weight, keeping the Hessian positive definite.
+constexpr double MIN_WEIGHT = 1e-3;
+
+/// @brief Largest multiplier of a held actuator that counts as optimal.
+constexpr double TOLERANCE = 1e-9;
+
+/**
+ * @brief Factor the lower triangle of a positive definite block in place,
+ * `A = L L'`.
+ *
+ * @param a The block, row stride `STRIDE`.
+ * @param n Size of the block.
+ */
+void cholesky(double* a, size_t n) {
+    for (size_t j = 0; j < n; j++) {
+        double* row = a + j * STRIDE;
+
+        double diagonal = row[j];
+        for (size_t k = 0; k < j; k++) {
+            diagonal -= row[k] * row[k];
+        }
+        row[j] = std::sqrt(diagonal);
+
+        const double inverse = 1 / row[j];
+        for (size_t i = j + 1; i < n; i++) {
+            double* other = a + i * STRIDE;
+            double  sum   = other[j];
+            for (size_t k = 0; k < j; k++) {
+                sum -= other[k] * row[k];
+            }
+            other[j] = sum * inverse;
+        }
+    }
+}
+
+/**
+ * @brief Solve `L L' x = b` in place, by forward then back substitution.
+ *
+ * @param l The factor, row stride `STRIDE`.
+ * @param n Size of the factor.
+ * @param x Set to the solution, from the right hand side.
+ */
+void substitute(const double* l, size_t n, double* x) {
+    for (size_t i = 0; i < n; i++) {
+        for (size_t k = 0; k < i; k++) {
+            x[i] -= l[i * STRIDE + k] * x[k];
+        }
+        x[i] /= l[i * STRIDE + i];
+    }
+    for (size_t i = n; i-- > 0;) {
+        for (size_t k = i + 1; k < n; k++) {
+            x[i] -= l[k * STRIDE + i] * x[k];
+        }
+        x[i] /= l[i * STRIDE + i];
+    }
+}
+
+} // namespace
+
+ControlAllocator::ControlAllocator(const std::string& key)
+    : Configurable(key) {
+    configure();
+}
+
+void ControlAllocator::configure(void) {
+    const double gamma = confNum("gamma", 1000.0);
+
+    double axisWeights[AXES];
+    for (size_t axis = 0; axis < AXES; axis++) {
+        const double w =
+            confNum(std::string(Mixer::AXIS_NAMES[axis]) + "_weight", 1.0);
+        axisWeights[axis] = gamma * w * w;
+    }
+
+    double channelWeights[CHANNELS];
+    count = 0;
+    for (size_t ch = 0; ch < CHANNELS; ch++) {
+        const std::string prefix = "ch" + std::to_string(ch) + "_";
+
+        bool effective = false;
+        for (size_t axis = 0; axis < AXES; axis++) {
+            effectiveness(axis, ch) =
+                confNum(Mixer::channelKey(ch, axis), 0.0);
+            effective = effective || effectiveness(axis, ch) != 0;
+        }
+        if (effective) actuators[count++] = ch;
+
+        lower[ch] = confNum(prefix + "min", -1.0);
+        upper[ch] = confNum(prefix + "max", 1.0);
+        if (lower[ch] > upper[ch]) {
+            warn("Allocator channel %zu limits are reversed", ch);
+            std::swap(lower[ch], upper[ch]);
+        }
+        preferred[ch] =
+            std::clamp(confNum(prefix + "trim", 0.0), lower[ch], upper[ch]);
+
+        const double w = confNum(prefix + "weight", 1.0);
+        if (w < MIN_WEIGHT) {
+            warn("Allocator channel %zu weight must be positive", ch);
+        }
+        channelWeights[ch] = std::max(w, MIN_WEIGHT);
+        channelWeights[ch] *= channelWeights[ch];
+    }
+
+    // Compile the cost, 1/2 u' H u - f' u with f = G v + Wu^2 up
+    for (size_t i = 0; i < CHANNELS; i++) {
+        for (size_t j = 0; j < CHANNELS; j++) {
+            double sum = i == j ? channelWeights[i] : 0.0;
+            for (size_t axis = 0; axis < AXES; axis++) {
+                sum += axisWeights[axis] * effectiveness(axis, i) *
+                       effectiveness(axis, j);
+            }
+            hessian(i, j) = sum;
+        }
+        for (size_t axis = 0; axis < AXES; axis++) {
+            demandGain(i, axis) = axisWeights[axis] * effectiveness(axis, i);
+        }
+        preferredTerm[i] = channelWeights[i] * preferred[i];
+    }
+
+    reset();
+}
+
+void ControlAllocator::reset(void) {
+    solution  = preferred;
+    converged = true;
+    std::fill(held, held + CHANNELS, 0);
+}
+
+size_t ControlAllocator::allocate(const Demand& demand, Control& control) {
+    // The cost is minimised where H u = f
+    const Actuators linear = demandGain * demand + preferredTerm;
+
+    size_t iterations = 0;
+    converged         = false;
+    while (!converged && iterations < MAX_ITERATIONS) {
+        iterations++;
+
+        size_t free[CHANNELS];
+        size_t n = 0;
+        for (size_t k = 0; k < count; k++) {
+            if (held[actuators[k]] == 0) free[n++] = actuators[k];
+        }
+
+        // Step to the minimum over the free actuators, the held ones fixed
+        double factor[CHANNELS * STRIDE];
+        double step[CHANNELS];
+        for (size_t a = 0; a < n; a++) {
+            const size_t i = free[a];
+
+            double residual = linear[i];
+            for (size_t k = 0; k < count; k++) {
+                residual -= hessian(i, actuators[k]) * solution[actuators[k]];
+            }
+            step[a] = residual;
+
+            for (size_t b = 0; b <= a; b++) {
+                factor[a * STRIDE + b] = hessian(i, free[b]);
+            }
+        }
+        cholesky(factor, n);
+        substitute(factor, n, step);
+
+        // Go as far along the step as the limits allow
+        double fraction = 1;
+        size_t blocking = n;
+        int8_t side     = 0;
+        for (size_t a = 0; a < n; a++) {
+            const size_t i      = free[a];
+            const double target = solution[i] + step[a];
+
+            if (target < lower[i]) {
+                const double f = (lower[i] - solution[i]) / step[a];
+                if (f < fraction) {
+                    fraction = f;
+                    blocking = a;
+                    side     = -1;
+                }
+            } else if (target > upper[i]) {
+                const double f = (upper[i] - solution[i]) / step[a];
+                if (f < fraction) {
+                    fraction = f;
+                    blocking = a;
+                    side     = 1;
+                }
+            }
+        }
+        for (size_t a = 0; a < n; a++) {
+            solution[free[a]] += fraction * step[a];
+        }
+
+        // Hold the actuator that stopped the step at its limit
+        if (blocking != n) {
+            const size_t i = free[blocking];
+            solution[i]    = side < 0 ? lower[i] : upper[i];
+            held[i]        = side;
+            continue;
+        }
+
+        // At the minimum, release the held actuator whose multiplier is the
+        // most negative, the one the cost pulls off its limit hardest
+        double worst   = -TOLERANCE;
+        size_t release = CHANNELS;
+        for (size_t k = 0; k < count; k++) {
+            const size_t i = actuators[k];
+            if (held[i] == 0) continue;
+
+            double gradient = -linear[i];
+            for (size_t j = 0; j < count; j++) {
+                gradient += hessian(i, actuators[j]) * solution[actuators[j]];
+            }
+            const double multiplier = -held[i] * gradient;
+            if (multiplier < worst) {
+                worst   = multiplier;
+                release = i;
+            }
+        }
+
+        if (release == CHANNELS) {
+            converged = true;
+        } else {
+            held[release] = 0;
+        }
+    }
+
+    std::copy(solution.data, solution.data + CHANNELS, control.pwm);
+    return iterations;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file EffectivenessEstimator.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the EffectivenessEstimator class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <string>
+
+#include "common/Logging.h"
+#include "control/EffectivenessEstimator.h"
+#include "control/Mixer.h"
+
+using namespace Dae;
+
+EffectivenessEstimator::EffectivenessEstimator(const std::string& key)
+    : Configurable(key) {
+    configure();
+    reset();
+}
+
+void EffectivenessEstimator::configure(void) {
+    if (FORGETTING.get() <= 0 || FORGETTING.get() > 1) {
+        warn("Effectiveness forgetting factor must be from 0 to 1");
+    }
+
+    for (size_t axis = 0; axis < 3; axis++) {
+        for (size_t ch = 0; ch < CHANNELS; ch++) {
+            const double weight =
+                ch == Mixer::DEFAULT_CHANNELS[axis] ? 1.0 : 0.0;
+            inputs(axis, ch) = confNum(Mixer::channelKey(ch, axis), weight);
+        }
+    }
+}
+
+void EffectivenessEstimator::reset(void) {
+    for (Estimator& estimator : estimators) {
+        estimator.reset(Estimator::Parameters::zero(), INITIAL_VARIANCE.get());
+    }
+    started = false;
+}
+
+void EffectivenessEstimator::update(const Vector3& gyro,
+                                    const Control& control, double dt) {
+    if (!started || dt <= 0) {
+        previous = gyro;
+        started  = true;
+        return;
+    }
+
+    const Vector3 input  = inputs * Vector<CHANNELS>::view(control.pwm);
+    const double  lambda = FORGETTING.get();
+    const double  cap    = MAX_VARIANCE.get();
+
+    for (size_t axis = 0; axis < 3; axis++) {
+        const Estimator::Regressor phi = {{previous[axis], input[axis], 1.0}};
+        estimators[axis].update(phi, (gyro[axis] - previous[axis]) / dt,
+                                lambda, cap);
+    }
+    previous = gyro;
+}
+
+void EffectivenessEstimator::update(const Telemetry& telemetry,
+                                    const Control&   control) {
+    const double dt = telemetry.timestamp - lastTime;
+    lastTime        = telemetry.timestamp;
+    update(Vector3::view(telemetry.gyro), control, dt);
+}
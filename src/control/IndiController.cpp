@@ -0,0 +1,117 @@
+/**
+ * @file IndiController.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the IndiController class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "common/Logging.h"
+#include "control/IndiController.h"
+#include "control/Mixer.h"
+
+using namespace Dae;
+
+/// @brief Damping ratio of the filters, Butterworth.
+static constexpr double FILTER_DAMPING = M_SQRT1_2;
+
+IndiController::IndiController(const std::string& key) : Configurable(key) {
+    configure();
+    reset();
+}
+
+void IndiController::configure(void) {
+    if (CUTOFF.get() <= 0) warn("INDI filter cutoff must be positive");
+
+    for (size_t axis = 0; axis < 3; axis++) {
+        const std::string prefix = std::string(Mixer::AXIS_NAMES[axis]) + "_";
+
+        rateGain[axis]   = confNum(prefix + "gain", 20.0);
+        configured[axis] = confNum(prefix + "effectiveness", 20.0);
+        if (configured[axis] <= 0) {
+            warn("INDI %s effectiveness must be positive",
+                 Mixer::AXIS_NAMES[axis]);
+        }
+
+        // Only a new configured effectiveness replaces one that was set
+        if (changed(prefix + "effectiveness")) gains[axis] = configured[axis];
+
+        for (size_t ch = 0; ch < CHANNELS; ch++) {
+            const double weight =
+                ch == Mixer::DEFAULT_CHANNELS[axis] ? 1.0 : 0.0;
+            mix(axis, ch) = confNum(Mixer::channelKey(ch, axis), weight);
+        }
+    }
+
+    unmix = mix.transpose();
+    for (size_t ch = 0; ch < CHANNELS; ch++) {
+        mixed[ch] = unmix(ch, 0) != 0 || unmix(ch, 1) != 0 ||
+                    unmix(ch, 2) != 0;
+    }
+}
+
+void IndiController::reset(void) {
+    gains         = configured;
+    accelerations = Vector3::zero();
+    inputRates    = Vector3::zero();
+    started       = false;
+}
+
+void IndiController::setEffectiveness(const Vector3& value) {
+    for (size_t axis = 0; axis < 3; axis++) {
+        // A vanishing effectiveness would ask for an unbounded increment
+        if (value[axis] > 0) gains[axis] = value[axis];
+    }
+}
+
+void IndiController::update(const Vector3& setpoint, const Vector3& gyro,
+                            double dt, Control& control) {
+    const Vector3 applied = mix * Vector<CHANNELS>::view(control.pwm);
+
+    if (!started || dt <= 0) {
+        if (!started) {
+            rates   = gyro;
+            inputs  = applied;
+            outputs = applied;
+            started = true;
+        }
+        return;
+    }
+
+    // Backward Euler step of x'' = wn^2 (u - x) - 2 zeta wn x', the same for
+    // the gyro and the input, so both are delayed alike
+    const double wn    = 2 * M_PI * CUTOFF.get();
+    const double gain  = dt * wn * wn;
+    const double scale = 1 / (1 + 2 * FILTER_DAMPING * wn * dt + dt * gain);
+
+    for (size_t axis = 0; axis < 3; axis++) {
+        accelerations[axis] =
+            (accelerations[axis] + gain * (gyro[axis] - rates[axis])) * scale;
+        rates[axis] += dt * accelerations[axis];
+
+        inputRates[axis] =
+            (inputRates[axis] + gain * (applied[axis] - inputs[axis])) * scale;
+        inputs[axis] += dt * inputRates[axis];
+
+        const double nu = rateGain[axis] * (setpoint[axis] - gyro[axis]);
+        outputs[axis]   = std::clamp(
+            inputs[axis] + (nu - accelerations[axis]) / gains[axis], -1.0, 1.0);
+    }
+
+    const Vector<CHANNELS> pwm = unmix * outputs;
+    for (size_t ch = 0; ch < CHANNELS; ch++) {
+        if (mixed[ch]) control.pwm[ch] = std::clamp(pwm[ch], -1.0, 1.0);
+    }
+}
+
+void IndiController::update(const Vector3& setpoint, const Telemetry& telemetry,
+                            Control& control) {
+    const double dt = telemetry.timestamp - lastTime;
+    lastTime        = telemetry.timestamp;
+    update(setpoint, Vector3::view(telemetry.gyro), dt, control);
+}
@@ -0,0 +1,184 @@
+/**
+ * @file Mixer.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the Mixer class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "common/Logging.h"
+#include "control/Mixer.h"
+
+using namespace Dae;
+
+namespace {
+
+/**
+ * @brief One weight of a preset mixing matrix.
+ */
+struct Weight {
+    /// @brief Channel.
+    size_t channel;
+    /// @brief Demand axis.
+    Mixer::Axis axis;
+    /// @brief The weight.
+    double weight;
+};
+
+/**
+ * @brief A preset airframe.
+ */
+struct Preset {
+    /// @brief Config 'airframe' name.
+    const char* name;
+    /// @brief Its weights, all others are zero.
+    std::vector<Weight> weights;
+};
+
+/**
+ * @brief Get the preset airframes.
+ */
+const std::vector<Preset>& presets(void) {
+    static const std::vector<Preset> list = {
+        {"aileron",
+         {{0, Mixer::AX_ROLL, 1},
+          {1, Mixer::AX_PITCH, 1},
+          {2, Mixer::AX_THROTTLE, 2},
+          {3, Mixer::AX_YAW, 1}}},
+        {"elevon",
+         {{0, Mixer::AX_ROLL, 1},
+          {0, Mixer::AX_PITCH, 1},
+          {1, Mixer::AX_ROLL, -1},
+          {1, Mixer::AX_PITCH, 1},
+          {2, Mixer::AX_THROTTLE, 2},
+          {3, Mixer::AX_YAW, 1}}},
+        {"vtail",
+         {{0, Mixer::AX_ROLL, 1},
+          {1, Mixer::AX_PITCH, 1},
+          {1, Mixer::AX_YAW, 1},
+          {2, Mixer::AX_THROTTLE, 2},
+          {3, Mixer::AX_PITCH, 1},
+          {3, Mixer::AX_YAW, -1}}},
+        {"flaperon",
+         {{0, Mixer::AX_ROLL, 1},
+          {1, Mixer::AX_PITCH, 1},
+          {2, Mixer::AX_THROTTLE, 2},
+          {3, Mixer::AX_YAW, 1},
+          {4, Mixer::AX_ROLL, -1}}},
+        {"twin",
+         {{0, Mixer::AX_ROLL, 1},
+          {1, Mixer::AX_PITCH, 1},
+          {2, Mixer::AX_THROTTLE, 2},
+          {2, Mixer::AX_YAW, 0.5},
+          {3, Mixer::AX_YAW, 1},
+          {4, Mixer::AX_THROTTLE, 2},
+          {4, Mixer::AX_YAW, -0.5}}},
+    };
+    return list;
+}
+
+} // namespace
+
+Mixer::Mixer(const std::string& key) : Configurable(key) { configure(); }
+
+void Mixer::configure(void) {
+    weights = Weights::zero();
+
+    const std::string airframe = confStr("airframe", "none");
+    if (airframe != "none") {
+        auto preset = std::find_if(
+            presets().begin(), presets().end(),
+            [&](const Preset& p) { return airframe == p.name; });
+
+        if (preset == presets().end()) {
+            warn("Unknown mixer airframe '%s'", airframe.c_str());
+        } else {
+            for (const Weight& w : preset->weights) {
+                weights(w.channel, w.axis) = w.weight;
+            }
+        }
+    }
+
+    for (size_t ch = 0; ch < CHANNELS; ch++) {
+        const std::string prefix = "ch" + std::to_string(ch) + "_";
+
+        for (size_t axis = 0; axis < AXES; axis++) {
+            weights(ch, axis) =
+                confNum(channelKey(ch, axis), weights(ch, axis));
+        }
+
+        // Throttle channels are centred on zero throttle
+        const double trim = weights(ch, AX_THROTTLE) != 0 ? -1.0 : 0.0;
+        trims[ch]         = confNum(prefix + "trim", trim);
+        expos[ch]         = confNum(prefix + "expo", 0.0);
+        mins[ch]          = confNum(prefix + "min", -1.0);
+        maxs[ch]          = confNum(prefix + "max", 1.0);
+
+        // Mirrored about the centre, so a reversed throttle runs from 1 down
+        if (confNum(prefix + "reverse", 0.0) != 0) {
+            for (size_t axis = 0; axis < AXES; axis++) {
+                weights(ch, axis) = -weights(ch, axis);
+            }
+            trims[ch] = -trims[ch];
+        }
+        throttles[ch] = weights(ch, AX_THROTTLE);
+
+        if (expos[ch] < 0 || expos[ch] > 1) {
+            warn("Mixer channel %zu expo must be from 0 to 1", ch);
+            expos[ch] = std::clamp(expos[ch], 0.0, 1.0);
+        }
+        if (mins[ch] > maxs[ch]) {
+            warn("Mixer channel %zu limits are reversed", ch);
+        }
+    }
+}
+
+std::string Mixer::channelKey(size_t channel, size_t axis) {
+    return "ch" + std::to_string(channel) + "_" + AXIS_NAMES[axis];
+}
+
+void Mixer::mix(const Demand& demand, Control& control) const {
+    // Expo only shapes the surface demands, the throttle is added after
+    Demand surface       = demand;
+    surface[AX_THROTTLE] = 0;
+
+    const double           throttle   = demand[AX_THROTTLE];
+    const Vector<CHANNELS> deflection = weights * surface;
+
+    size_t ch = 0;
+
+#ifdef DAE_MATH_SSE2
+    const __m128d one = _mm_set1_pd(1.0);
+    const __m128d thr = _mm_set1_pd(throttle);
+    for (; ch + 2 <= CHANNELS; ch += 2) {
+        const __m128d x = _mm_loadu_pd(&deflection[ch]);
+        const __m128d e = _mm_loadu_pd(expos + ch);
+
+        // trim + t * throttle + x * (1 - e + e * x^2)
+        const __m128d curve = _mm_add_pd(
+            _mm_sub_pd(one, e), _mm_mul_pd(e, _mm_mul_pd(x, x)));
+        const __m128d base = _mm_add_pd(
+            _mm_loadu_pd(trims + ch),
+            _mm_mul_pd(_mm_loadu_pd(throttles + ch), thr));
+        const __m128d out = _mm_add_pd(base, _mm_mul_pd(x, curve));
+
+        _mm_storeu_pd(control.pwm + ch,
+                      _mm_min_pd(_mm_max_pd(out, _mm_loadu_pd(mins + ch)),
+                                 _mm_loadu_pd(maxs + ch)));
+    }
+#endif
+
+    for (; ch < CHANNELS; ch++) {
+        const double x    = deflection[ch];
+        const double e    = expos[ch];
+        const double base = trims[ch] + throttles[ch] * throttle;
+        const double out  = base + x * ((1 - e) + e * (x * x));
+
+        control.pwm[ch] = std::min(std::max(out, mins[ch]), maxs[ch]);
+    }
+}
@@ -0,0 +1,89 @@
+/**
+ * @file MracController.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the MracController class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <algorithm>
+#include <string>
+
+#include "common/Logging.h"
+#include "control/Mixer.h"
+#include "control/MracController.h"
+
+using namespace Dae;
+
+MracController::MracController(const std::string& key) : Configurable(key) {
+    configure();
+    reset();
+}
+
+void MracController::configure(void) {
+    for (size_t axis = 0; axis < 3; axis++) {
+        const std::string prefix = std::string(Mixer::AXIS_NAMES[axis]) + "_";
+
+        bandwidth[axis]     = confNum(prefix + "bandwidth", 10.0);
+        effectiveness[axis] = confNum(prefix + "effectiveness", 20.0);
+        adaptation[axis]    = confNum(prefix + "adaptation", 2.0);
+        limit[axis]         = confNum(prefix + "gain_limit", 2.0);
+
+        if (bandwidth[axis] <= 0 || effectiveness[axis] <= 0) {
+            warn("MRAC %s bandwidth and effectiveness must be positive",
+                 Mixer::AXIS_NAMES[axis]);
+        }
+        if (adaptation[axis] < 0 || limit[axis] <= 0) {
+            warn("MRAC %s adaptation and gain limit must be positive",
+                 Mixer::AXIS_NAMES[axis]);
+        }
+
+        // Keep what has been adapted, projected onto the new bounds
+        kx[axis] = std::clamp(kx[axis], -limit[axis], limit[axis]);
+        kr[axis] = std::clamp(kr[axis], -limit[axis], limit[axis]);
+        kc[axis] = std::clamp(kc[axis], -limit[axis], limit[axis]);
+    }
+}
+
+void MracController::reset(const Vector3& rate) {
+    // The ideal gains of an axis with no damping and the expected
+    // effectiveness
+    for (size_t axis = 0; axis < 3; axis++) {
+        const double gain = bandwidth[axis] / effectiveness[axis];
+        kx[axis]          = std::clamp(-gain, -limit[axis], limit[axis]);
+        kr[axis]          = std::clamp(gain, -limit[axis], limit[axis]);
+        kc[axis]          = 0;
+        saturated[axis]   = false;
+    }
+    model   = rate;
+    outputs = Vector3::zero();
+}
+
+const Vector3& MracController::update(const Vector3& setpoint,
+                                      const Vector3& rate, double dt) {
+    const Vector3 error = rate - model;
+
+    for (size_t axis = 0; axis < 3; axis++) {
+        // Adapt, unless the error came from a saturated output, then
+        // project back onto the bounds
+        if (!saturated[axis]) {
+            const double step = adaptation[axis] * error[axis] * dt;
+            const double l    = limit[axis];
+
+            kx[axis] = std::clamp(kx[axis] - step * rate[axis], -l, l);
+            kr[axis] = std::clamp(kr[axis] - step * setpoint[axis], -l, l);
+            kc[axis] = std::clamp(kc[axis] - step, -l, l);
+        }
+
+        const double u =
+            kx[axis] * rate[axis] + kr[axis] * setpoint[axis] + kc[axis];
+        outputs[axis]   = std::clamp(u, -1.0, 1.0);
+        saturated[axis] = outputs[axis] != u;
+
+        // The reference model, stable for any time step
+        const double alpha = std::min(1.0, bandwidth[axis] * dt);
+        model[axis]       += alpha * (setpoint[axis] - model[axis]);
+    }
+    return outputs;
+}
@@ -0,0 +1,217 @@
+/**
+ * @file PidBank.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the PidGains and PidBank classes.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <algorithm>
+#include <cmath>
+
+#include "common/Logging.h"
+#include "common/Matrix.h" // DAE_MATH_SSE2
+#include "control/PidBank.h"
+
+using namespace Dae;
+
+/// @brief Number of PWM channels in a control signal.
+static constexpr int CHANNELS =
+    sizeof(PhysicsBackend::Control::pwm) / sizeof(double);
+
+PidGains::PidGains(const std::string& key, bool* stale)
+    : Configurable(key), stale(stale) {
+    onChange<PidGains>({"kp", "ki", "kd", "kff", "d_cutoff", "i_limit",
+                        "out_min", "out_max", "kt"},
+                       &PidGains::touch);
+    configure();
+}
+
+void PidGains::configure(void) {
+    if (OUT_MIN.get() > OUT_MAX.get()) {
+        warn("PID '%s' output limits are reversed", key.c_str());
+    }
+    if (I_LIMIT.get() < 0 || D_CUTOFF.get() < 0 || KT.get() < 0) {
+        warn("PID '%s' limits and filter must not be negative", key.c_str());
+    }
+    touch();
+}
+
+void PidGains::touch(void) {
+    if (stale != nullptr) *stale = true;
+}
+
+int PidBank::add(const std::string& key, int source, int channel) {
+    if (count == CAPACITY) return ST_FULL;
+    if (channel < NONE || channel >= CHANNELS) return ST_BAD_CHANNEL;
+
+    // Layer of the new loop, one deeper than its source
+    size_t layer = 0;
+    if (source != NONE) {
+        if (source < 0 || static_cast<size_t>(source) >= count) {
+            return ST_BAD_SOURCE;
+        }
+        while (layerEnds[layer] <= static_cast<size_t>(source)) {
+            layer++;
+        }
+        layer++;
+    }
+
+    // Layers stay contiguous, so only the last one can grow
+    if (layers > 0 && layer + 1 < layers) return ST_BAD_SOURCE;
+    if (layer == layers) layers++;
+
+    // A layer's setpoints are copied in one go while its sources run on
+    // from the first one
+    const size_t start = layer > 0 ? layerEnds[layer - 1] : 0;
+    if (count == start) {
+        firstSources[layer] = source;
+    } else if (firstSources[layer] != NONE &&
+               static_cast<size_t>(source) !=
+                   static_cast<size_t>(firstSources[layer]) + count - start) {
+        firstSources[layer] = NONE;
+    }
+
+    sources[count]   = source;
+    channels[count]  = channel;
+    layerEnds[layer] = count + 1;
+    handles.push_back(std::make_unique<PidGains>(key, &stale));
+    count++;
+
+    stale = true;
+    return ST_GOOD;
+}
+
+void PidBank::evaluate(double dt) {
+    // No time has passed, and the derivative filter would divide by zero
+    if (dt <= 0) return;
+
+    if (stale || dt != step) refresh(dt);
+    if (fresh) {
+        std::copy(measurements, measurements + count, previous);
+        fresh = false;
+    }
+
+    // Every loop past the first layer has a source. A layer whose sources
+    // are consecutive reads their outputs in place, otherwise they are
+    // gathered into the setpoints before it is evaluated
+    size_t begin = 0;
+    for (size_t layer = 0; layer < layers; layer++) {
+        const size_t  end       = layerEnds[layer];
+        const int     first     = firstSources[layer];
+        const double* reference = setpoints;
+        if (layer > 0 && first != NONE) {
+            reference = outputs + first - begin;
+        } else if (layer > 0) {
+            for (size_t i = begin; i < end; i++) {
+                setpoints[i] = outputs[sources[i]];
+            }
+        }
+
+        evaluate(begin, end, reference);
+        begin = end;
+    }
+}
+
+void PidBank::write(Control& control) const {
+    for (size_t i = 0; i < count; i++) {
+        if (channels[i] != NONE) control.pwm[channels[i]] = outputs[i];
+    }
+}
+
+void PidBank::reset(void) {
+    std::fill(integrals, integrals + CAPACITY, 0.0);
+    std::fill(derivatives, derivatives + CAPACITY, 0.0);
+    std::fill(outputs, outputs + CAPACITY, 0.0);
+    fresh = true;
+}
+
+void PidBank::refresh(double dt) {
+    for (size_t i = 0; i < count; i++) {
+        const PidGains& gains = *handles[i];
+        const double    fc    = gains.D_CUTOFF.get();
+        const double    tau   = fc > 0 ? 1 / (2 * M_PI * fc) : 0.0;
+
+        kp[i]     = gains.KP.get();
+        ki[i]     = gains.KI.get();
+        kd[i]     = gains.KD.get();
+        kff[i]    = gains.KFF.get();
+        kt[i]     = gains.KT.get();
+        filter[i] = 1 / (dt + tau);
+        iLimit[i] = gains.I_LIMIT.get();
+        outMin[i] = gains.OUT_MIN.get();
+        outMax[i] = gains.OUT_MAX.get();
+    }
+    step  = dt;
+    stale = false;
+}
+
+void PidBank::evaluate(size_t begin, size_t end, const double* reference) {
+    const double dt = step;
+    size_t       i  = begin;
+
+#ifdef DAE_MATH_SSE2
+    // Unaligned loads, a layer may start on an odd loop
+    const __m128d span = _mm_set1_pd(dt);
+    for (; i + 2 <= end; i += 2) {
+        const __m128d r = _mm_loadu_pd(reference + i);
+        const __m128d y = _mm_loadu_pd(measurements + i);
+        const __m128d e = _mm_sub_pd(r, y);
+
+        // First order filter of the measurement rate, without dividing by dt
+        const __m128d dy    = _mm_sub_pd(y, _mm_loadu_pd(previous + i));
+        const __m128d d0    = _mm_loadu_pd(derivatives + i);
+        const __m128d slope = _mm_add_pd(dy, _mm_mul_pd(span, d0));
+        const __m128d d =
+            _mm_sub_pd(d0, _mm_mul_pd(slope, _mm_loadu_pd(filter + i)));
+
+        // The terms without the setpoint first, so a cascaded loop only
+        // waits a multiply and an add on the loop before it
+        const __m128d p        = _mm_loadu_pd(kp + i);
+        __m128d       integral = _mm_loadu_pd(integrals + i);
+        __m128d u = _mm_add_pd(integral, _mm_mul_pd(_mm_loadu_pd(kd + i), d));
+        u         = _mm_sub_pd(u, _mm_mul_pd(p, y));
+        u = _mm_add_pd(u, _mm_mul_pd(_mm_add_pd(p, _mm_loadu_pd(kff + i)), r));
+
+        const __m128d out = _mm_min_pd(_mm_max_pd(u, _mm_loadu_pd(outMin + i)),
+                                       _mm_loadu_pd(outMax + i));
+
+        // Back-calculation bleeds the integral while the output saturates
+        const __m128d rate =
+            _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(ki + i), e),
+                       _mm_mul_pd(_mm_loadu_pd(kt + i), _mm_sub_pd(out, u)));
+        const __m128d limit = _mm_loadu_pd(iLimit + i);
+        integral = _mm_add_pd(integral, _mm_mul_pd(rate, span));
+        integral = _mm_min_pd(
+            _mm_max_pd(integral, _mm_sub_pd(_mm_setzero_pd(), limit)), limit);
+
+        _mm_storeu_pd(outputs + i, out);
+        _mm_storeu_pd(integrals + i, integral);
+        _mm_storeu_pd(derivatives + i, d);
+        _mm_storeu_pd(previous + i, y);
+    }
+#endif
+
+    for (; i < end; i++) {
+        const double r = reference[i];
+        const double y = measurements[i];
+        const double e = r - y;
+
+        const double dy = y - previous[i];
+        const double d =
+            derivatives[i] - (dy + dt * derivatives[i]) * filter[i];
+
+        const double u   = integrals[i] + kd[i] * d - kp[i] * y +
+                           (kp[i] + kff[i]) * r;
+        const double out = std::min(std::max(u, outMin[i]), outMax[i]);
+
+        const double rate     = ki[i] * e + kt[i] * (out - u);
+        const double integral = integrals[i] + rate * dt;
+
+        outputs[i]     = out;
+        integrals[i]   = std::min(std::max(integral, -iLimit[i]), iLimit[i]);
+        derivatives[i] = d;
+        previous[i]    = y;
+    }
+}
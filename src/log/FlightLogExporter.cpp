@@ -0,0 +1,176 @@
+/**
+ * @file FlightLogExporter.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the FlightLogExporter class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <cerrno>
+#include <cstring>
+
+#include "common/Logging.h"
+#include "log/FlightLogExporter.h"
+
+using namespace Dae;
+
+/// @brief Number of fields in a decoded compressed telemetry frame.
+static constexpr size_t TELEMETRY_FIELDS =
+    sizeof(PhysicsBackend::Telemetry) / sizeof(double);
+
+static_assert(sizeof(PhysicsBackend::Telemetry) ==
+                  TELEMETRY_FIELDS * sizeof(double),
+              "Telemetry frames must be made of doubles only");
+
+/**
+ * @brief Split a comma separated list of labels.
+ */
+static std::vector<std::string> splitLabels(const std::string& labels) {
+    std::vector<std::string> out;
+    size_t                   start = 0;
+    while (true) {
+        const size_t end = labels.find(',', start);
+        out.push_back(labels.substr(start, end - start));
+        if (end == std::string::npos) return out;
+        start = end + 1;
+    }
+}
+
+int FlightLogExporter::convert(const std::string& filepath,
+                               const std::string& dir, bool columnar) {
+    records.clear();
+    skippedBytes = 0;
+    lost         = 0;
+
+    FlightLogReader reader;
+    if (reader.open(filepath) != FlightLogReader::ST_GOOD) {
+        return ST_FOPEN_FAIL;
+    }
+
+    std::map<uint8_t, Output> outputs;
+    FlightLogReader::Record   record;
+    bool                      compressed = false;
+    int                       status     = ST_GOOD;
+
+    while (reader.next(record)) {
+        const FlightLogReader::Message& msg = *record.message;
+
+        // The chunks are only meaningful once whole blocks are decoded
+        if (msg.name == "TELZ") {
+            compressed = true;
+            continue;
+        }
+
+        auto it = outputs.find(msg.id);
+        if (it == outputs.end()) {
+            it = outputs.emplace(msg.id, Output()).first;
+            if (!open(it->second, msg, dir, columnar)) {
+                status = ST_OUTPUT_FAIL;
+                break;
+            }
+        }
+
+        write(it->second, record, columnar);
+        records[msg.name]++;
+    }
+
+    if (status == ST_GOOD && compressed) {
+        std::vector<PhysicsBackend::Telemetry> frames;
+        lost = reader.telemetry(frames);
+
+        const FlightLogReader::Message msg{
+            FlightLog::MSG_TELEM_BLOCK,
+            sizeof(FlightLog::Header) + sizeof(PhysicsBackend::Telemetry),
+            "TELZ", std::string(TELEMETRY_FIELDS, 'd'),
+            splitLabels(TELEMETRY_LABELS)};
+
+        Output& out = outputs[msg.id];
+        if (open(out, msg, dir, columnar)) {
+            FlightLogReader::Record row{
+                &msg, std::vector<double>(TELEMETRY_FIELDS),
+                std::vector<std::string>(TELEMETRY_FIELDS), nullptr};
+
+            for (const PhysicsBackend::Telemetry& frame : frames) {
+                memcpy(row.values.data(), &frame, sizeof(frame));
+                write(out, row, columnar);
+            }
+            records[msg.name] = frames.size();
+        } else {
+            status = ST_OUTPUT_FAIL;
+        }
+    }
+
+    for (auto& [id, out] : outputs) {
+        close(out);
+    }
+
+    skippedBytes = reader.skipped();
+    return status;
+}
+
+bool FlightLogExporter::open(Output& out, const FlightLogReader::Message& msg,
+                             const std::string& dir, bool columnar) {
+    if (!columnar) {
+        const std::string path = dir + "/" + msg.name + ".csv";
+        out.csv                = fopen(path.c_str(), "w");
+        if (out.csv == nullptr) {
+            stl_error(errno, "Failed to open '%s'", path.c_str());
+            return false;
+        }
+
+        for (size_t i = 0; i < msg.labels.size(); i++) {
+            fprintf(out.csv, "%s%s", i == 0 ? "" : ",", msg.labels[i].c_str());
+        }
+        fprintf(out.csv, "\n");
+        return true;
+    }
+
+    out.columns.assign(msg.format.size(), nullptr);
+    for (size_t i = 0; i < msg.format.size(); i++) {
+        if (FlightLog::fieldSize(msg.format[i]) == 0) continue;
+        if (msg.format[i] == 'n' || msg.format[i] == 'N' ||
+            msg.format[i] == 'Z') {
+            continue;
+        }
+
+        const std::string path =
+            dir + "/" + msg.name + "." + msg.labels[i] + ".f64";
+        out.columns[i] = fopen(path.c_str(), "wb");
+        if (out.columns[i] == nullptr) {
+            stl_error(errno, "Failed to open '%s'", path.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+void FlightLogExporter::write(Output&                        out,
+                              const FlightLogReader::Record& record,
+                              bool                           columnar) {
+    const FlightLogReader::Message& msg = *record.message;
+
+    for (size_t i = 0; i < msg.format.size(); i++) {
+        const bool text = !record.strings[i].empty() || msg.format[i] == 'n' ||
+                          msg.format[i] == 'N' || msg.format[i] == 'Z';
+        if (columnar) {
+            if (out.columns[i] != nullptr) {
+                fwrite(&record.values[i], sizeof(double), 1, out.columns[i]);
+            }
+        } else if (text) {
+            fprintf(out.csv, "%s\"%s\"", i == 0 ? "" : ",",
+                    record.strings[i].c_str());
+        } else {
+            fprintf(out.csv, "%s%.17g", i == 0 ? "" : ",", record.values[i]);
+        }
+    }
+    if (!columnar) fprintf(out.csv, "\n");
+}
+
+void FlightLogExporter::close(Output& out) {
+    if (out.csv != nullptr) fclose(out.csv);
+    for (FILE* column : out.columns) {
+        if (column != nullptr) fclose(column);
+    }
+    out = Output();
+}
@@ -0,0 +1,249 @@
+/**
+ * @file FlightLogReader.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the FlightLogReader class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "common/Logging.h"
+#include "log/FlightLogReader.h"
+#include "log/TelemetryCompressor.h"
+
+using namespace Dae;
+
+/**
+ * @brief Read a fixed size, not necessarily NULL terminated, string field.
+ */
+static std::string readField(const char* field, size_t size) {
+    size_t len = 0;
+    while (len < size && field[len] != '\0') {
+        len++;
+    }
+    return std::string(field, len);
+}
+
+/**
+ * @brief Read a value of type T from a payload.
+ */
+template <typename T> static double readValue(const uint8_t* in) {
+    T value;
+    memcpy(&value, in, sizeof(T));
+    return static_cast<double>(value);
+}
+
+int FlightLogReader::open(const std::string& filepath) {
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file.is_open()) {
+        stl_warn(errno, "Failed to open flight log '%s'", filepath.c_str());
+        return ST_FOPEN_FAIL;
+    }
+
+    data.assign(std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>());
+    offset       = 0;
+    skippedBytes = 0;
+    messages.assign(UINT8_MAX + 1, Message{});
+
+    // The FMT layout is fixed, so FMT records can always be decoded
+    Message& fmt = messages[FlightLog::MSG_FORMAT];
+    fmt.id       = FlightLog::MSG_FORMAT;
+    fmt.length   = sizeof(FlightLog::Header) + sizeof(FlightLog::Format);
+    fmt.name     = "FMT";
+    fmt.format   = "BBnNZ";
+    fmt.labels   = {"Type", "Length", "Name", "Format", "Columns"};
+
+    return ST_GOOD;
+}
+
+bool FlightLogReader::next(Record& record) {
+    const size_t header = sizeof(FlightLog::Header);
+
+    while (offset + header <= data.size()) {
+        const uint8_t* in = data.data() + offset;
+
+        if (in[0] != FlightLog::HEAD_BYTE1 || in[1] != FlightLog::HEAD_BYTE2) {
+            offset++;
+            skippedBytes++;
+            continue;
+        }
+
+        const Message& msg = messages[in[2]];
+        if (msg.length == 0 || offset + msg.length > data.size()) {
+            // Unknown or truncated record, resynchronise on the next header
+            offset++;
+            skippedBytes++;
+            continue;
+        }
+
+        if (msg.id == FlightLog::MSG_FORMAT) learn(in + header);
+
+        decode(msg, in + header, record);
+        record.payload = in + header;
+        offset += msg.length;
+        return true;
+    }
+
+    return false;
+}
+
+size_t FlightLogReader::telemetry(std::vector<PhysicsBackend::Telemetry>& out) {
+    const size_t resume  = offset;
+    const size_t skipped = skippedBytes;
+    offset               = 0;
+
+    out.clear();
+    std::vector<PhysicsBackend::Telemetry> frames;
+    std::vector<uint8_t>                   block;
+    FlightLog::TelemBlock                  chunk;
+    uint32_t                               current  = 0;
+    uint32_t                               orphan   = UINT32_MAX;
+    uint16_t                               expected = 0;
+    size_t                                 lost     = 0;
+
+    Record record;
+    while (next(record)) {
+        const Message& msg = *record.message;
+        if (msg.name != "TELZ" ||
+            msg.length != sizeof(FlightLog::Header) + sizeof(chunk)) {
+            continue;
+        }
+        memcpy(&chunk, record.payload, sizeof(chunk));
+
+        // A block in progress is lost if its next chunk never comes, and one
+        // is lost if its first chunk is missing
+        if (chunk.block != current || chunk.chunk != expected) {
+            if (expected != 0) {
+                lost++;
+                orphan = current;
+            }
+            expected = 0;
+            if (chunk.chunk != 0) {
+                if (chunk.block != orphan) lost++;
+                orphan = chunk.block;
+                continue;
+            }
+        }
+        if (chunk.chunk == 0) {
+            block.clear();
+            current = chunk.block;
+        }
+
+        block.insert(block.end(), chunk.data, chunk.data + sizeof(chunk.data));
+        expected = static_cast<uint16_t>(expected + 1);
+        if (expected < chunk.chunks) continue;
+
+        // Decode from an aligned copy
+        std::vector<uint64_t> words((block.size() + 7) / 8);
+        memcpy(words.data(), block.data(), block.size());
+        if (TelemetryCompressor::decode(words.data(), block.size(), frames) !=
+            0) {
+            out.insert(out.end(), frames.begin(), frames.end());
+        } else {
+            lost++;
+        }
+        expected = 0;
+    }
+    if (expected != 0) lost++;
+
+    offset       = resume;
+    skippedBytes = skipped;
+    return lost;
+}
+
+const FlightLogReader::Message* FlightLogReader::message(uint8_t id) const {
+    const Message& msg = messages[id];
+    return msg.length == 0 ? nullptr : &msg;
+}
+
+void FlightLogReader::decode(const Message& msg, const uint8_t* payload,
+                             Record& record) {
+    record.message = &msg;
+    record.values.assign(msg.format.size(), 0.0);
+    record.strings.assign(msg.format.size(), std::string());
+
+    for (size_t i = 0; i < msg.format.size(); i++) {
+        const char c = msg.format[i];
+        switch (c) {
+        case 'b':
+            record.values[i] = readValue<int8_t>(payload);
+            break;
+        case 'B':
+            record.values[i] = readValue<uint8_t>(payload);
+            break;
+        case 'h':
+            record.values[i] = readValue<int16_t>(payload);
+            break;
+        case 'H':
+            record.values[i] = readValue<uint16_t>(payload);
+            break;
+        case 'i':
+            record.values[i] = readValue<int32_t>(payload);
+            break;
+        case 'I':
+            record.values[i] = readValue<uint32_t>(payload);
+            break;
+        case 'q':
+            record.values[i] = readValue<int64_t>(payload);
+            break;
+        case 'Q':
+            record.values[i] = readValue<uint64_t>(payload);
+            break;
+        case 'f':
+            record.values[i] = readValue<float>(payload);
+            break;
+        case 'd':
+            record.values[i] = readValue<double>(payload);
+            break;
+        default:
+            record.strings[i] =
+                readField(reinterpret_cast<const char*>(payload),
+                          FlightLog::fieldSize(c));
+            break;
+        }
+        payload += FlightLog::fieldSize(c);
+    }
+}
+
+void FlightLogReader::learn(const uint8_t* payload) {
+    FlightLog::Format fmt;
+    memcpy(&fmt, payload, sizeof(fmt));
+
+    Message msg;
+    msg.id     = fmt.type;
+    msg.length = fmt.length;
+    msg.name   = readField(fmt.name, sizeof(fmt.name));
+    msg.format = readField(fmt.format, sizeof(fmt.format));
+
+    // Reject layouts that do not match their own length
+    const size_t size = FlightLog::payloadSize(msg.format.c_str());
+    if (size + sizeof(FlightLog::Header) != msg.length) {
+        warn("Flight log message '%s' has an invalid format", msg.name.c_str());
+        return;
+    }
+
+    const std::string labels = readField(fmt.labels, sizeof(fmt.labels));
+    size_t            start  = 0;
+    while (start <= labels.size()) {
+        size_t end = labels.find(',', start);
+        if (end == std::string::npos) end = labels.size();
+        msg.labels.push_back(labels.substr(start, end - start));
+        start = end + 1;
+    }
+
+    // Missing labels are named after their index
+    msg.labels.resize(msg.format.size());
+    for (size_t i = 0; i < msg.labels.size(); i++) {
+        if (msg.labels[i].empty()) {
+            msg.labels[i] = 'F';
+            msg.labels[i] += std::to_string(i);
+        }
+    }
+
+    if (msg.id != FlightLog::MSG_FORMAT) messages[msg.id] = std::move(msg);
+}
@@ -0,0 +1,294 @@
+/**
+ * @file FlightRecorder.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the FlightRecorder class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "common/Logging.h"
+#include "log/FlightRecorder.h"
+
+using namespace Dae;
+
+/**
+ * @brief Copy a string into a fixed size, not necessarily NULL terminated,
+ * field.
+ */
+template <size_t N> static void copyField(char (&field)[N], const char* str) {
+    const size_t len = strlen(str);
+    memset(field, 0, N);
+    memcpy(field, str, len < N ? len : N);
+}
+
+FlightRecorder::FlightRecorder(const std::string& key) : Configurable(key) {
+    configure();
+
+    define(FlightLog::MSG_FORMAT, "FMT", "BBnNZ",
+           "Type,Length,Name,Format,Columns");
+    define(FlightLog::MSG_TELEM_IMU, "TELI", "Qddddddd",
+           "TimeUS,T,GyrX,GyrY,GyrZ,AccX,AccY,AccZ");
+    define(FlightLog::MSG_TELEM_STATE, "TELS", "Qdddddddddd",
+           "TimeUS,PN,PE,PD,VN,VE,VD,Q1,Q2,Q3,Q4");
+    define(FlightLog::MSG_CONTROL_LOW, "CTLL", "Qffffffff",
+           "TimeUS,C1,C2,C3,C4,C5,C6,C7,C8");
+    define(FlightLog::MSG_CONTROL_HIGH, "CTLH", "Qffffffff",
+           "TimeUS,C9,C10,C11,C12,C13,C14,C15,C16");
+    define(FlightLog::MSG_LOOP, "LOOP", "QIffI",
+           "TimeUS,Frame,Period,Exec,Overruns");
+    define(FlightLog::MSG_TELEM_BLOCK, "TELZ", "IHHZZZ",
+           "Block,Chunk,Chunks,D1,D2,D3");
+}
+
+FlightRecorder::~FlightRecorder() { close(); }
+
+int FlightRecorder::define(uint8_t id, const char* name, const char* format,
+                           const char* labels) {
+    const size_t payload = FlightLog::payloadSize(format);
+    if (payload == 0 ||
+        payload + sizeof(FlightLog::Header) > UINT8_MAX ||
+        strlen(name) > sizeof(FlightLog::Format::name) ||
+        strlen(labels) > sizeof(FlightLog::Format::labels)) {
+        warn("Invalid flight log message definition '%s'", name);
+        return ST_BAD_FORMAT;
+    }
+
+    FlightLog::Format fmt;
+    fmt.type   = id;
+    fmt.length = static_cast<uint8_t>(payload + sizeof(FlightLog::Header));
+    copyField(fmt.name, name);
+    copyField(fmt.format, format);
+    copyField(fmt.labels, labels);
+
+    // Redefining a message replaces it
+    for (FlightLog::Format& existing : formats) {
+        if (existing.type == id) {
+            existing = fmt;
+            return ST_GOOD;
+        }
+    }
+
+    formats.push_back(fmt);
+    return ST_GOOD;
+}
+
+int FlightRecorder::open(const std::string& filepath) {
+    close();
+
+    // Allocate every buffer up front, the sizes are fixed until `close`
+    const size_t size = (BUFFER_SIZE + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+    buffers.resize(BUFFER_COUNT);
+    for (Buffer& buffer : buffers) {
+        void* data = nullptr;
+        if (posix_memalign(&data, PAGE_SIZE, size) != 0) {
+            error("Failed to allocate %zu byte flight log buffer", size);
+            freeAll();
+            return ST_ALLOC_FAIL;
+        }
+        buffer.data = static_cast<uint8_t*>(data);
+        freeBuffers.push(&buffer);
+    }
+    bufferSize = size;
+
+    // One block is written out as soon as it closes
+    compressing      = COMPRESS;
+    compressedBlocks = 0;
+    compressor.clear();
+    if (compressing) compressor.reserve(1);
+
+    fd = ::open(filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        stl_error(errno, "Failed to open flight log '%s'", filepath.c_str());
+        freeAll();
+        return ST_FOPEN_FAIL;
+    }
+
+    droppedCount.store(0, std::memory_order_relaxed);
+    writtenBytes.store(0, std::memory_order_relaxed);
+    running.store(true, std::memory_order_relaxed);
+    writer = std::thread([this] { run(); });
+
+    // Describe every message first
+    for (const FlightLog::Format& fmt : formats) {
+        write(FlightLog::MSG_FORMAT, fmt);
+    }
+
+    info("Flight log opened at '%s'", filepath.c_str());
+    return ST_GOOD;
+}
+
+void FlightRecorder::close(void) {
+    if (fd < 0) return;
+
+    if (compressing) {
+        compressor.flush();
+        writeBlocks();
+    }
+
+    // Hand over the partially filled buffer
+    if (current != nullptr && currentUsed > 0) {
+        current->used = currentUsed;
+        fullBuffers.push(current);
+        current = nullptr;
+    }
+
+    running.store(false, std::memory_order_relaxed);
+    writer.join();
+
+    ::close(fd);
+    fd = -1;
+
+    if (dropped() != 0) {
+        warn("Flight log dropped %" PRIu64 " records", dropped());
+    }
+
+    freeAll();
+}
+
+void FlightRecorder::writeTelemetry(uint64_t                         timeUs,
+                                    const PhysicsBackend::Telemetry& telem) {
+    if (compressing) {
+        compressor.append(telem);
+        if (compressor.blocks() != 0) writeBlocks();
+        return;
+    }
+
+    FlightLog::TelemImu imu;
+    imu.timeUs    = timeUs;
+    imu.timestamp = telem.timestamp;
+    memcpy(imu.gyro, telem.gyro, sizeof(imu.gyro));
+    memcpy(imu.accel, telem.accel, sizeof(imu.accel));
+    write(FlightLog::MSG_TELEM_IMU, imu);
+
+    FlightLog::TelemState state;
+    state.timeUs = timeUs;
+    memcpy(state.position, telem.position, sizeof(state.position));
+    memcpy(state.velocity, telem.velocity, sizeof(state.velocity));
+    memcpy(state.quaternion, telem.quaternion, sizeof(state.quaternion));
+    write(FlightLog::MSG_TELEM_STATE, state);
+}
+
+void FlightRecorder::writeControl(uint64_t                       timeUs,
+                                  const PhysicsBackend::Control& ctrl) {
+    FlightLog::ControlHalf half;
+    half.timeUs = timeUs;
+
+    for (int i = 0; i < 8; i++) {
+        half.pwm[i] = static_cast<float>(ctrl.pwm[i]);
+    }
+    write(FlightLog::MSG_CONTROL_LOW, half);
+
+    for (int i = 0; i < 8; i++) {
+        half.pwm[i] = static_cast<float>(ctrl.pwm[i + 8]);
+    }
+    write(FlightLog::MSG_CONTROL_HIGH, half);
+}
+
+void FlightRecorder::configure(void) {
+    // Only read by `open`, the open log keeps the sizes it was allocated with
+    BUFFER_SIZE = static_cast<size_t>(
+        confNum("buffer_size", static_cast<double>(BUFFER_SIZE)));
+    BUFFER_COUNT = static_cast<size_t>(
+        confNum("buffers", static_cast<double>(BUFFER_COUNT)));
+
+    if (BUFFER_COUNT < 2) BUFFER_COUNT = 2;
+    if (BUFFER_COUNT > MAX_BUFFERS) BUFFER_COUNT = MAX_BUFFERS;
+
+    COMPRESS = confNum("compress_telemetry", COMPRESS ? 1.0 : 0.0) != 0.0;
+}
+
+void FlightRecorder::writeBlocks(void) {
+    FlightLog::TelemBlock chunk;
+    const size_t          capacity = sizeof(chunk.data);
+
+    for (size_t b = 0; b < compressor.blocks(); b++) {
+        size_t         size;
+        const uint8_t* data =
+            static_cast<const uint8_t*>(compressor.blockData(b, size));
+
+        chunk.block  = compressedBlocks++;
+        chunk.chunks = static_cast<uint16_t>((size + capacity - 1) / capacity);
+        for (chunk.chunk = 0; chunk.chunk < chunk.chunks; chunk.chunk++) {
+            const size_t offset = chunk.chunk * capacity;
+            const size_t length = std::min(capacity, size - offset);
+            memcpy(chunk.data, data + offset, length);
+            memset(chunk.data + length, 0, capacity - length);
+            write(FlightLog::MSG_TELEM_BLOCK, chunk);
+        }
+    }
+
+    compressor.clear();
+}
+
+bool FlightRecorder::rotate(void) {
+    if (fd < 0) return false;
+
+    if (current != nullptr) {
+        if (currentUsed == 0) return false; // Record larger than a buffer
+
+        current->used = currentUsed;
+        fullBuffers.push(current);
+        current = nullptr;
+    }
+
+    currentUsed = 0;
+    return freeBuffers.pop(current);
+}
+
+void FlightRecorder::run(void) {
+    Buffer* buffer;
+
+    while (running.load(std::memory_order_relaxed)) {
+        if (fullBuffers.pop(buffer)) {
+            writeBuffer(*buffer);
+            freeBuffers.push(buffer);
+        } else {
+            std::this_thread::sleep_for(
+                std::chrono::duration<double>(WRITE_PERIOD.get()));
+        }
+    }
+
+    // Write out everything handed over before closing
+    while (fullBuffers.pop(buffer)) {
+        writeBuffer(*buffer);
+        freeBuffers.push(buffer);
+    }
+}
+
+void FlightRecorder::writeBuffer(const Buffer& buffer) {
+    size_t offset = 0;
+
+    while (offset < buffer.used) {
+        ssize_t n = ::write(fd, buffer.data + offset, buffer.used - offset);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            stl_error(errno, "Failed to write flight log");
+            return;
+        }
+        offset += static_cast<size_t>(n);
+    }
+
+    writtenBytes.fetch_add(buffer.used, std::memory_order_relaxed);
+}
+
+void FlightRecorder::freeAll(void) {
+    Buffer* buffer;
+    while (freeBuffers.pop(buffer)) {}
+    while (fullBuffers.pop(buffer)) {}
+
+    for (Buffer& b : buffers) {
+        free(b.data);
+    }
+    buffers.clear();
+
+    current     = nullptr;
+    currentUsed = 0;
+    bufferSize  = 0;
+}
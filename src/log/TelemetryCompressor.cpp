@@ -0,0 +1,161 @@
+/**
+ * @file TelemetryCompressor.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the TelemetryCompressor class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <algorithm>
+#include <cstring>
+
+#include "log/TelemetryCompressor.h"
+
+using namespace Dae;
+
+static_assert(sizeof(TelemetryCompressor::Telemetry) ==
+                  TelemetryCompressor::FIELDS * sizeof(double),
+              "Telemetry must only contain doubles");
+
+TelemetryCompressor::TelemetryCompressor(uint32_t blockFrames)
+    : blockFrames(std::max(blockFrames, 1u)), writer(words) {}
+
+void TelemetryCompressor::append(const Telemetry& telem) {
+    double fields[FIELDS];
+    memcpy(fields, &telem, sizeof(fields));
+
+    if (openFrames == 0) {
+        open();
+        openFirst = fields[0];
+    }
+
+    time.encode(writer, fields[0]);
+    for (size_t i = 1; i < FIELDS; i++) {
+        values[i - 1].encode(writer, fields[i]);
+    }
+
+    openLast = fields[0];
+    openFrames++;
+    frameCount++;
+
+    if (openFrames == blockFrames) flush();
+}
+
+void TelemetryCompressor::flush(void) {
+    if (openFrames == 0) return;
+
+    writer.flush();
+
+    const size_t payload = words.size() - closedWords - HEADER_WORDS;
+    uint64_t*    header  = words.data() + closedWords;
+    header[0] = openFrames | (static_cast<uint64_t>(payload) << 32);
+    header[1] = std::bit_cast<uint64_t>(openFirst);
+    header[2] = std::bit_cast<uint64_t>(openLast);
+
+    index.push_back({closedWords, frameCount - openFrames, openFrames,
+                     openFirst, openLast});
+
+    closedWords = words.size();
+    openFrames  = 0;
+}
+
+void TelemetryCompressor::clear(void) {
+    writer.flush();
+    words.clear();
+    index.clear();
+    cache.clear();
+
+    frameCount  = 0;
+    openFrames  = 0;
+    closedWords = 0;
+    cacheBlock  = SIZE_MAX;
+}
+
+void TelemetryCompressor::reserve(size_t blocks) {
+    const size_t bits = static_cast<size_t>(blockFrames) * FIELDS *
+                        MAX_FIELD_BITS;
+    words.reserve(words.size() + blocks * (HEADER_WORDS + bits / 64 + 1));
+    index.reserve(index.size() + blocks);
+}
+
+const void* TelemetryCompressor::blockData(size_t block, size_t& size) const {
+    const size_t end =
+        block + 1 < index.size() ? index[block + 1].offset : closedWords;
+    size = (end - index[block].offset) * sizeof(uint64_t);
+    return words.data() + index[block].offset;
+}
+
+size_t TelemetryCompressor::find(double timestamp) const {
+    // First block starting after the timestamp
+    auto after = std::upper_bound(
+        index.begin(), index.end(), timestamp,
+        [](double t, const BlockInfo& info) { return t < info.first; });
+
+    if (after == index.begin()) return index.size();
+    return static_cast<size_t>(after - index.begin()) - 1;
+}
+
+bool TelemetryCompressor::decodeBlock(size_t                  block,
+                                      std::vector<Telemetry>& out) const {
+    if (block >= index.size()) return false;
+
+    size_t      size;
+    const void* data = blockData(block, size);
+    return decode(data, size, out) != 0;
+}
+
+bool TelemetryCompressor::read(size_t frame, Telemetry& out) const {
+    if (frame >= frameCount - openFrames) return false;
+
+    // Blocks are full apart from ones closed early by `flush`
+    auto after = std::upper_bound(
+        index.begin(), index.end(), frame,
+        [](size_t f, const BlockInfo& info) { return f < info.firstFrame; });
+    const size_t block = static_cast<size_t>(after - index.begin()) - 1;
+
+    if (block != cacheBlock) {
+        if (!decodeBlock(block, cache)) return false;
+        cacheBlock = block;
+    }
+
+    out = cache[frame - index[block].firstFrame];
+    return true;
+}
+
+size_t TelemetryCompressor::decode(const void* data, size_t size,
+                                   std::vector<Telemetry>& out) {
+    out.clear();
+    if (size < HEADER_WORDS * sizeof(uint64_t)) return 0;
+
+    const uint64_t* header = static_cast<const uint64_t*>(data);
+    const uint32_t  frames = static_cast<uint32_t>(header[0]);
+    const size_t    words  = static_cast<size_t>(header[0] >> 32);
+    const size_t    total  = (HEADER_WORDS + words) * sizeof(uint64_t);
+    if (size < total || frames == 0) return 0;
+
+    Gorilla::BitReader  reader(header + HEADER_WORDS, words);
+    Gorilla::TimeCodec  time;
+    Gorilla::ValueCodec values[FIELDS - 1];
+
+    out.resize(frames);
+    for (Telemetry& telem : out) {
+        double fields[FIELDS];
+        fields[0] = time.decode(reader);
+        for (size_t i = 1; i < FIELDS; i++) {
+            fields[i] = values[i - 1].decode(reader);
+        }
+        memcpy(&telem, fields, sizeof(fields));
+    }
+
+    return total;
+}
+
+void TelemetryCompressor::open(void) {
+    words.resize(closedWords + HEADER_WORDS);
+
+    time = Gorilla::TimeCodec();
+    for (Gorilla::ValueCodec& codec : values) {
+        codec = Gorilla::ValueCodec();
+    }
+}
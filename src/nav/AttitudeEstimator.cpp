@@ -0,0 +1,90 @@
+/**
+ * @file AttitudeEstimator.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the AttitudeEstimator class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <cmath>
+
+#include "common/Logging.h"
+#include "nav/AttitudeEstimator.h"
+
+using namespace Dae;
+
+/// @brief Direction of the specific force at rest, up, in the Earth frame.
+static constexpr Vector3 UP = {{0, 0, -1}};
+
+/**
+ * @brief Get the rotation of a small rotation vector, by the series of the
+ * half angle sine and cosine. Accurate to 1e-9 for angles up to 0.1 rad,
+ * far more than one IMU sample turns through, without a branch at zero.
+ */
+static Quaternion smallRotation(const Vector3& angle) {
+    const double t2 = angle.squaredNorm();
+    const double t4 = t2 * t2;
+    const double c  = 1 - t2 / 8 + t4 / 384;
+    const double s  = 0.5 - t2 / 48 + t4 / 3840;
+    return {{c, angle[0] * s, angle[1] * s, angle[2] * s}};
+}
+
+AttitudeEstimator::AttitudeEstimator(const std::string& key)
+    : Configurable(key) {
+    configure();
+}
+
+void AttitudeEstimator::configure(void) {
+    if (KP.get() < 0 || KI.get() < 0) {
+        warn("Attitude estimator gains are negative, it will diverge");
+    }
+}
+
+void AttitudeEstimator::reset(const Vector3& accel, const Vector3& gyro) {
+    const double roll  = std::atan2(-accel[1], -accel[2]);
+    const double pitch = std::atan2(
+        accel[0], std::sqrt(accel[1] * accel[1] + accel[2] * accel[2]));
+
+    estimate = Quaternion::fromEuler(roll, pitch, 0);
+    integral = Vector3::zero();
+    previous = gyro;
+}
+
+void AttitudeEstimator::update(const Vector3& gyro, const Vector3& accel,
+                               double dt) {
+    // Measured and estimated up, in the body frame. The bias keeps a zero
+    // reading from dividing by zero, and gives no correction
+    const Vector3 measured = accel / std::sqrt(accel.squaredNorm() + 1e-12);
+    const Vector3 error    = measured.cross(estimate.unrotate(UP));
+    integral.mulAdd(error, KI.get() * dt);
+
+    // Angle increment from the rates at either end of the sample, with the
+    // two sample coning correction
+    Vector3 step = (previous + gyro) * (dt / 2);
+    step.mulAdd(previous.cross(gyro), dt * dt / 12);
+    previous = gyro;
+
+    step.mulAdd(error, KP.get() * dt);
+    step.mulAdd(integral, dt);
+
+    Quaternion   next  = estimate * smallRotation(step);
+    const double scale = 1 / std::sqrt(next.dot(next));
+    for (size_t i = 0; i < 4; i++) {
+        next[i] *= scale;
+    }
+    estimate = next;
+}
+
+void AttitudeEstimator::update(const Telemetry& telemetry) {
+    if (!started) {
+        reset(Vector3::view(telemetry.accel), Vector3::view(telemetry.gyro));
+        lastTime = telemetry.timestamp;
+        started  = true;
+        return;
+    }
+
+    const double dt = telemetry.timestamp - lastTime;
+    lastTime        = telemetry.timestamp;
+    update(Vector3::view(telemetry.gyro), Vector3::view(telemetry.accel), dt);
+}
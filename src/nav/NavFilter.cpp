@@ -0,0 +1,231 @@
+/**
+ * @file NavFilter.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the NavFilter class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <cmath>
+
+#include "common/Logging.h"
+#include "nav/NavFilter.h"
+
+using namespace Dae;
+
+/// @brief Initial standard deviation of roll and pitch (rad).
+static constexpr double TILT_SIGMA = 0.1;
+
+/// @brief Initial standard deviation of yaw, which starts unknown (rad).
+static constexpr double YAW_SIGMA = 1.0;
+
+/// @brief Initial standard deviation of the gyro bias (rad/s).
+static constexpr double GYRO_BIAS_SIGMA = 0.01;
+
+/// @brief Initial standard deviation of the accelerometer bias (m/s^2).
+static constexpr double ACCEL_BIAS_SIGMA = 0.2;
+
+/// @brief Number of 3-vector blocks of error states.
+static constexpr size_t BLOCKS = NavFilter::STATES / 3;
+
+NavFilter::NavFilter(const std::string& key) : Configurable(key) {
+    configure();
+}
+
+void NavFilter::configure(void) {
+    if (GPS_POSITION.get() <= 0 || GPS_VELOCITY.get() <= 0) {
+        warn("Navigation filter GPS noise must be positive");
+    }
+}
+
+void NavFilter::reset(const Vector3& position, const Vector3& velocity,
+                      const Vector3& accel) {
+    const double roll  = std::atan2(-accel[1], -accel[2]);
+    const double pitch = std::atan2(
+        accel[0], std::sqrt(accel[1] * accel[1] + accel[2] * accel[2]));
+
+    pos         = position;
+    vel         = velocity;
+    att         = Quaternion::fromEuler(roll, pitch, 0);
+    gyroOffset  = Vector3::zero();
+    accelOffset = Vector3::zero();
+
+    const double gpsPos = GPS_POSITION.get();
+    const double gpsVel = GPS_VELOCITY.get();
+
+    // Independent errors, the same for each axis but yaw
+    const double variances[BLOCKS] = {
+        gpsPos * gpsPos, gpsVel * gpsVel, TILT_SIGMA * TILT_SIGMA,
+        GYRO_BIAS_SIGMA * GYRO_BIAS_SIGMA, ACCEL_BIAS_SIGMA * ACCEL_BIAS_SIGMA};
+
+    P = Covariance::zero();
+    for (size_t i = 0; i < STATES; i++) {
+        P(i, i) = variances[i / 3];
+    }
+    P(ST_ATTITUDE + 2, ST_ATTITUDE + 2) = YAW_SIGMA * YAW_SIGMA;
+}
+
+void NavFilter::predict(const Vector3& gyro, const Vector3& accel,
+                        double dt) {
+    const Matrix3 R     = att.toMatrix();
+    const Vector3 force = R * (accel - accelOffset);
+    const Vector3 rate  = gyro - gyroOffset;
+
+    // Covariance first, as its Jacobians are about the prior state. With
+    // the attitude error in the Earth frame, the only blocks of the
+    // transition other than zero and identity are
+    //   F = [ I  I dt  0  0  0 ]
+    //       [ 0  I     A  0  B ]
+    //       [ 0  0     I  B  0 ]
+    //       [ 0  0     0  I  0 ]
+    //       [ 0  0     0  0  I ]
+    const Matrix3 A  = force.skew() * -dt;
+    const Matrix3 B  = R * -dt;
+    const Matrix3 At = A.transpose();
+    const Matrix3 Bt = B.transpose();
+
+    Matrix3 blocks[BLOCKS][BLOCKS];
+    for (size_t i = 0; i < BLOCKS; i++) {
+        for (size_t j = 0; j < BLOCKS; j++) {
+            blocks[i][j] = P.block<3, 3>(3 * i, 3 * j);
+        }
+    }
+
+    // F P, by its rows of blocks. The bias rows are unchanged
+    for (size_t j = 0; j < BLOCKS; j++) {
+        blocks[0][j].mulAdd(blocks[1][j], dt);
+        blocks[1][j] += A * blocks[2][j] + B * blocks[4][j];
+        blocks[2][j] += B * blocks[3][j];
+    }
+
+    // (F P) F', by its columns of blocks, mirroring the upper triangle
+    for (size_t i = 0; i < BLOCKS; i++) {
+        Matrix3 row[BLOCKS];
+        for (size_t j = 0; j < BLOCKS; j++) {
+            row[j] = blocks[i][j];
+        }
+
+        row[0].mulAdd(row[1], dt);
+        row[1] += row[2] * At + row[4] * Bt;
+        row[2] += row[3] * Bt;
+
+        // Rounding leaves the diagonal blocks slightly asymmetric
+        P.setBlock(3 * i, 3 * i, (row[i] + row[i].transpose()) * 0.5);
+        for (size_t j = i + 1; j < BLOCKS; j++) {
+            P.setBlock(3 * i, 3 * j, row[j]);
+            P.setBlock(3 * j, 3 * i, row[j].transpose());
+        }
+    }
+
+    const Vector<STATES> noise = processNoise(dt);
+    for (size_t i = 0; i < STATES; i++) {
+        P(i, i) += noise[i];
+    }
+
+    // Nominal state
+    const Vector3 acceleration = force + GRAVITY;
+    pos.mulAdd(vel, dt);
+    pos.mulAdd(acceleration, dt * dt / 2);
+    vel.mulAdd(acceleration, dt);
+    att = (att * Quaternion::fromRotationVector(rate * dt)).normalized();
+}
+
+void NavFilter::fuseGps(const Vector3& position, const Vector3& velocity) {
+    const double posVariance = GPS_POSITION.get() * GPS_POSITION.get();
+    const double velVariance = GPS_VELOCITY.get() * GPS_VELOCITY.get();
+
+    Vector<STATES> error = Vector<STATES>::zero();
+    for (size_t i = 0; i < 3; i++) {
+        fuseScalar(ST_POSITION + i, position[i] - pos[i], posVariance, error);
+    }
+    for (size_t i = 0; i < 3; i++) {
+        fuseScalar(ST_VELOCITY + i, velocity[i] - vel[i], velVariance, error);
+    }
+    inject(error);
+}
+
+void NavFilter::update(const Telemetry& telemetry) {
+    const Vector3& position = Vector3::view(telemetry.position);
+    const Vector3& velocity = Vector3::view(telemetry.velocity);
+
+    if (!started) {
+        reset(position, velocity, Vector3::view(telemetry.accel));
+        lastTime = telemetry.timestamp;
+        lastFix  = telemetry.timestamp;
+        started  = true;
+        return;
+    }
+
+    predict(Vector3::view(telemetry.gyro), Vector3::view(telemetry.accel),
+            telemetry.timestamp - lastTime);
+    lastTime = telemetry.timestamp;
+
+    // Half a microsecond early, so rounding never skips a fix
+    if (telemetry.timestamp - lastFix >= GPS_PERIOD.get() - 5e-7) {
+        fuseGps(position, velocity);
+        lastFix = telemetry.timestamp;
+    }
+}
+
+NavFilter::Covariance NavFilter::transition(const Vector3& accel,
+                                            double         dt) const {
+    const Matrix3 R     = att.toMatrix();
+    const Vector3 force = R * (accel - accelOffset);
+
+    Covariance F = Covariance::identity();
+    F.setBlock(ST_POSITION, ST_VELOCITY, Matrix3::identity() * dt);
+    F.setBlock(ST_VELOCITY, ST_ATTITUDE, force.skew() * -dt);
+    F.setBlock(ST_VELOCITY, ST_ACCEL_BIAS, R * -dt);
+    F.setBlock(ST_ATTITUDE, ST_GYRO_BIAS, R * -dt);
+    return F;
+}
+
+Vector<NavFilter::STATES> NavFilter::processNoise(double dt) const {
+    // Noise densities integrated over the sample
+    const auto integrate = [dt](double density) {
+        return density * density * dt;
+    };
+    const double velocity  = integrate(ACCEL_NOISE.get());
+    const double attitude  = integrate(GYRO_NOISE.get());
+    const double gyroBias  = integrate(GYRO_BIAS_NOISE.get());
+    const double accelBias = integrate(ACCEL_BIAS_NOISE.get());
+
+    Vector<STATES> noise = Vector<STATES>::zero();
+    for (size_t i = 0; i < 3; i++) {
+        noise[ST_VELOCITY + i]   = velocity;
+        noise[ST_ATTITUDE + i]   = attitude;
+        noise[ST_GYRO_BIAS + i]  = gyroBias;
+        noise[ST_ACCEL_BIAS + i] = accelBias;
+    }
+    return noise;
+}
+
+void NavFilter::fuseScalar(size_t state, double innovation, double variance,
+                           Vector<STATES>& error) {
+    // H is the unit row of the state, so H P H' + R and P H' are read
+    // straight out of the covariance
+    const double         S    = P(state, state) + variance;
+    const Vector<STATES> gain = P.col(state) / S;
+
+    error.mulAdd(gain, innovation - error[state]);
+
+    // P - K H P, where H P = S K' as P is symmetric, keeping it symmetric
+    for (size_t i = 0; i < STATES; i++) {
+        const double scale = gain[i] * S;
+        for (size_t j = i; j < STATES; j++) {
+            P(i, j) -= scale * gain[j];
+            P(j, i) = P(i, j);
+        }
+    }
+}
+
+void NavFilter::inject(const Vector<STATES>& error) {
+    pos         += error.block<3, 1>(ST_POSITION, 0);
+    vel         += error.block<3, 1>(ST_VELOCITY, 0);
+    gyroOffset  += error.block<3, 1>(ST_GYRO_BIAS, 0);
+    accelOffset += error.block<3, 1>(ST_ACCEL_BIAS, 0);
+
+    const Vector3 rotation = error.block<3, 1>(ST_ATTITUDE, 0);
+    att = (Quaternion::fromRotationVector(rotation) * att).normalized();
+}
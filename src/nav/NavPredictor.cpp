@@ -0,0 +1,143 @@
+/**
+ * @file NavPredictor.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the NavPredictor class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <algorithm>
+
+#include "common/Logging.h"
+#include "nav/NavPredictor.h"
+
+using namespace Dae;
+
+NavPredictor::NavPredictor(const std::string& key,
+                           const std::string& filterKey)
+    : Configurable(key), filter(filterKey) {
+    configure();
+}
+
+void NavPredictor::configure(void) {
+    if (TIME_CONSTANT.get() <= 0) {
+        warn("Navigation output time constant must be positive");
+    }
+}
+
+void NavPredictor::reset(double timestamp, const Vector3& position,
+                         const Vector3& velocity, const Vector3& accel) {
+    filter.reset(position, velocity, accel);
+    samples.clear();
+    fixes.clear();
+
+    output     = {filter.position(), filter.velocity(), filter.attitude()};
+    newest     = timestamp;
+    filterTime = timestamp;
+    lastFix    = timestamp;
+    started    = true;
+}
+
+void NavPredictor::pushImu(double timestamp, const Vector3& gyro,
+                           const Vector3& accel) {
+    const double dt = timestamp - newest;
+    newest          = timestamp;
+
+    integrate(output, gyro, accel, dt);
+
+    // Make room rather than lose a sample the filter has not integrated
+    if (samples.full()) {
+        warn_every(1000, "Navigation IMU buffer is shorter than the delay");
+        advance();
+    }
+    samples.push({timestamp, dt, gyro, accel, output});
+
+    const double horizon = timestamp - DELAY.get();
+    while (!samples.empty() && samples.front().timestamp <= horizon) {
+        advance();
+    }
+}
+
+bool NavPredictor::pushGps(double timestamp, const Vector3& position,
+                           const Vector3& velocity) {
+    if (timestamp < filterTime) return false;
+
+    if (!fixes.push({timestamp, position, velocity})) {
+        warn_every(1000, "Navigation GPS buffer overflowed, fixes dropped");
+    }
+    return true;
+}
+
+void NavPredictor::update(const Telemetry& telemetry) {
+    const Vector3& position = Vector3::view(telemetry.position);
+    const Vector3& velocity = Vector3::view(telemetry.velocity);
+
+    if (!started) {
+        reset(telemetry.timestamp, position, velocity,
+              Vector3::view(telemetry.accel));
+        return;
+    }
+
+    // Half a microsecond early, so rounding never skips a fix
+    if (telemetry.timestamp - lastFix >= GPS_PERIOD.get() - 5e-7) {
+        pushGps(telemetry.timestamp, position, velocity);
+        lastFix = telemetry.timestamp;
+    }
+    pushImu(telemetry.timestamp, Vector3::view(telemetry.gyro),
+            Vector3::view(telemetry.accel));
+}
+
+void NavPredictor::advance(void) {
+    Sample sample;
+    samples.pop(sample);
+
+    filter.predict(sample.gyro, sample.accel, sample.dt);
+    filterTime = sample.timestamp;
+
+    while (!fixes.empty() && fixes.front().timestamp <= filterTime) {
+        Fix fix;
+        fixes.pop(fix);
+        filter.fuseGps(fix.position, fix.velocity);
+    }
+
+    // Feed back part of the difference between the filter and the output
+    // at the same time
+    const double alpha = std::min(1.0, sample.dt / TIME_CONSTANT.get());
+
+    const Output& past     = sample.output;
+    const Vector3 position = (filter.position() - past.position) * alpha;
+    const Vector3 velocity = (filter.velocity() - past.velocity) * alpha;
+
+    // Small attitude error, the shorter way round
+    const Quaternion error = filter.attitude() * past.attitude.conjugate();
+    const double     scale = (error.w() < 0 ? -2 : 2) * alpha;
+    const Quaternion rotation =
+        Quaternion::fromRotationVector(error.vec() * scale);
+
+    // The buffered outputs are corrected too, so that each error is only
+    // fed back once
+    const auto correct = [&](Output& state) {
+        state.position += position;
+        state.velocity += velocity;
+        state.attitude  = (rotation * state.attitude).normalized();
+    };
+    correct(output);
+    for (size_t i = 0; i < samples.size(); i++) {
+        correct(samples[i].output);
+    }
+}
+
+void NavPredictor::integrate(Output& state, const Vector3& gyro,
+                             const Vector3& accel, double dt) const {
+    const Vector3 acceleration =
+        state.attitude.rotate(accel - filter.accelBias()) + NavFilter::GRAVITY;
+    const Vector3 rate = gyro - filter.gyroBias();
+
+    state.position.mulAdd(state.velocity, dt);
+    state.position.mulAdd(acceleration, dt * dt / 2);
+    state.velocity.mulAdd(acceleration, dt);
+    state.attitude =
+        (state.attitude * Quaternion::fromRotationVector(rate * dt))
+            .normalized();
+}
@@ -140,7 +140,8 @@ JSONBackend::iterate(const std::unique_ptr<Control> ctrl) {
         json msg = json::parse(telemBuffer, nullptr, false, true, true);
 
         if (msg.is_discarded()) {
-            warn("Failed to parse telemetry message : %s", telemBuffer);
+            warn_every(LOG_PERIOD, "Failed to parse telemetry message : %s",
+                       telemBuffer);
             continue;
         }
 
@@ -149,37 +150,44 @@ JSONBackend::iterate(const std::unique_ptr<Control> ctrl) {
         // Validate and set telemetry
         std::unique_ptr<Telemetry> telem = std::make_unique<Telemetry>();
         if (!validateAndGetJson(&telem->timestamp, "timestamp", msg)) {
-            warn("JSON telemetry does not contain timestamp");
+            warn_every(LOG_PERIOD,
+                       "JSON telemetry does not contain timestamp");
             continue;
         }
 
         if (!msg.contains("imu") || !msg["imu"].is_object()) {
-            warn("JSON telemetry does not contain imu object");
+            warn_every(LOG_PERIOD,
+                       "JSON telemetry does not contain imu object");
             continue;
         }
 
         if (!validateAndGetJsonArr(telem->accel, "accel_body", msg["imu"], 3)) {
-            warn("JSON telemetry does not contain timestamp");
+            warn_every(LOG_PERIOD,
+                       "JSON telemetry does not contain timestamp");
             continue;
         }
 
         if (!validateAndGetJsonArr(telem->gyro, "gyro", msg["imu"], 3)) {
-            warn("JSON telemetry does not contain timestamp");
+            warn_every(LOG_PERIOD,
+                       "JSON telemetry does not contain timestamp");
             continue;
         }
 
         if (!validateAndGetJsonArr(telem->position, "position", msg, 3)) {
-            warn("JSON telemetry does not contain position");
+            warn_every(LOG_PERIOD,
+                       "JSON telemetry does not contain position");
             continue;
         }
 
         if (!validateAndGetJsonArr(telem->velocity, "velocity", msg, 3)) {
-            warn("JSON telemetry does not contain velocity");
+            warn_every(LOG_PERIOD,
+                       "JSON telemetry does not contain velocity");
             continue;
         }
 
         if (!validateAndGetJsonArr(telem->quaternion, "quaternion", msg, 4)) {
-            warn("JSON telemetry does not contain quaternion");
+            warn_every(LOG_PERIOD,
+                       "JSON telemetry does not contain quaternion");
             continue;
         }
 
@@ -188,7 +196,7 @@ JSONBackend::iterate(const std::unique_ptr<Control> ctrl) {
         return telem;
     }
 
-    warn("Physics backend telemetry request timed out");
+    warn_every(LOG_PERIOD, "Physics backend telemetry request timed out");
 
     return nullptr;
 }
@@ -223,9 +231,7 @@ bool JSONBackend::validateAndGetJsonArr(double*            values,
 }
 
 void JSONBackend::configure(void) {
-    TELEM_TIMEOUT   = confNum("telem_timeout", TELEM_TIMEOUT);
-    RECEIVE_TIMEOUT = confNum("receive_timeout", RECEIVE_TIMEOUT);
-    SERVER_ADDR     = confStr("addr", SERVER_ADDR);
-    SERVER_PORT     = static_cast<uint16_t>(
+    SERVER_ADDR = confStr("addr", SERVER_ADDR);
+    SERVER_PORT = static_cast<uint16_t>(
         confNum("port", static_cast<double>(SERVER_PORT)));
 }
\ No newline at end of file
@@ -0,0 +1,169 @@
+/**
+ * @file TelemetryHistory.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Implementation of the TelemetryHistory class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <algorithm>
+#include <cstring>
+
+#include "common/Quaternion.h"
+#include "sim/TelemetryHistory.h"
+
+using namespace Dae;
+
+/**
+ * @brief Round up to a power of two, at least 2.
+ */
+static size_t roundUp(size_t n) {
+    size_t size = 2;
+    while (size < n) {
+        size *= 2;
+    }
+    return size;
+}
+
+/**
+ * @brief Linearly interpolate a vector.
+ */
+static void lerp(const double (&a)[3], const double (&b)[3], double alpha,
+                 double (&out)[3]) {
+    const Vector3 delta = Vector3::view(b) - Vector3::view(a);
+    Vector3&      value = Vector3::view(out);
+    value               = Vector3::view(a);
+    value.mulAdd(delta, alpha);
+}
+
+TelemetryHistory::TelemetryHistory(size_t capacity)
+    : slots(roundUp(capacity)) {}
+
+bool TelemetryHistory::push(const Telemetry& sample) {
+    const uint64_t index = head.load(std::memory_order_relaxed);
+    if (index > 0 && sample.timestamp < newest) return false;
+
+    Slot& slot = slots[index & (slots.size() - 1)];
+
+    // Odd while the slot is being written
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    memcpy(&slot.sample, &sample, sizeof(Telemetry));
+
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+    head.store(index + 1, std::memory_order_release);
+
+    newest = sample.timestamp;
+    return true;
+}
+
+bool TelemetryHistory::latest(Telemetry& out) const {
+    for (;;) {
+        const uint64_t end = head.load(std::memory_order_acquire);
+        if (end == 0) return false;
+        if (read(end - 1, out)) return true;
+    }
+}
+
+bool TelemetryHistory::at(double timestamp, Telemetry& out) const {
+    // Retry from the new head if a sample is overwritten mid search
+    for (;;) {
+        const uint64_t end   = head.load(std::memory_order_acquire);
+        const uint64_t begin = end - std::min<uint64_t>(end, slots.size());
+        if (begin == end) return false;
+
+        // First sample after the time
+        uint64_t lo   = begin;
+        uint64_t hi   = end;
+        bool     torn = false;
+        while (lo < hi) {
+            const uint64_t mid = lo + (hi - lo) / 2;
+            double         time;
+            if (!stamp(mid, time)) {
+                torn = true;
+                break;
+            }
+            if (time <= timestamp) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (torn) continue;
+        if (lo == begin) return false;
+
+        Telemetry before;
+        if (!read(lo - 1, before)) continue;
+        if (lo == end) {
+            if (before.timestamp != timestamp) return false;
+            out = before;
+            return true;
+        }
+
+        Telemetry after;
+        if (!read(lo, after)) continue;
+
+        interpolate(before, after, timestamp, out);
+        return true;
+    }
+}
+
+size_t TelemetryHistory::snapshot(std::vector<Telemetry>& out,
+                                  size_t                  count) const {
+    const uint64_t end  = head.load(std::memory_order_acquire);
+    uint64_t       held = std::min<uint64_t>(end, slots.size());
+    if (count != 0) held = std::min<uint64_t>(held, count);
+
+    out.clear();
+    out.reserve(held);
+
+    Telemetry sample;
+    for (uint64_t index = end - held; index < end; index++) {
+        if (read(index, sample)) out.push_back(sample);
+    }
+    return out.size();
+}
+
+size_t TelemetryHistory::size(void) const {
+    return std::min<uint64_t>(head.load(std::memory_order_acquire),
+                              slots.size());
+}
+
+void TelemetryHistory::interpolate(const Telemetry& a, const Telemetry& b,
+                                   double timestamp, Telemetry& out) {
+    const double span  = b.timestamp - a.timestamp;
+    const double alpha = span > 0 ? (timestamp - a.timestamp) / span : 0.0;
+
+    out.timestamp = timestamp;
+    lerp(a.gyro, b.gyro, alpha, out.gyro);
+    lerp(a.accel, b.accel, alpha, out.accel);
+    lerp(a.position, b.position, alpha, out.position);
+    lerp(a.velocity, b.velocity, alpha, out.velocity);
+
+    Quaternion::view(out.quaternion) = Quaternion::slerp(
+        Quaternion::view(a.quaternion), Quaternion::view(b.quaternion), alpha);
+}
+
+bool TelemetryHistory::read(uint64_t index, Telemetry& out) const {
+    const Slot&    slot  = slots[index & (slots.size() - 1)];
+    const uint64_t start = slot.sequence.load(std::memory_order_acquire);
+    if (start != 2 * index + 2) return false;
+
+    memcpy(&out, &slot.sample, sizeof(Telemetry));
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence.load(std::memory_order_relaxed) == start;
+}
+
+bool TelemetryHistory::stamp(uint64_t index, double& out) const {
+    const Slot&    slot  = slots[index & (slots.size() - 1)];
+    const uint64_t start = slot.sequence.load(std::memory_order_acquire);
+    if (start != 2 * index + 2) return false;
+
+    out = slot.sample.timestamp;
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence.load(std::memory_order_relaxed) == start;
+}
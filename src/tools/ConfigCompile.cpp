@@ -0,0 +1,59 @@
+/**
+ * @file ConfigCompile.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Compiles a JSON configuration into a binary snapshot.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ *
+ * Usage:
+ * ```bash
+ * daedalus_config <config.json> [snapshot]
+ * ```
+ *
+ * The snapshot defaults to `<config.json>.bin`, which is where
+ * `Configurable::initialize` looks for it. It must be rebuilt whenever the
+ * JSON file changes, otherwise it is ignored.
+ */
+#include <fstream>
+#include <string>
+
+#include "common/ConfigSnapshot.h"
+#include "common/Logging.h"
+
+using namespace Dae;
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        error("Usage: %s <config.json> [snapshot]", argv[0]);
+        return 1;
+    }
+
+    const std::string input  = argv[1];
+    const std::string output =
+        argc == 3 ? argv[2] : ConfigSnapshot::pathFor(input);
+
+    uint64_t checksum;
+    if (ConfigSnapshot::checksum(input, checksum) != ConfigSnapshot::ST_GOOD) {
+        stl_error(errno, "Failed to open '%s'", input.c_str());
+        return 1;
+    }
+
+    // Parse configurations without throwing
+    std::ifstream  file(input);
+    nlohmann::json config = nlohmann::json::parse(file, nullptr, false, true,
+                                                  true);
+    if (config.is_discarded()) {
+        error("Failed to parse JSON in file '%s'", input.c_str());
+        return 1;
+    }
+
+    if (ConfigSnapshot::build(config, checksum, output) !=
+        ConfigSnapshot::ST_GOOD) {
+        return 1;
+    }
+
+    info("Wrote configuration snapshot '%s'", output.c_str());
+    return 0;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file ConfigFreeze.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Generates the compile time values of a frozen configuration.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ *
+ * Usage:
+ * ```bash
+ * daedalus_freeze <config.json> <FrozenConfigValues.h>
+ * ```
+ *
+ * Writes one `Frozen` specialisation per scalar in the configuration, see
+ * `FrozenConfig.h`. Numbers are written as hexadecimal floating point
+ * literals, so they are bit identical to the values parsed at runtime.
+ *
+ * This runs before `daedalus_core` is built, so it only depends on the JSON
+ * library.
+ */
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <json.h>
+
+using json = nlohmann::json;
+
+/**
+ * @brief Quote a string as a C++ string literal.
+ */
+static std::string literal(const std::string& str) {
+    std::string out = "\"";
+    for (const char c : str) {
+        const auto byte = static_cast<unsigned char>(c);
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (byte < 0x20 || byte >= 0x7F) {
+            char escaped[5];
+            snprintf(escaped, sizeof(escaped), "\\%03o", byte);
+            out += escaped;
+        } else {
+            out += c;
+        }
+    }
+    return out + "\"";
+}
+
+/**
+ * @brief Write the specialisation of one value.
+ */
+static void writeValue(FILE* out, const std::string& object,
+                       const std::string& key, const json& value) {
+    const bool numeric = value.is_number() || value.is_boolean();
+    if (!numeric && !value.is_string()) return;
+
+    double number = 0;
+    if (value.is_boolean()) number = value.get<bool>() ? 1.0 : 0.0;
+    if (value.is_number()) number = value.get<double>();
+
+    fprintf(out, "template <> struct Frozen<%s, %s> {\n",
+            literal(object).c_str(), literal(key).c_str());
+    fprintf(out, "    static constexpr bool             FOUND   = true;\n");
+    fprintf(out, "    static constexpr bool             NUMERIC = %s;\n",
+            numeric ? "true" : "false");
+    fprintf(out, "    static constexpr double           NUMBER  = %a;\n",
+            number);
+    fprintf(out, "    static constexpr std::string_view STRING  = %s;\n",
+            value.is_string()
+                ? literal(value.get_ref<const std::string&>()).c_str()
+                : "{}");
+    fprintf(out, "};\n\n");
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <config.json> <output header>\n", argv[0]);
+        return 1;
+    }
+
+    std::ifstream file(argv[1]);
+    if (!file.is_open()) {
+        fprintf(stderr, "Failed to open '%s'\n", argv[1]);
+        return 1;
+    }
+
+    // Parse configurations without throwing
+    const json config = json::parse(file, nullptr, false, true, true);
+    if (config.is_discarded() || !config.is_object()) {
+        fprintf(stderr, "Failed to parse JSON configuration '%s'\n", argv[1]);
+        return 1;
+    }
+
+    FILE* out = fopen(argv[2], "w");
+    if (out == nullptr) {
+        fprintf(stderr, "Failed to open '%s'\n", argv[2]);
+        return 1;
+    }
+
+    fprintf(out, "// Generated by daedalus_freeze from '%s', do not edit.\n",
+            argv[1]);
+    fprintf(out, "#pragma once\n\nnamespace Dae {\n\n");
+
+    for (auto it = config.begin(); it != config.end(); ++it) {
+        if (!it->is_object()) continue;
+        for (auto field = it->begin(); field != it->end(); ++field) {
+            writeValue(out, it.key(), field.key(), *field);
+        }
+    }
+
+    fprintf(out, "} // namespace Dae\n");
+    return fclose(out) == 0 ? 0 : 1;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file LogDecode.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Offline converter of binary flight logs to CSV or columnar files.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ *
+ * Usage:
+ * ```bash
+ * daedalus_log <log.bin> <output directory> [csv|columns]
+ * ```
+ *
+ * `csv` (the default) writes one `<NAME>.csv` file per message type, with the
+ * field labels as the header row. `columns` writes one `<NAME>.<Label>.f64`
+ * file per numeric field, holding the raw little endian doubles of every
+ * record, which can be memory mapped directly by analysis tools. Compressed
+ * telemetry is decoded and written as `TELZ` frames, see `FlightLogExporter`.
+ */
+#include <string>
+
+#include "common/Logging.h"
+#include "log/FlightLogExporter.h"
+
+using namespace Dae;
+
+int main(int argc, char** argv) {
+    if (argc < 3 || argc > 4) {
+        error("Usage: %s <log.bin> <output directory> [csv|columns]", argv[0]);
+        return 1;
+    }
+
+    const std::string mode     = argc == 4 ? argv[3] : "csv";
+    const bool        columnar = mode == "columns";
+    if (!columnar && mode != "csv") {
+        error("Unknown output mode '%s'", mode.c_str());
+        return 1;
+    }
+
+    FlightLogExporter exporter;
+    if (exporter.convert(argv[1], argv[2], columnar) !=
+        FlightLogExporter::ST_GOOD) {
+        return 1;
+    }
+
+    for (const auto& [name, count] : exporter.counts()) {
+        info("%-4s %zu records", name.c_str(), count);
+    }
+
+    if (exporter.skipped() != 0) {
+        warn("Skipped %zu corrupt bytes", exporter.skipped());
+    }
+    if (exporter.lostBlocks() != 0) {
+        warn("Lost %zu compressed telemetry blocks", exporter.lostBlocks());
+    }
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file ConfigSnapshot.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the ConfigSnapshot class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "common/ConfigSnapshot.h"
+#include "common/Configurable.h"
+
+using namespace Dae;
+
+class Snapshotted : public Configurable {
+public:
+    Snapshotted() : Configurable("Snapshotted") { configure(); }
+
+    double      gain;
+    double      missing;
+    bool        enabled;
+    std::string name;
+    std::string wrongType;
+
+    void configure(void) override {
+        gain      = confNum("gain", -1);
+        missing   = confNum("missing", 7);
+        enabled   = confNum("enabled", 0) != 0;
+        name      = confStr("name", "none");
+        wrongType = confStr("gain", "default");
+    }
+};
+
+/**
+ * @brief Write a file in one go.
+ */
+static void writeFile(const std::string& path, const std::string& text) {
+    std::ofstream file(path, std::ios::trunc | std::ios::binary);
+    file << text;
+}
+
+TEST_CASE("ConfigSnapshot replaces JSON parsing while it is up to date",
+          "[ConfigSnapshot]") {
+    const std::string path     = "config_snapshot_test.json";
+    const std::string snapshot = ConfigSnapshot::pathFor(path);
+    const std::string text     = R"({
+        "Snapshotted": {"gain": 2.5, "enabled": true, "name": "fast",
+                        "table": [1, 2, 3]},
+        "version": 3
+    })";
+    writeFile(path, text);
+
+    // Plain JSON first, to compare against
+    REQUIRE(Configurable::initialize(path) == Configurable::ST_GOOD);
+    REQUIRE_FALSE(Configurable::snapshotLoaded());
+    Snapshotted parsed;
+
+    uint64_t checksum;
+    REQUIRE(ConfigSnapshot::checksum(path, checksum) ==
+            ConfigSnapshot::ST_GOOD);
+    REQUIRE(ConfigSnapshot::build(nlohmann::json::parse(text), checksum,
+                                  snapshot) == ConfigSnapshot::ST_GOOD);
+
+    REQUIRE(Configurable::initialize(path) == Configurable::ST_GOOD);
+    REQUIRE(Configurable::snapshotLoaded());
+    Snapshotted mapped;
+
+    REQUIRE(mapped.gain == parsed.gain);
+    REQUIRE(mapped.missing == parsed.missing);
+    REQUIRE(mapped.enabled == parsed.enabled);
+    REQUIRE(mapped.name == parsed.name);
+    REQUIRE(mapped.wrongType == parsed.wrongType);
+    REQUIRE(mapped.gain == 2.5);
+    REQUIRE(mapped.enabled);
+    REQUIRE(mapped.name == "fast");
+
+    // Direct lookups
+    ConfigSnapshot direct;
+    REQUIRE(direct.open(snapshot, checksum) == ConfigSnapshot::ST_GOOD);
+    double value;
+    REQUIRE(direct.number("", "version", value));
+    REQUIRE(value == 3);
+    REQUIRE(direct.find("Snapshotted", "table") == nullptr);
+    REQUIRE(direct.find("Snapshotted", "nam") == nullptr);
+    REQUIRE(direct.find("Snapshot", "ted.gain") == nullptr);
+
+    std::vector<std::string> keys = direct.keys("Snapshotted");
+    std::sort(keys.begin(), keys.end());
+    REQUIRE(keys == std::vector<std::string>{"enabled", "gain", "name"});
+    REQUIRE(direct.keys("Snapshot").empty());
+    direct.close();
+
+    // Editing the JSON makes the snapshot stale
+    writeFile(path, R"({"Snapshotted": {"gain": 4}})");
+    REQUIRE(Configurable::initialize(path) == Configurable::ST_GOOD);
+    REQUIRE_FALSE(Configurable::snapshotLoaded());
+    Snapshotted edited;
+    REQUIRE(edited.gain == 4);
+
+    // Corrupt snapshots are rejected
+    writeFile(snapshot, "DAECFG but not really a snapshot at all");
+    REQUIRE(direct.open(snapshot, checksum) == ConfigSnapshot::ST_BAD_FORMAT);
+
+    remove(path.c_str());
+    remove(snapshot.c_str());
+}
@@ -0,0 +1,105 @@
+/**
+ * @file ConfigStore.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the ConfigStore class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "common/ConfigStore.h"
+#include "common/Configurable.h"
+
+using namespace Dae;
+
+class Stored : public Configurable {
+public:
+    Stored() : Configurable("Stored") { configure(); }
+
+    double gain;
+    double offset;
+
+    void configure(void) override {
+        gain   = confNum("gain", -1);
+        offset = confNum("offset", -1);
+    }
+};
+
+/**
+ * @brief Publish a configuration where gain and offset are both `value`.
+ */
+static void publishValue(double value) {
+    auto version    = std::make_unique<ConfigStore::Version>();
+    version->config = {{"Stored", {{"gain", value}, {"offset", value}}}};
+    ConfigStore::publish(std::move(version));
+}
+
+TEST_CASE("ConfigStore keeps versions alive while they are read",
+          "[ConfigStore]") {
+    publishValue(1);
+    publishValue(1);
+    REQUIRE(ConfigStore::retired() == 0);
+
+    const uint64_t first = ConfigStore::current();
+    {
+        ConfigStore::Reader reader;
+        REQUIRE(reader->number == first);
+
+        // The pinned version outlives being replaced
+        publishValue(2);
+        REQUIRE(ConfigStore::retired() == 1);
+        REQUIRE((*reader).config["Stored"]["gain"] == 1);
+
+        // Nested readers see the newest version
+        ConfigStore::Reader nested;
+        REQUIRE(nested->number == first + 1);
+    }
+
+    publishValue(3);
+    REQUIRE(ConfigStore::retired() == 0);
+    REQUIRE(ConfigStore::current() == first + 2);
+}
+
+TEST_CASE("ConfigStore is read consistently while it is replaced",
+          "[ConfigStore]") {
+    publishValue(0);
+
+    std::atomic<bool> running{true};
+    std::atomic<int>  torn{0};
+    std::atomic<int>  constructed{0};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&] {
+            while (running.load(std::memory_order_relaxed)) {
+                ConfigStore::Reader reader;
+                const auto&         section = reader->config["Stored"];
+                if (section["gain"] != section["offset"]) torn++;
+
+                Stored stored;
+                if (stored.gain < 0 || stored.offset < 0) torn++;
+                constructed++;
+            }
+        });
+    }
+
+    for (int i = 1; i <= 2000 || constructed.load() < 1000; i++) {
+        publishValue(i);
+    }
+
+    running.store(false, std::memory_order_relaxed);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(torn.load() == 0);
+
+    publishValue(0);
+    REQUIRE(ConfigStore::retired() == 0);
+}
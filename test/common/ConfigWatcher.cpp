@@ -0,0 +1,163 @@
+/**
+ * @file ConfigWatcher.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the ConfigWatcher class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <atomic>
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "common/ConfigWatcher.h"
+
+using namespace Dae;
+
+class Watched : public Configurable {
+public:
+    explicit Watched(const std::string& key) : Configurable(key) {
+        configure();
+    }
+
+    Param<double> gain = param("gain", 0.0);
+
+    std::string mode;
+    int         configures = 0;
+
+    void configure(void) override {
+        mode = confStr("mode", "none");
+        configures++;
+    }
+};
+
+/**
+ * @brief Write a configuration file in one go.
+ */
+static void writeConfig(const char* path, const std::string& text) {
+    std::ofstream file(path, std::ios::trunc);
+    file << text;
+}
+
+/**
+ * @brief Poll the watcher until it applies an update, or times out.
+ */
+static bool waitForReload(ConfigWatcher& watcher) {
+    for (int i = 0; i < 200; i++) {
+        if (watcher.poll()) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+TEST_CASE("ConfigWatcher reloads changed keys into running components",
+          "[ConfigWatcher]") {
+    const char* path = "config_watcher_test.json";
+    writeConfig(path, R"({"WatchA": {"gain": 1, "mode": "a"},
+                          "WatchB": {"gain": 2, "mode": "b"}})");
+
+    REQUIRE(Configurable::initialize(path) == Configurable::ST_GOOD);
+
+    Watched a("WatchA");
+    Watched b("WatchB");
+    REQUIRE(a.gain.get() == 1.0);
+    REQUIRE(a.mode == "a");
+
+    ConfigWatcher watcher(path, 0.01);
+    REQUIRE(watcher.start() == ConfigWatcher::ST_GOOD);
+    REQUIRE_FALSE(watcher.poll());
+
+    // Only a param changes, so nothing is reconfigured
+    writeConfig(path, R"({"WatchA": {"gain": 5, "mode": "a"},
+                          "WatchB": {"gain": 2, "mode": "b"}})");
+    REQUIRE(waitForReload(watcher));
+    REQUIRE(a.gain.get() == 5.0);
+    REQUIRE(a.configures == 1);
+    REQUIRE(b.configures == 1);
+
+    // A plain key changes, and only its component is reconfigured
+    writeConfig(path, R"({"WatchA": {"gain": 5, "mode": "a"},
+                          "WatchB": {"gain": 2, "mode": "fast"}})");
+    REQUIRE(waitForReload(watcher));
+    REQUIRE(a.configures == 1);
+    REQUIRE(b.configures == 2);
+    REQUIRE(b.mode == "fast");
+
+    // Broken files are ignored
+    writeConfig(path, "{\"WatchA\": ");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    REQUIRE_FALSE(watcher.poll());
+    REQUIRE(watcher.reloads() == 2);
+
+    watcher.stop();
+    remove(path);
+}
+
+TEST_CASE("ConfigWatcher updates are applied whole", "[ConfigWatcher]") {
+    const char* path = "config_watcher_batch_test.json";
+    writeConfig(path, R"({"WatchLow": {"gain": 0}, "WatchHigh": {"gain": 0}})");
+
+    REQUIRE(Configurable::initialize(path) == Configurable::ST_GOOD);
+
+    Watched low("WatchLow");
+    Watched high("WatchHigh");
+
+    // Another stage reads both params, and must never see them differ
+    std::atomic<bool> reading{true};
+    std::atomic<int>  torn{0};
+    std::thread       reader([&] {
+        while (reading.load(std::memory_order_relaxed)) {
+            double a, b;
+            ParamRegistry::consistent([&] {
+                a = low.gain.get();
+                b = high.gain.get();
+            });
+            if (a != b) torn.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    ConfigWatcher watcher(path, 0.01);
+    REQUIRE(watcher.start() == ConfigWatcher::ST_GOOD);
+
+    for (int i = 1; i <= 5; i++) {
+        const std::string value = std::to_string(i);
+        writeConfig(path, "{\"WatchLow\": {\"gain\": " + value +
+                              "}, \"WatchHigh\": {\"gain\": " + value + "}}");
+        REQUIRE(waitForReload(watcher));
+        REQUIRE(low.gain.get() == i);
+        REQUIRE(high.gain.get() == i);
+    }
+
+    reading.store(false, std::memory_order_relaxed);
+    reader.join();
+    REQUIRE(torn.load() == 0);
+
+    watcher.stop();
+    remove(path);
+}
+
+TEST_CASE("ConfigWatcher updates skip objects destroyed before they apply",
+          "[ConfigWatcher]") {
+    Configurable::initialize("test/common/Configurable.json");
+
+    Watched kept("WatchKept");
+    auto    dropped = std::make_unique<Watched>("WatchKept");
+
+    Configurable::Reload update;
+    update.config  = {{"WatchKept", {{"gain", 3}, {"mode", "kept"}}}};
+    update.changed = {{"WatchKept", {"gain", "mode"}}};
+    Configurable::prepare(update);
+    REQUIRE(update.targets.size() == 2);
+
+    dropped.reset();
+    Configurable::reload(update);
+    REQUIRE(kept.gain.get() == 3.0);
+    REQUIRE(kept.mode == "kept");
+    REQUIRE(kept.configures == 2);
+}
@@ -21,6 +21,7 @@ public:
     double a;
     double b;
     double c;
+    double gain;
 
     std::string astr;
     std::string bstr;
@@ -31,12 +32,77 @@ public:
         b = confNum("b", 10);
         c = confNum("c", 10);
 
+        gain = confNum("gain", 1);
+
         astr = confStr("a_str", "10");
         bstr = confStr("b_str", "goat");
         cstr = confStr("c_str", "balloon");
     }
 };
 
+class Tuned : public Configurable {
+public:
+    Tuned() : Configurable("Component") { configure(); }
+
+    Param<double> gain    = param("gain", 1.0);
+    Param<int>    count   = param("count", 0);
+    Param<bool>   enabled = param("enabled", true);
+
+    int configures = 0;
+
+    void configure(void) override { configures++; }
+};
+
+class Limits : public Configurable {
+public:
+    Limits() : Configurable("Limits") { configure(); }
+
+    DAE_PARAM(double, gain, "Limits", "gain", 1);
+    DAE_PARAM(int, count, "Limits", "count", 0);
+    DAE_PARAM(bool, enabled, "Limits", "enabled", true);
+
+    double gainRuntime;
+    double countRuntime;
+    double enabledRuntime;
+
+    void configure(void) override {
+        gainRuntime    = confNum("gain", 1);
+        countRuntime   = confNum("count", 0);
+        enabledRuntime = confNum("enabled", 1);
+    }
+};
+
+class Filter : public Configurable {
+public:
+    Filter() : Configurable("Filter") {
+        onChange({"cutoff", "order"}, &Filter::recompute);
+        configure();
+    }
+
+    Param<double> cutoff = param("cutoff", 10.0);
+    Param<int>    order  = param("order", 1);
+    Param<double> scale  = param("scale", 1.0);
+
+    std::string name;
+    double      coefficient = 0;
+    int         configures  = 0;
+    int         recomputes  = 0;
+    bool        nameChanged = false;
+    bool        cutChanged  = false;
+
+    void configure(void) override {
+        configures++;
+        nameChanged = changed("name");
+        cutChanged  = changed("cutoff");
+        name        = confStr("name", "filter");
+    }
+
+    void recompute(void) {
+        recomputes++;
+        coefficient = cutoff * order;
+    }
+};
+
 TEST_CASE("Configurable can configure classes with a configuration file", "[Configurable]") {
     Configurable::initialize("test/common/Configurable.json");
 
@@ -49,4 +115,109 @@ TEST_CASE("Configurable can configure classes with a configuration file", "[Conf
     REQUIRE(comp.astr == "100");
     REQUIRE(comp.bstr == "");
     REQUIRE(comp.cstr == "balloon");
-}
\ No newline at end of file
+}
+
+TEST_CASE("Configurable params are shared handles to the configuration",
+          "[Configurable]") {
+    Configurable::initialize("test/common/Configurable.json");
+
+    Tuned first;
+    Tuned second;
+
+    REQUIRE(first.gain.get() == 2.5);
+    REQUIRE(first.count.get() == 3);
+    REQUIRE(first.enabled.get());
+
+    // Params are written directly, without reconfiguring
+    first.cnf("gain", 4.0);
+    first.cnf("enabled", 0.0);
+    REQUIRE(first.configures == 1);
+    REQUIRE(first.gain.get() == 4.0);
+    REQUIRE(second.gain.get() == 4.0);
+    REQUIRE_FALSE(second.enabled.get());
+
+    // Other keys still reconfigure
+    first.cnf("a", 1.0);
+    REQUIRE(first.configures == 2);
+
+    // The param is the only copy, even for objects that did not declare it
+    Component plain;
+    REQUIRE(plain.gain == 4.0);
+    plain.cnf("gain", 6.0);
+    REQUIRE(plain.gain == 6.0);
+    REQUIRE(first.gain.get() == 6.0);
+
+    // Initializing again sets every param from the file
+    Configurable::initialize("test/common/Configurable.json");
+    REQUIRE(first.gain.get() == 2.5);
+    REQUIRE(second.enabled.get());
+
+    REQUIRE(ParamRegistry::find("Component.gain") != nullptr);
+    REQUIRE(ParamRegistry::find("Component.missing") == nullptr);
+
+    Param<double> unbound;
+    REQUIRE_FALSE(unbound.bound());
+    REQUIRE(unbound.get() == 0.0);
+}
+
+TEST_CASE("Configurable runs change hooks once per update",
+          "[Configurable]") {
+    Filter filter;
+    REQUIRE(filter.configures == 1);
+    REQUIRE(filter.nameChanged);
+    REQUIRE(filter.cutChanged);
+
+    // A hooked param only runs its hook
+    filter.cnf("cutoff", 20.0);
+    REQUIRE(filter.recomputes == 1);
+    REQUIRE(filter.configures == 1);
+    REQUIRE(filter.coefficient == 20.0);
+
+    // A batch runs each hook once, after every value is written
+    filter.cnf({{"cutoff", 5.0}, {"order", 3}, {"scale", 2.0}});
+    REQUIRE(filter.recomputes == 2);
+    REQUIRE(filter.configures == 1);
+    REQUIRE(filter.coefficient == 15.0);
+    REQUIRE(filter.scale.get() == 2.0);
+
+    // Plain keys reconfigure, which can tell what changed
+    filter.cnf({{"name", "lowpass"}, {"order", 2}});
+    REQUIRE(filter.configures == 2);
+    REQUIRE(filter.recomputes == 3);
+    REQUIRE(filter.name == "lowpass");
+    REQUIRE(filter.nameChanged);
+    REQUIRE_FALSE(filter.cutChanged);
+
+    // Copies run their own hooks
+    Filter copy = filter;
+    copy.cnf("cutoff", 1.0);
+    REQUIRE(copy.coefficient == 2.0);
+    REQUIRE(filter.coefficient == 10.0);
+}
+
+TEST_CASE("Configurable frozen params match the runtime configuration",
+          "[Configurable]") {
+#ifdef DAE_FROZEN_CONFIG
+    Configurable::initialize(DAE_FROZEN_CONFIG);
+#else
+    Configurable::initialize("test/common/Configurable.json");
+#endif
+
+    Limits limits;
+    REQUIRE(limits.gain.get() == limits.gainRuntime);
+    REQUIRE(limits.count.get() == static_cast<int>(limits.countRuntime));
+    REQUIRE(limits.enabled.get() == (limits.enabledRuntime != 0));
+    REQUIRE_FALSE(limits.enabled.get());
+
+    double gain = limits.gain;
+    REQUIRE(gain == limits.gain.get());
+
+    // Updates to a frozen param are rejected
+    limits.cnf("gain", 5.0);
+#ifdef DAE_FROZEN_CONFIG
+    REQUIRE(limits.gain.get() == gain);
+    REQUIRE(limits.gainRuntime == gain);
+#else
+    REQUIRE(limits.gain.get() == 5.0);
+#endif
+}
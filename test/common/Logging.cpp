@@ -0,0 +1,262 @@
+/**
+ * @file Logging.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the asynchronous Logger.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/Logging.h"
+#include "common/LoggingConfig.h"
+
+using namespace Dae;
+
+/**
+ * @brief Read everything written to a temporary file.
+ */
+static std::string readAll(FILE* file) {
+    std::string out;
+    char        buffer[256];
+
+    rewind(file);
+    while (size_t n = fread(buffer, 1, sizeof(buffer), file)) {
+        out.append(buffer, n);
+    }
+    return out;
+}
+
+TEST_CASE("Logger formats deferred records on the background thread",
+          "[Logging]") {
+    FILE* out = tmpfile();
+    FILE* err = tmpfile();
+    REQUIRE(out != nullptr);
+    REQUIRE(err != nullptr);
+
+    Logger::redirect(out, err);
+
+    {
+        // The string must be copied, it is destroyed before formatting
+        std::string temp = "temporary";
+        info("value %d %.2f %s %c", 42, 1.5, temp.c_str(), 'x');
+    }
+    error("failure %u", 7u);
+    Logger::flush();
+
+    Logger::redirect(stdout, stderr);
+
+    const std::string outText = readAll(out);
+    const std::string errText = readAll(err);
+    fclose(out);
+    fclose(err);
+
+    REQUIRE(outText.find("value 42 1.50 temporary x.") != std::string::npos);
+    REQUIRE(errText.find("failure 7!") != std::string::npos);
+}
+
+TEST_CASE("Logger drops records instead of blocking when a ring is full",
+          "[Logging]") {
+    FILE* out = tmpfile();
+    REQUIRE(out != nullptr);
+
+    Logger::redirect(out, out);
+
+    const std::string big(Logger::MAX_STRING_LENGTH, 'a');
+    const uint64_t    before = Logger::dropped();
+
+    // Each record is ~1kB so a 64kB ring overflows long before the background
+    // thread wakes up.
+    for (int i = 0; i < 1000; i++) {
+        warn("%s", big.c_str());
+    }
+    Logger::flush();
+
+    Logger::redirect(stdout, stderr);
+    fclose(out);
+
+    REQUIRE(Logger::dropped() > before);
+}
+
+TEST_CASE("Logger keeps records from many threads", "[Logging]") {
+    FILE* out = tmpfile();
+    REQUIRE(out != nullptr);
+
+    Logger::redirect(out, out);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < 10; i++) {
+                info("thread %d record %d", t, i);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    Logger::flush();
+
+    Logger::redirect(stdout, stderr);
+
+    const std::string text = readAll(out);
+    fclose(out);
+
+    for (int t = 0; t < 4; t++) {
+        for (int i = 0; i < 10; i++) {
+            const std::string line = "thread " + std::to_string(t) +
+                                     " record " + std::to_string(i) + ".";
+            REQUIRE(text.find(line) != std::string::npos);
+        }
+    }
+}
+
+TEST_CASE("Rate limited call sites suppress and summarise repeats",
+          "[Logging]") {
+    FILE* out = tmpfile();
+    REQUIRE(out != nullptr);
+
+    Logger::redirect(out, out);
+
+    auto repeat = [](int i) { warn_every(100, "repeated %d", i); };
+
+    for (int i = 0; i < 1000; i++) {
+        repeat(i);
+    }
+
+    // Wait for a token to be refilled
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    repeat(1000);
+
+    for (int i = 0; i < 10; i++) {
+        warn_once("only once");
+    }
+
+    Logger::flush();
+    Logger::redirect(stdout, stderr);
+
+    const std::string text = readAll(out);
+    fclose(out);
+
+    // The burst gets through, then everything else is suppressed
+    REQUIRE(text.find("repeated 0!") != std::string::npos);
+    REQUIRE(text.find("repeated 2!") != std::string::npos);
+    REQUIRE(text.find("repeated 3!") == std::string::npos);
+    REQUIRE(text.find("repeated 1000!") != std::string::npos);
+    REQUIRE(text.find("Suppressed 997 similar messages!") !=
+            std::string::npos);
+
+    size_t onceCount = 0;
+    for (size_t pos = text.find("only once"); pos != std::string::npos;
+         pos        = text.find("only once", pos + 1)) {
+        onceCount++;
+    }
+    REQUIRE(onceCount == 1);
+}
+
+TEST_CASE("Rate limited call sites summarise repeats once quiet",
+          "[Logging]") {
+    FILE* out = tmpfile();
+    REQUIRE(out != nullptr);
+
+    Logger::redirect(out, out);
+
+    auto repeat = [](int i) { warn_every(20, "quiet %d", i); };
+
+    for (int i = 0; i < 100; i++) {
+        repeat(i);
+    }
+
+    // The call site is never reached again before its bucket refills
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    repeat(100);
+
+    Logger::flush();
+    Logger::redirect(stdout, stderr);
+
+    const std::string text = readAll(out);
+    fclose(out);
+
+    const size_t summary = text.find("Suppressed 97 similar messages!");
+    const size_t last    = text.find("quiet 100!");
+    REQUIRE(text.find("quiet 3!") == std::string::npos);
+    REQUIRE(summary != std::string::npos);
+    REQUIRE(last != std::string::npos);
+    REQUIRE(summary < last);
+    REQUIRE(text.find("Suppressed", summary + 1) == std::string::npos);
+}
+
+TEST_CASE("Runtime levels filter call sites per tag", "[Logging]") {
+    FILE* out = tmpfile();
+    REQUIRE(out != nullptr);
+
+    const Logger::Level previous = Logger::getLevel("Logging");
+    REQUIRE(previous != Logger::LV_OFF);
+
+    Logger::redirect(out, out);
+
+    auto notice = [] { info_once("first enabled notice"); };
+
+    Logger::setLevel("Logging", Logger::LV_WARN);
+    info("hidden info");
+    debug("hidden debug");
+    warn("shown warning");
+    notice();
+
+    Logger::setLevel("Logging", Logger::LV_DEBUG);
+    debug("shown debug");
+    trace("hidden trace");
+    notice();
+    notice();
+
+    Logger::flush();
+    Logger::redirect(stdout, stderr);
+    Logger::setLevel("Logging", previous);
+
+    const std::string text = readAll(out);
+    fclose(out);
+
+    REQUIRE(text.find("hidden") == std::string::npos);
+    REQUIRE(text.find("shown warning") != std::string::npos);
+    REQUIRE(text.find("shown debug") != std::string::npos);
+
+    // A filtered once call site still logs when its level is enabled
+    const size_t first = text.find("first enabled notice");
+    REQUIRE(first != std::string::npos);
+    REQUIRE(text.find("first enabled notice", first + 1) == std::string::npos);
+}
+
+TEST_CASE("LoggingConfig applies levels from the configuration",
+          "[Logging]") {
+    const Logger::Level previous = Logger::getLevel("Logging");
+
+    const char* path = "test/common/LoggingConfig.json";
+    REQUIRE(Configurable::initialize(path) == Configurable::ST_GOOD);
+
+    LoggingConfig config;
+
+    REQUIRE(Logger::getLevel("Logging") == Logger::LV_ERROR);
+
+    // Tags that register later take their configured level, or the default
+    static std::atomic<uint8_t> unlinked, late;
+    REQUIRE(Logger::getLevel("Unlinked") == Logger::LV_DEBUG);
+    Logger::registerTag("Unlinked", unlinked);
+    Logger::registerTag("Late", late);
+    REQUIRE(unlinked.load() == Logger::LV_DEBUG);
+    REQUIRE(late.load() == Logger::LV_WARN);
+
+    config.cnf("Logging", "trace");
+    REQUIRE(Logger::getLevel("Logging") == Logger::LV_TRACE);
+
+#ifdef DEBUG
+    Logger::setLevel(Logger::LV_DEBUG);
+#else
+    Logger::setLevel(Logger::LV_INFO);
+#endif
+    Logger::setLevel("Logging", previous);
+}
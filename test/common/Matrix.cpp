@@ -0,0 +1,197 @@
+/**
+ * @file Matrix.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the Matrix and Quaternion classes.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <cmath>
+
+#include "common/Quaternion.h"
+#include "sim/PhysicsBackend.h"
+
+using namespace Dae;
+
+using Catch::Matchers::WithinAbs;
+
+// Evaluated by the compiler, on the scalar paths
+static_assert(Matrix3::identity() * Vector3{{1, 2, 3}} == Vector3{{1, 2, 3}});
+static_assert(Vector3{{1, 0, 0}}.cross(Vector3{{0, 1, 0}}) ==
+              Vector3{{0, 0, 1}});
+static_assert(Vector3{{3, 4, 0}}.norm() == 5);
+static_assert(Vector3{{1, 2, 3}}.skew() * Vector3{{4, 5, 6}} ==
+              Vector3{{1, 2, 3}}.cross(Vector3{{4, 5, 6}}));
+static_assert((Quaternion::identity() * Quaternion{{0, 1, 0, 0}}) ==
+              Quaternion{{0, 1, 0, 0}});
+static_assert(sizeof(Vector3) == 3 * sizeof(double));
+static_assert(sizeof(Quaternion) == 4 * sizeof(double));
+
+/**
+ * @brief Make a matrix with distinct, awkward elements.
+ */
+template <size_t N, size_t M> static Matrix<N, M> sample(double seed) {
+    Matrix<N, M> out{};
+    for (size_t i = 0; i < N * M; i++) {
+        out.data[i] = std::sin(seed + 1.3 * static_cast<double>(i));
+    }
+    return out;
+}
+
+/**
+ * @brief Naive matrix product, the reference for the SIMD path.
+ */
+template <size_t N, size_t M, size_t P>
+static Matrix<N, P> naive(const Matrix<N, M>& a, const Matrix<M, P>& b) {
+    Matrix<N, P> out{};
+    for (size_t i = 0; i < N; i++) {
+        for (size_t j = 0; j < P; j++) {
+            for (size_t k = 0; k < M; k++) {
+                out(i, j) += a(i, k) * b(k, j);
+            }
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Check two matrices agree to within a tolerance.
+ */
+template <size_t N, size_t M>
+static void requireNear(const Matrix<N, M>& a, const Matrix<N, M>& b,
+                        double tolerance = 1e-12) {
+    for (size_t i = 0; i < N * M; i++) {
+        REQUIRE_THAT(a.data[i], WithinAbs(b.data[i], tolerance));
+    }
+}
+
+TEST_CASE("Matrix products agree with naive loops", "[Matrix]") {
+    requireNear(sample<4, 4>(0.1) * sample<4, 4>(0.7),
+                naive(sample<4, 4>(0.1), sample<4, 4>(0.7)));
+    requireNear(sample<3, 3>(0.2) * sample<3, 3>(0.5),
+                naive(sample<3, 3>(0.2), sample<3, 3>(0.5)));
+    requireNear(sample<2, 5>(0.3) * sample<5, 3>(0.4),
+                naive(sample<2, 5>(0.3), sample<5, 3>(0.4)));
+    requireNear(sample<3, 3>(0.9) * sample<3, 1>(0.6),
+                naive(sample<3, 3>(0.9), sample<3, 1>(0.6)));
+    requireNear(sample<4, 4>(1.1) * sample<4, 1>(0.8),
+                naive(sample<4, 4>(1.1), sample<4, 1>(0.8)));
+}
+
+TEST_CASE("Matrix element wise operations", "[Matrix]") {
+    const Vector3 a = sample<3, 1>(0.1);
+    const Vector3 b = sample<3, 1>(2.0);
+
+    Vector3 fused = a;
+    fused.mulAdd(b, 0.25);
+    requireNear(fused, a + b * 0.25);
+
+    const Vector3 sum = a + b;
+    const Vector3 neg = -a;
+    for (size_t i = 0; i < 3; i++) {
+        REQUIRE(sum[i] == a[i] + b[i]);
+        REQUIRE(neg[i] == -a[i]);
+    }
+    REQUIRE_THAT(a.dot(b),
+                 WithinAbs(a[0] * b[0] + a[1] * b[1] + a[2] * b[2], 1e-15));
+    REQUIRE_THAT(b.normalized().norm(), WithinAbs(1.0, 1e-15));
+    REQUIRE(Vector3::zero().normalized() == Vector3::zero());
+
+    const Matrix<2, 3> m = sample<2, 3>(0.4);
+    REQUIRE(m.transpose()(2, 1) == m(1, 2));
+    REQUIRE(m.row(1)[2] == m(1, 2));
+    REQUIRE(m.col(2)[1] == m(1, 2));
+}
+
+TEST_CASE("Matrix views alias telemetry arrays", "[Matrix]") {
+    PhysicsBackend::Telemetry t{};
+    t.gyro[0] = 1;
+    t.gyro[1] = 2;
+    t.gyro[2] = 3;
+
+    Vector3& gyro = Vector3::view(t.gyro);
+    REQUIRE(gyro.y() == 2);
+
+    gyro *= 2.0;
+    REQUIRE(t.gyro[2] == 6);
+
+    Quaternion& q = Quaternion::view(t.quaternion);
+    q             = Quaternion::fromAxisAngle(Vector3{{0, 0, 1}}, M_PI / 2);
+    REQUIRE_THAT(t.quaternion[0], WithinAbs(std::sqrt(0.5), 1e-15));
+    REQUIRE_THAT(t.quaternion[3], WithinAbs(std::sqrt(0.5), 1e-15));
+}
+
+TEST_CASE("Quaternion rotations", "[Quaternion]") {
+    const Quaternion yaw  = Quaternion::fromAxisAngle({{0, 0, 1}}, M_PI / 2);
+    const Quaternion roll = Quaternion::fromAxisAngle({{1, 0, 0}}, M_PI / 2);
+
+    // Body x points north, yawed 90 degrees it points east
+    requireNear(yaw.rotate({{1, 0, 0}}), Vector3{{0, 1, 0}});
+    requireNear(yaw.unrotate({{0, 1, 0}}), Vector3{{1, 0, 0}});
+
+    // The SIMD product agrees with the constant evaluated one
+    constexpr Quaternion a{{0.5, -0.1, 0.7, 0.3}};
+    constexpr Quaternion b{{-0.2, 0.9, 0.4, -0.6}};
+    constexpr Quaternion product = a * b;
+    const Quaternion     runtime = a * b;
+    for (size_t i = 0; i < 4; i++) {
+        REQUIRE_THAT(runtime[i], WithinAbs(product[i], 1e-15));
+    }
+
+    // Composition, and agreement with the rotation matrix
+    const Quaternion both = yaw * roll;
+    const Vector3    v{{0.3, -1.2, 0.8}};
+    requireNear(both.rotate(v), yaw.rotate(roll.rotate(v)));
+    requireNear(both.toMatrix() * v, both.rotate(v));
+
+    requireNear(Quaternion::fromRotationVector({{0, 0, M_PI / 2}}).vec(),
+                yaw.vec());
+    const Quaternion tiny = Quaternion::fromRotationVector({{1e-12, 0, 0}});
+    REQUIRE_THAT(tiny.w(), WithinAbs(1.0, 1e-15));
+
+    requireNear((both * both.inverse()).vec(), Vector3::zero());
+}
+
+TEST_CASE("Quaternion Euler angles round trip", "[Quaternion]") {
+    const Quaternion q     = Quaternion::fromEuler(0.1, -0.4, 2.5);
+    const Vector3    euler = q.toEuler();
+    REQUIRE_THAT(euler[0], WithinAbs(0.1, 1e-12));
+    REQUIRE_THAT(euler[1], WithinAbs(-0.4, 1e-12));
+    REQUIRE_THAT(euler[2], WithinAbs(2.5, 1e-12));
+    REQUIRE_THAT(q.norm(), WithinAbs(1.0, 1e-15));
+}
+
+TEST_CASE("Quaternion slerp takes the shorter way", "[Quaternion]") {
+    const Quaternion a = Quaternion::fromAxisAngle({{0, 0, 1}}, 0.2);
+    const Quaternion b = Quaternion::fromAxisAngle({{0, 0, 1}}, 1.0);
+    const Quaternion h = Quaternion::slerp(a, b, 0.5);
+    REQUIRE_THAT(h.toEuler()[2], WithinAbs(0.6, 1e-12));
+
+    // -b is the same rotation
+    const Quaternion nb{{-b[0], -b[1], -b[2], -b[3]}};
+    const Quaternion hn = Quaternion::slerp(a, nb, 0.5);
+    REQUIRE_THAT(std::abs(hn.dot(h)), WithinAbs(1.0, 1e-12));
+}
+
+TEST_CASE("Matrix benchmark", "[.][benchmark]") {
+    const Matrix4 a4 = sample<4, 4>(0.1);
+    const Matrix4 b4 = sample<4, 4>(0.2);
+    const Matrix3 a3 = sample<3, 3>(0.3);
+    const Vector3 v3 = sample<3, 1>(0.4);
+
+    // Unit quaternions, so repeated products neither grow nor vanish
+    Quaternion       qa = Quaternion::fromEuler(0.1, 0.2, 0.3);
+    const Quaternion qb = Quaternion::fromEuler(-0.3, 0.4, 0.9);
+
+    BENCHMARK("4x4 product") { return a4 * b4; };
+    BENCHMARK("4x4 product, naive") { return naive(a4, b4); };
+
+    BENCHMARK("3x3 vector product") { return a3 * v3; };
+    BENCHMARK("3x3 vector product, naive") { return naive(a3, v3); };
+
+    BENCHMARK("quaternion product") { return qa = qa * qb; };
+
+    BENCHMARK("4-vector dot") { return a4.row(0).dot(a4.row(1)); };
+}
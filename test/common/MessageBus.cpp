@@ -0,0 +1,160 @@
+/**
+ * @file MessageBus.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the MessageBus class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "common/MessageBus.h"
+#include "sim/PhysicsBackend.h"
+
+using namespace Dae;
+
+using Telemetry = PhysicsBackend::Telemetry;
+
+/**
+ * @brief Make telemetry whose every field is `value`.
+ */
+static Telemetry filled(double value) {
+    Telemetry t;
+    t.timestamp = value;
+    for (int i = 0; i < 3; i++) {
+        t.gyro[i]     = value;
+        t.accel[i]    = value;
+        t.position[i] = value;
+        t.velocity[i] = value;
+    }
+    for (int i = 0; i < 4; i++) {
+        t.quaternion[i] = value;
+    }
+    return t;
+}
+
+/**
+ * @brief Check that every field of telemetry has the same value.
+ */
+static bool consistent(const Telemetry& t) {
+    for (int i = 0; i < 3; i++) {
+        if (t.gyro[i] != t.timestamp || t.accel[i] != t.timestamp ||
+            t.position[i] != t.timestamp || t.velocity[i] != t.timestamp) {
+            return false;
+        }
+    }
+    for (int i = 0; i < 4; i++) {
+        if (t.quaternion[i] != t.timestamp) return false;
+    }
+    return true;
+}
+
+TEST_CASE("MessageBus topics fan messages out to every subscriber",
+          "[MessageBus]") {
+    Topic<Telemetry>* topic = MessageBus::topic<Telemetry>("bus_test_fanout");
+    REQUIRE(topic != nullptr);
+    REQUIRE(MessageBus::topic<Telemetry>("bus_test_fanout") == topic);
+    REQUIRE(MessageBus::topic<double>("bus_test_fanout") == nullptr);
+
+    Subscriber<Telemetry> estimator(topic);
+    Subscriber<Telemetry> logger(topic);
+
+    Telemetry out;
+    REQUIRE_FALSE(estimator.updated());
+    REQUIRE_FALSE(estimator.copy(out));
+
+    topic->publish(filled(1));
+    REQUIRE(estimator.update(out));
+    REQUIRE(out.timestamp == 1);
+    REQUIRE_FALSE(estimator.update(out));
+
+    // Each subscriber tracks what it has seen
+    topic->publish(filled(2));
+    REQUIRE(logger.update(out));
+    REQUIRE(out.timestamp == 2);
+    REQUIRE(estimator.update(out));
+    REQUIRE(topic->latest() == 2);
+
+    // Visiting reads in place
+    double seen = 0;
+    topic->visit([&](const Telemetry& t, uint64_t) { seen = t.gyro[0]; });
+    REQUIRE(seen == 2);
+}
+
+TEST_CASE("MessageBus subscribers are throttled to their interval",
+          "[MessageBus]") {
+    Topic<int, 2>      topic;
+    Subscriber<int, 2> fast(&topic);
+    Subscriber<int, 2> slow(&topic, 60.0);
+
+    int fastCount = 0;
+    int slowCount = 0;
+    int out;
+    for (int i = 0; i < 100; i++) {
+        topic.publish(i);
+        if (fast.update(out)) fastCount++;
+        if (slow.update(out)) slowCount++;
+    }
+
+    REQUIRE(fastCount == 100);
+    REQUIRE(slowCount == 1);
+    REQUIRE(slow.updated());
+}
+
+TEST_CASE("MessageBus readers never see a torn message", "[MessageBus]") {
+    Topic<Telemetry> topic;
+
+    std::atomic<bool> running{true};
+    std::atomic<int>  torn{0};
+    std::atomic<int>  reads{0};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; i++) {
+        readers.emplace_back([&] {
+            Subscriber<Telemetry> sub(&topic);
+            Telemetry             t;
+            while (running.load(std::memory_order_relaxed)) {
+                if (!sub.update(t)) continue;
+                if (!consistent(t)) torn++;
+                reads++;
+            }
+        });
+    }
+
+    for (int i = 1; i <= 200000 || reads.load() < 1000; i++) {
+        topic.publish(filled(i));
+    }
+
+    running.store(false, std::memory_order_relaxed);
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    REQUIRE(torn.load() == 0);
+}
+
+TEST_CASE("MessageBus latency", "[MessageBus][.][benchmark]") {
+    Topic<Telemetry>      topic;
+    Subscriber<Telemetry> sub(&topic);
+    Telemetry             t = filled(1);
+
+    BENCHMARK("publish") {
+        topic.publish(t);
+        return topic.latest();
+    };
+
+    BENCHMARK("update") {
+        topic.publish(t);
+        return sub.update(t);
+    };
+
+    BENCHMARK("visit") {
+        double sum = 0;
+        topic.visit([&](const Telemetry& m, uint64_t) { sum = m.gyro[0]; });
+        return sum;
+    };
+}
@@ -0,0 +1,139 @@
+/**
+ * @file Pipeline.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the Pipeline class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "common/Pipeline.h"
+
+using namespace Dae;
+
+/**
+ * @brief A frame passed between the test stages.
+ */
+struct Frame {
+    /// @brief Sequence number set by the source.
+    int sequence;
+    /// @brief Value built up by the stages.
+    double value;
+};
+
+/**
+ * @brief Wait up to a second for a condition.
+ */
+template <typename Fn> static bool waitFor(Fn&& done) {
+    for (int i = 0; i < 1000 && !done(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return done();
+}
+
+TEST_CASE("Pipeline passes every frame through every stage in order",
+          "[Pipeline]") {
+    Pipeline<Frame> pipeline;
+
+    const int        total = 500;
+    std::atomic<int> produced{0};
+    std::vector<int> outputs;
+    std::atomic<int> outputCount{0};
+
+    pipeline.addStage("io", [&](Frame& frame) {
+        if (produced.load() >= total) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            return false;
+        }
+        frame.sequence = produced++;
+        frame.value    = 1;
+
+        // Let the queues keep up, the test is about ordering
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+        return true;
+    });
+    pipeline.addStage("estimation", [](Frame& frame) {
+        frame.value *= 2;
+        return true;
+    });
+    pipeline.addStage("control", [](Frame& frame) {
+        frame.value += 1;
+        return frame.sequence % 10 != 9;
+    });
+    pipeline.addStage("output", [&](Frame& frame) {
+        if (frame.value == 3) outputs.push_back(frame.sequence);
+        outputCount++;
+        return true;
+    });
+
+    REQUIRE(pipeline.start() == Pipeline<Frame>::ST_GOOD);
+    REQUIRE(pipeline.start() == Pipeline<Frame>::ST_RUNNING);
+    REQUIRE(waitFor([&] { return outputCount.load() == total * 9 / 10; }));
+    pipeline.stop();
+
+    // Control dropped every tenth frame
+    REQUIRE(outputs.size() == total * 9 / 10);
+    for (size_t i = 1; i < outputs.size(); i++) {
+        REQUIRE(outputs[i] > outputs[i - 1]);
+    }
+
+    REQUIRE(pipeline.completed() == total * 9 / 10);
+    REQUIRE(pipeline.stats(0).frames == total);
+    REQUIRE(pipeline.stats(3).frames == total * 9 / 10);
+
+    double latency;
+    REQUIRE(pipeline.latency(0, latency));
+    REQUIRE(latency > 0);
+    REQUIRE(latency <= pipeline.maxLatency());
+    REQUIRE_FALSE(pipeline.latency(9, latency));
+}
+
+TEST_CASE("Pipeline skips stale frames behind an overrunning stage",
+          "[Pipeline]") {
+    Pipeline<Frame, 4> pipeline;
+
+    std::atomic<int> produced{0};
+    std::atomic<int> controlled{0};
+    int              last    = -1;
+    int              lag     = 0;
+    bool             ordered = true;
+
+    pipeline.addStage("io", [&](Frame& frame) {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        frame.sequence = produced++;
+        return true;
+    });
+    pipeline.addStage(
+        "control",
+        [&](Frame& frame) {
+            if (frame.sequence <= last) ordered = false;
+            last = frame.sequence;
+            lag  = std::max(lag, produced.load() - frame.sequence);
+            controlled++;
+
+            // Far slower than the source
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            return true;
+        },
+        Pipeline<Frame, 4>::PL_LATEST, 0.001);
+
+    REQUIRE(pipeline.start() == Pipeline<Frame, 4>::ST_GOOD);
+    REQUIRE(waitFor([&] { return controlled.load() >= 10; }));
+    pipeline.stop();
+
+    const auto stats = pipeline.stats(1);
+    REQUIRE(ordered);
+    REQUIRE(stats.overruns == stats.frames);
+    REQUIRE(stats.skipped > 0);
+    REQUIRE(stats.maxTime >= 0.005);
+
+    // The control stage always worked on a recent frame
+    REQUIRE(lag <= 3);
+}
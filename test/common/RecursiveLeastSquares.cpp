@@ -0,0 +1,94 @@
+/**
+ * @file RecursiveLeastSquares.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the RecursiveLeastSquares class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include "common/RecursiveLeastSquares.h"
+
+using namespace Dae;
+
+using Catch::Matchers::WithinAbs;
+using Catch::Matchers::WithinRel;
+
+/// @brief A cap that is never reached.
+static constexpr double NO_CAP = std::numeric_limits<double>::infinity();
+
+TEST_CASE("RecursiveLeastSquares matches the covariance form",
+          "[RecursiveLeastSquares]") {
+    using Rls = RecursiveLeastSquares<4>;
+
+    constexpr double LAMBDA = 0.98;
+
+    std::mt19937                           rng(3);
+    std::uniform_real_distribution<double> range(-1, 1);
+
+    Rls             rls;
+    Rls::Parameters theta = Rls::Parameters::zero();
+    Rls::Covariance p     = Rls::Covariance::identity() * 10.0;
+    rls.reset(theta, 10.0);
+
+    for (int step = 0; step < 200; step++) {
+        const Rls::Regressor phi = {
+            {range(rng), range(rng), range(rng), 1.0}};
+        const double y = 2 * phi[0] - phi[1] + 0.5 * phi[2] + 0.1 +
+                         0.01 * range(rng);
+
+        // P = (P - P phi phi' P / (lambda + phi' P phi)) / lambda
+        const Rls::Parameters pPhi = p * phi;
+        const double          s    = LAMBDA + phi.dot(pPhi);
+        const Rls::Parameters gain = pPhi / s;
+        theta.mulAdd(gain, y - phi.dot(theta));
+        p = (p - gain * pPhi.transpose()) / LAMBDA;
+
+        rls.update(phi, y, LAMBDA, NO_CAP);
+    }
+
+    const Rls::Covariance covariance = rls.covariance();
+    for (size_t i = 0; i < 4; i++) {
+        REQUIRE_THAT(rls.parameters()[i], WithinAbs(theta[i], 1e-9));
+        for (size_t j = 0; j < 4; j++) {
+            REQUIRE_THAT(covariance(i, j),
+                         WithinAbs(p(i, j), 1e-9 * std::abs(p(i, i))));
+            REQUIRE(covariance(i, j) == covariance(j, i));
+        }
+    }
+    REQUIRE_THAT(rls.parameters()[0], WithinAbs(2.0, 0.01));
+    REQUIRE_THAT(rls.parameters()[3], WithinAbs(0.1, 0.01));
+}
+
+TEST_CASE("RecursiveLeastSquares forgets to track a step",
+          "[RecursiveLeastSquares]") {
+    using Rls = RecursiveLeastSquares<2>;
+
+    std::mt19937                           rng(5);
+    std::uniform_real_distribution<double> range(-1, 1);
+
+    Rls rls;
+    rls.reset(Rls::Parameters::zero(), 100.0);
+
+    double slope = 3;
+    for (int step = 0; step < 2000; step++) {
+        if (step == 1000) slope = -1;
+
+        const Rls::Regressor phi = {{range(rng), 1.0}};
+        rls.update(phi, slope * phi[0] + 0.5, 0.99, 1e4);
+    }
+    REQUIRE_THAT(rls.parameters()[0], WithinRel(-1.0, 1e-3));
+    REQUIRE_THAT(rls.parameters()[1], WithinRel(0.5, 1e-3));
+
+    // Without excitation the variance stays near the cap on its factor
+    for (int step = 0; step < 5000; step++) {
+        rls.update(Rls::Regressor::zero(), 0, 0.99, 1e4);
+    }
+    REQUIRE(rls.covariance()(0, 0) < 2e4);
+    REQUIRE_THAT(rls.parameters()[0], WithinRel(-1.0, 1e-3));
+}
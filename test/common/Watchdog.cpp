@@ -0,0 +1,99 @@
+/**
+ * @file Watchdog.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the Watchdog class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "common/Watchdog.h"
+
+using namespace Dae;
+
+/**
+ * @brief Wait up to a second for a condition.
+ */
+template <typename Fn> static bool waitFor(Fn&& done) {
+    for (int i = 0; i < 1000 && !done(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return done();
+}
+
+// The timeouts are tuned per test, which a frozen build rejects
+#ifndef DAE_FROZEN_CONFIG
+TEST_CASE("Watchdog escalates while telemetry is missing and recovers",
+          "[Watchdog]") {
+    Watchdog watchdog("TestWatchdog");
+    watchdog.cnf({{"period", 0.001},
+                  {"frame_period", 0.01},
+                  {"late_frames", 2},
+                  {"failsafe_frames", 4},
+                  {"lost_timeout", 0.2}});
+
+    std::atomic<int> late{0};
+    std::atomic<int> failsafe{0};
+    std::atomic<int> recovered{0};
+    watchdog.setAction(Watchdog::LV_LATE, [&] { late++; });
+    watchdog.setAction(Watchdog::LV_FAILSAFE, [&] { failsafe++; });
+    watchdog.setAction(Watchdog::LV_OK, [&] { recovered++; });
+
+    REQUIRE(watchdog.start() == Watchdog::ST_GOOD);
+    REQUIRE(watchdog.start() == Watchdog::ST_RUNNING);
+
+    // Regular telemetry never trips it
+    for (int i = 0; i < 50; i++) {
+        watchdog.feed();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    REQUIRE(watchdog.level() == Watchdog::LV_OK);
+    REQUIRE(watchdog.trips() == 0);
+
+    // A stall is caught as soon as it passes each timeout
+    const auto stalled = std::chrono::steady_clock::now();
+    REQUIRE(waitFor([&] { return failsafe.load() == 1; }));
+    const double caught = std::chrono::duration<double>(
+                              std::chrono::steady_clock::now() - stalled)
+                              .count();
+    REQUIRE(late.load() == 1);
+    REQUIRE(watchdog.level() == Watchdog::LV_FAILSAFE);
+    REQUIRE(caught < 0.2);
+
+    watchdog.feed();
+    REQUIRE(waitFor([&] { return recovered.load() == 1; }));
+    REQUIRE(watchdog.level() == Watchdog::LV_OK);
+    REQUIRE(watchdog.trips() == 1);
+
+    REQUIRE(waitFor([&] { return watchdog.level() == Watchdog::LV_LOST; }));
+    REQUIRE(late.load() == 2);
+    REQUIRE(failsafe.load() == 2);
+
+    watchdog.stop();
+}
+
+TEST_CASE("Watchdog re-arms its timer when the period changes",
+          "[Watchdog]") {
+    Watchdog watchdog("TestWatchdogPeriod");
+    watchdog.cnf({{"period", 10.0}, {"lost_timeout", 100.0}});
+
+    std::atomic<int> failsafe{0};
+    watchdog.setAction(Watchdog::LV_FAILSAFE, [&] { failsafe++; });
+    REQUIRE(watchdog.start() == Watchdog::ST_GOOD);
+
+    // Checked every 10 s, so the default timeouts are long passed unseen
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE(watchdog.level() == Watchdog::LV_OK);
+
+    // Within a few frames of the new period
+    watchdog.cnf("period", 0.0005);
+    REQUIRE(waitFor([&] { return failsafe.load() == 1; }));
+
+    watchdog.stop();
+}
+#endif
@@ -0,0 +1,40 @@
+/**
+ * @file Airframe.h
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Simulated airframe for the rate controller tests.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#pragma once
+
+#include "common/Matrix.h"
+
+/// @brief Controller and gyro rate (Hz).
+static constexpr double RATE = 400;
+
+/// @brief Integration steps of the simulated airframe per control tick.
+static constexpr int SUBSTEPS = 10;
+
+/**
+ * @brief Rate dynamics of a simulated airframe, `dw/dt = a w + b u + c`,
+ * with an input per axis.
+ */
+struct Airframe {
+    Dae::Vector3 damping       = {{-6, -4, -1.5}};
+    Dae::Vector3 effectiveness = {{40, 25, 8}};
+    Dae::Vector3 bias          = {{0.5, -1, 0}};
+    Dae::Vector3 rate          = Dae::Vector3::zero();
+
+    void step(const Dae::Vector3& input) {
+        constexpr double h = 1 / (RATE * SUBSTEPS);
+        for (int i = 0; i < SUBSTEPS; i++) {
+            for (size_t axis = 0; axis < 3; axis++) {
+                rate[axis] += h * (damping[axis] * rate[axis] +
+                                   effectiveness[axis] * input[axis] +
+                                   bias[axis]);
+            }
+        }
+    }
+};
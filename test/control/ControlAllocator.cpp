@@ -0,0 +1,187 @@
+/**
+ * @file ControlAllocator.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the ControlAllocator class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "common/Logging.h"
+#include "control/ControlAllocator.h"
+
+using namespace Dae;
+
+using Catch::Matchers::WithinAbs;
+
+/// @brief Demand weight of the allocator under test.
+static constexpr double GAMMA = 1000;
+
+/// @brief Number of channels of the airframe under test.
+static constexpr size_t ACTUATORS = 8;
+
+/**
+ * @brief Configure an over-actuated airframe: split ailerons and elevators,
+ * a rudder, a canard and two motors with differential thrust.
+ */
+static void configure(ControlAllocator& allocator) {
+    allocator.cnf({{"gamma", GAMMA},
+                   {"ch0_roll", 0.8},
+                   {"ch0_yaw", 0.1},
+                   {"ch1_roll", -0.8},
+                   {"ch1_yaw", -0.1},
+                   {"ch2_pitch", 0.5},
+                   {"ch2_roll", 0.2},
+                   {"ch3_pitch", 0.5},
+                   {"ch3_roll", -0.2},
+                   {"ch4_yaw", 0.6},
+                   {"ch5_throttle", 0.5},
+                   {"ch5_yaw", 0.2},
+                   {"ch5_min", 0.0},
+                   {"ch6_throttle", 0.5},
+                   {"ch6_yaw", -0.2},
+                   {"ch6_min", 0.0},
+                   {"ch7_pitch", 0.3},
+                   {"ch7_trim", 0.1}});
+}
+
+/**
+ * @brief Check the optimality conditions of the last solution: the gradient
+ * of the cost vanishes for free actuators and pushes held ones into their
+ * limits. The cost is strictly convex, so they make it the optimum.
+ */
+static void requireOptimal(const ControlAllocator&         allocator,
+                           const ControlAllocator::Demand& demand) {
+    const ControlAllocator::Actuators& u     = allocator.positions();
+    const ControlAllocator::Demand     error = allocator.achieved() - demand;
+
+    REQUIRE(allocator.optimal());
+    for (size_t ch = 0; ch < ACTUATORS; ch++) {
+        const double lower = ch == 5 || ch == 6 ? 0.0 : -1.0;
+        const double trim  = ch == 7 ? 0.1 : 0.0;
+
+        double gradient = u[ch] - trim;
+        for (size_t axis = 0; axis < ControlAllocator::AXES; axis++) {
+            gradient += GAMMA * error[axis] * allocator.matrix()(axis, ch);
+        }
+
+        REQUIRE(u[ch] >= lower);
+        REQUIRE(u[ch] <= 1.0);
+        if (u[ch] == lower) {
+            REQUIRE(gradient >= -1e-6);
+        } else if (u[ch] == 1.0) {
+            REQUIRE(gradient <= 1e-6);
+        } else {
+            REQUIRE_THAT(gradient, WithinAbs(0, 1e-6));
+        }
+    }
+}
+
+TEST_CASE("ControlAllocator meets demands within the actuator limits",
+          "[ControlAllocator]") {
+    ControlAllocator allocator("TestAllocatorReachable");
+    configure(allocator);
+
+    const ControlAllocator::Demand demand = {{0.3, -0.2, 0.1, 0.5}};
+    ControlAllocator::Control      control{};
+    allocator.allocate(demand, control);
+
+    requireOptimal(allocator, demand);
+    for (size_t axis = 0; axis < ControlAllocator::AXES; axis++) {
+        REQUIRE_THAT(allocator.achieved()[axis],
+                     WithinAbs(demand[axis], 5e-3));
+    }
+
+    // Written to the control signal, unused channels at their trim
+    for (size_t ch = 0; ch < ControlAllocator::CHANNELS; ch++) {
+        REQUIRE(control.pwm[ch] == allocator.positions()[ch]);
+    }
+    REQUIRE(control.pwm[12] == 0);
+
+    // Redundant surfaces share the roll demand equally
+    REQUIRE_THAT(control.pwm[0], WithinAbs(-control.pwm[1], 0.05));
+}
+
+TEST_CASE("ControlAllocator is optimal when actuators saturate",
+          "[ControlAllocator]") {
+    ControlAllocator allocator("TestAllocatorSaturated");
+    configure(allocator);
+
+    std::mt19937                           rng(7);
+    std::uniform_real_distribution<double> range(-2.5, 2.5);
+
+    ControlAllocator::Control control{};
+    for (int i = 0; i < 500; i++) {
+        const ControlAllocator::Demand demand = {
+            {range(rng), range(rng), range(rng), range(rng)}};
+
+        // Warm and cold started solves
+        if (i % 2) allocator.reset();
+        const size_t iterations = allocator.allocate(demand, control);
+
+        REQUIRE(iterations <= ControlAllocator::MAX_ITERATIONS);
+        requireOptimal(allocator, demand);
+    }
+}
+
+TEST_CASE("ControlAllocator warm starts slowly changing demands",
+          "[ControlAllocator]") {
+    ControlAllocator allocator("TestAllocatorWarm");
+    configure(allocator);
+
+    ControlAllocator::Control control{};
+    size_t                    worst = 0;
+    for (int i = 0; i < 2000; i++) {
+        const double                   t      = i / 400.0;
+        const ControlAllocator::Demand demand = {
+            {1.2 * std::sin(t), 0.8 * std::cos(0.7 * t), 0.4 * std::sin(3 * t),
+             0.6}};
+
+        const size_t iterations = allocator.allocate(demand, control);
+        if (i > 0) worst = std::max(worst, iterations);
+        REQUIRE(allocator.optimal());
+    }
+    REQUIRE(worst <= 3);
+}
+
+TEST_CASE("ControlAllocator benchmark", "[.][benchmark]") {
+    ControlAllocator allocator("TestAllocatorBench");
+    configure(allocator);
+
+    // Search for the demand needing the most iterations from a cold start
+    std::mt19937                           rng(11);
+    std::uniform_real_distribution<double> range(-3, 3);
+
+    ControlAllocator::Control control{};
+    ControlAllocator::Demand  hardest = ControlAllocator::Demand::zero();
+    size_t                    worst   = 0;
+    for (int i = 0; i < 20000; i++) {
+        const ControlAllocator::Demand demand = {
+            {range(rng), range(rng), range(rng), range(rng)}};
+
+        allocator.reset();
+        const size_t iterations = allocator.allocate(demand, control);
+        if (iterations > worst) {
+            worst   = iterations;
+            hardest = demand;
+        }
+    }
+    info("Worst case %zu iterations of at most %zu", worst,
+         ControlAllocator::MAX_ITERATIONS);
+
+    BENCHMARK("cold start, worst case") {
+        allocator.reset();
+        return allocator.allocate(hardest, control);
+    };
+
+    const ControlAllocator::Demand demand = {{0.3, -0.2, 0.1, 0.5}};
+    allocator.allocate(demand, control);
+    BENCHMARK("warm start, unchanged demand") {
+        return allocator.allocate(demand, control);
+    };
+}
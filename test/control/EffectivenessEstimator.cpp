@@ -0,0 +1,83 @@
+/**
+ * @file EffectivenessEstimator.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the EffectivenessEstimator class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <cmath>
+#include <random>
+
+#include "control/EffectivenessEstimator.h"
+#include "Airframe.h"
+
+using namespace Dae;
+
+using Catch::Matchers::WithinRel;
+
+/**
+ * @brief Fly the airframe on random doublets, each axis on the channel of
+ * the default 'aileron' layout, updating the estimator.
+ */
+static void fly(Airframe& airframe, EffectivenessEstimator& estimator,
+                std::mt19937& rng, double seconds) {
+    std::uniform_real_distribution<double> range(-0.3, 0.3);
+    std::normal_distribution<double>       noise(0, 0.002);
+
+    EffectivenessEstimator::Control control{};
+    for (int i = 0; i < seconds * RATE; i++) {
+        // A new input every 50 ms
+        if (i % 20 == 0) {
+            control.pwm[0] = range(rng);
+            control.pwm[1] = range(rng);
+            control.pwm[3] = range(rng);
+        }
+        airframe.step({{control.pwm[0], control.pwm[1], control.pwm[3]}});
+
+        const Vector3 gyro = airframe.rate + Vector3{{noise(rng), noise(rng),
+                                                      noise(rng)}};
+        estimator.update(gyro, control, 1 / RATE);
+    }
+}
+
+TEST_CASE("EffectivenessEstimator identifies the rate dynamics",
+          "[EffectivenessEstimator]") {
+    EffectivenessEstimator estimator("TestEffectiveness");
+    Airframe               airframe;
+    std::mt19937           rng(13);
+
+    fly(airframe, estimator, rng, 20);
+    for (size_t axis = 0; axis < 3; axis++) {
+        REQUIRE_THAT(estimator.damping()[axis],
+                     WithinRel(airframe.damping[axis], 0.05));
+        REQUIRE_THAT(estimator.effectiveness()[axis],
+                     WithinRel(airframe.effectiveness[axis], 0.05));
+    }
+    REQUIRE_THAT(estimator.bias()[1], WithinRel(airframe.bias[1], 0.2));
+
+    // Losing half the roll authority is followed within seconds
+    airframe.effectiveness[0] /= 2;
+    fly(airframe, estimator, rng, 5);
+    REQUIRE_THAT(estimator.effectiveness()[0],
+                 WithinRel(airframe.effectiveness[0], 0.05));
+}
+
+TEST_CASE("EffectivenessEstimator benchmark", "[.][benchmark]") {
+    EffectivenessEstimator          estimator("TestEffectiveness");
+    EffectivenessEstimator::Control control{};
+    control.pwm[0] = 0.1;
+    control.pwm[1] = -0.2;
+    control.pwm[3] = 0.05;
+
+    Vector3 gyro = {{0.1, 0.2, 0.3}};
+    estimator.update(gyro, control, 1 / RATE);
+
+    BENCHMARK("update") {
+        gyro[0] = -gyro[0];
+        estimator.update(gyro, control, 1 / RATE);
+        return estimator.effectiveness()[0];
+    };
+}
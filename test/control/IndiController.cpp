@@ -0,0 +1,154 @@
+/**
+ * @file IndiController.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the IndiController class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "control/IndiController.h"
+#include "Airframe.h"
+
+using namespace Dae;
+
+using Catch::Matchers::WithinAbs;
+
+/**
+ * @brief Fly the airframe at a setpoint, each axis on the channel of the
+ * default 'aileron' layout, returning the largest error from it over the
+ * last half second.
+ */
+static double fly(Airframe& airframe, IndiController& indi,
+                  IndiController::Control& control, const Vector3& setpoint,
+                  std::mt19937& rng, double seconds) {
+    std::normal_distribution<double> noise(0, 0.002);
+
+    double    worst = 0;
+    const int ticks = static_cast<int>(seconds * RATE);
+    for (int i = 0; i < ticks; i++) {
+        airframe.step({{control.pwm[0], control.pwm[1], control.pwm[3]}});
+
+        const Vector3 gyro = airframe.rate + Vector3{{noise(rng), noise(rng),
+                                                      noise(rng)}};
+        indi.update(setpoint, gyro, 1 / RATE, control);
+
+        if (i < ticks - RATE / 2) continue;
+        for (size_t axis = 0; axis < 3; axis++) {
+            worst = std::max(worst,
+                             std::abs(airframe.rate[axis] - setpoint[axis]));
+        }
+    }
+    return worst;
+}
+
+TEST_CASE("IndiController tracks rates on a mismatched airframe",
+          "[IndiController]") {
+    IndiController indi("TestIndi");
+    indi.cnf({{"roll_effectiveness", 30},
+              {"pitch_effectiveness", 20},
+              {"yaw_effectiveness", 10}});
+
+    Airframe                airframe;
+    IndiController::Control control{};
+    std::mt19937            rng(17);
+
+    // Damping and bias are not modelled, and need no integrator
+    REQUIRE(fly(airframe, indi, control, {{1, -0.5, 0.3}}, rng, 1) < 0.02);
+    REQUIRE(fly(airframe, indi, control, {{-1, 0.5, -0.3}}, rng, 1) < 0.02);
+    REQUIRE(control.pwm[2] == 0);
+
+    // Neither does losing most of the roll authority, with a payload
+    airframe.effectiveness[0] = 12;
+    airframe.damping          = {{-2, -1.5, -1}};
+    airframe.bias             = {{3, -2, 0.5}};
+    REQUIRE(fly(airframe, indi, control, {{1, -0.5, 0.3}}, rng, 1) < 0.02);
+
+    // The filters see the same input, and agree on it at rest
+    for (size_t axis = 0; axis < 3; axis++) {
+        REQUIRE_THAT(indi.acceleration()[axis], WithinAbs(0, 0.5));
+        REQUIRE_THAT(indi.input()[axis], WithinAbs(indi.output()[axis], 0.01));
+    }
+
+    // A saturated channel does not wind up
+    REQUIRE(fly(airframe, indi, control, {{20, 0, 0}}, rng, 1) > 1);
+    REQUIRE(control.pwm[0] == 1);
+    REQUIRE(fly(airframe, indi, control, {{0, 0, 0}}, rng, 1) < 0.02);
+}
+
+TEST_CASE("IndiController filters the angular acceleration",
+          "[IndiController]") {
+    IndiController indi("TestIndiFilter");
+    indi.cnf({{"ch2_yaw", 1}, {"ch3_yaw", 0}});
+
+    IndiController::Control control{};
+    for (int i = 0; i <= 400; i++) {
+        // Hold the inputs, which are only fed back
+        control.pwm[0] = 0.1;
+        control.pwm[1] = -0.2;
+        control.pwm[2] = 0.3;
+
+        const double time = i / RATE;
+        indi.update(Vector3::zero(), {{2 * time, -time, 0.5}}, 1 / RATE,
+                    control);
+    }
+    REQUIRE_THAT(indi.acceleration()[0], WithinAbs(2, 1e-6));
+    REQUIRE_THAT(indi.acceleration()[1], WithinAbs(-1, 1e-6));
+    REQUIRE_THAT(indi.acceleration()[2], WithinAbs(0, 1e-6));
+    REQUIRE_THAT(indi.input()[0], WithinAbs(0.1, 1e-6));
+    REQUIRE_THAT(indi.input()[1], WithinAbs(-0.2, 1e-6));
+    REQUIRE_THAT(indi.input()[2], WithinAbs(0.3, 1e-6));
+    REQUIRE(control.pwm[3] == 0);
+}
+
+// The cutoff is tuned per test, which a frozen build rejects
+#ifndef DAE_FROZEN_CONFIG
+TEST_CASE("IndiController keeps its runtime state across a reconfigure",
+          "[IndiController]") {
+    IndiController indi("TestIndiReconfigure");
+
+    IndiController::Control control{};
+    for (int i = 0; i <= 400; i++) {
+        const double time = i / RATE;
+        indi.update(Vector3::zero(), {{2 * time, 0, 0}}, 1 / RATE, control);
+    }
+    indi.setEffectiveness({{12, 15, 18}});
+    const Vector3 acceleration = indi.acceleration();
+
+    // The filters and the estimated effectiveness carry on
+    indi.cnf({{"roll_gain", 25.0}, {"cutoff", 25.0}});
+    REQUIRE(indi.acceleration()[0] == acceleration[0]);
+    REQUIRE(indi.effectiveness()[0] == 12);
+    REQUIRE(indi.effectiveness()[1] == 15);
+    REQUIRE(indi.effectiveness()[2] == 18);
+
+    // Unless the configured effectiveness of an axis changes
+    indi.cnf({{"pitch_effectiveness", 30.0}});
+    REQUIRE(indi.effectiveness()[0] == 12);
+    REQUIRE(indi.effectiveness()[1] == 30);
+    REQUIRE(indi.effectiveness()[2] == 18);
+
+    indi.reset();
+    REQUIRE(indi.effectiveness()[0] == 20);
+    REQUIRE(indi.acceleration()[0] == 0);
+}
+#endif
+
+TEST_CASE("IndiController benchmark", "[.][benchmark]") {
+    IndiController          indi("TestIndiBenchmark");
+    IndiController::Control control{};
+    const Vector3           setpoint = {{0.5, -0.2, 0.1}};
+    Vector3                 gyro     = {{0.1, 0.2, 0.3}};
+    indi.update(setpoint, gyro, 1 / RATE, control);
+
+    BENCHMARK("update") {
+        gyro[0] = -gyro[0];
+        indi.update(setpoint, gyro, 1 / RATE, control);
+        return control.pwm[0];
+    };
+}
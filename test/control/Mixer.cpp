@@ -0,0 +1,120 @@
+/**
+ * @file Mixer.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the Mixer class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <string>
+
+#include "control/Mixer.h"
+
+using namespace Dae;
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("Mixer presets mix the demands", "[Mixer]") {
+    Mixer mixer("TestMixerPreset");
+
+    const Mixer::Demand demand = {{0.2, 0.3, -0.4, 0.75}};
+    Mixer::Control      control{};
+
+    mixer.cnf({{"airframe", "elevon"}});
+    mixer.mix(demand, control);
+    REQUIRE_THAT(control.pwm[0], WithinAbs(0.5, 1e-12));
+    REQUIRE_THAT(control.pwm[1], WithinAbs(0.1, 1e-12));
+    REQUIRE_THAT(control.pwm[2], WithinAbs(0.5, 1e-12));
+    REQUIRE_THAT(control.pwm[3], WithinAbs(-0.4, 1e-12));
+
+    mixer.cnf({{"airframe", "vtail"}});
+    mixer.mix(demand, control);
+    REQUIRE_THAT(control.pwm[1], WithinAbs(-0.1, 1e-12));
+    REQUIRE_THAT(control.pwm[3], WithinAbs(0.7, 1e-12));
+
+    // Differential thrust, both motors clamped to the channel range
+    mixer.cnf({{"airframe", "twin"}});
+    mixer.mix({{0, 0, 0.4, 1.0}}, control);
+    REQUIRE_THAT(control.pwm[2], WithinAbs(1.0, 1e-12));
+    REQUIRE_THAT(control.pwm[4], WithinAbs(0.8, 1e-12));
+
+    // Unused channels, and every channel of an unknown airframe, are zero
+    for (size_t ch = 5; ch < Mixer::CHANNELS; ch++) {
+        REQUIRE(control.pwm[ch] == 0);
+    }
+    mixer.cnf({{"airframe", "biplane"}});
+    REQUIRE(mixer.matrix() == Mixer::Weights::zero());
+}
+
+TEST_CASE("Mixer applies the channel trims, reversals, limits and expo",
+          "[Mixer]") {
+    Mixer mixer("TestMixerChannels");
+    mixer.cnf({{"airframe", "flaperon"},
+               {"ch0_trim", 0.1},
+               {"ch0_expo", 0.5},
+               {"ch1_reverse", true},
+               {"ch1_max", 0.2},
+               {"ch2_reverse", true},
+               {"ch2_expo", 0.5},
+               {"ch4_trim", 0.1},
+               {"ch4_expo", 0.5},
+               {"ch7_pitch", 0.5},
+               {"ch7_yaw", 0.5},
+               {"ch7_throttle", 0.4},
+               {"ch7_min", -0.3},
+               {"ch7_expo", 1.0}});
+
+    // Every channel, against the formula
+    const double expo[Mixer::CHANNELS] = {0.5, 0, 0.5, 0, 0.5, 0, 0, 1.0};
+    for (double t = -1; t <= 1; t += 0.05) {
+        const Mixer::Demand demand = {{t, -0.8 * t, 0.6 * t, (t + 1) / 2}};
+        Mixer::Control      control{};
+        mixer.mix(demand, control);
+
+        const Mixer::Weights& m = mixer.matrix();
+        for (size_t ch = 0; ch < Mixer::CHANNELS; ch++) {
+            double x = 0;
+            for (size_t axis = 0; axis < Mixer::AX_THROTTLE; axis++) {
+                x += m(ch, axis) * demand[axis];
+            }
+            const double t = m(ch, Mixer::AX_THROTTLE) * demand[3];
+
+            const double e     = expo[ch];
+            const double trim  = ch == 0 || ch == 4 ? 0.1
+                                 : ch == 2         ? 1
+                                 : ch == 7         ? -1
+                                                   : 0;
+            const double lower = ch == 7 ? -0.3 : -1;
+            const double upper = ch == 1 ? 0.2 : 1;
+            const double out   = trim + t + (1 - e) * x + e * x * x * x;
+            REQUIRE_THAT(control.pwm[ch],
+                         WithinAbs(std::clamp(out, lower, upper), 1e-12));
+        }
+    }
+
+    // The reversed throttle spans the channel, from 1 down to -1
+    Mixer::Control control{};
+    mixer.mix({{0, 0, 0, 0}}, control);
+    REQUIRE(control.pwm[2] == 1);
+    mixer.mix({{0, 0, 0, 1}}, control);
+    REQUIRE(control.pwm[2] == -1);
+
+    REQUIRE(mixer.matrix()(1, Mixer::AX_PITCH) == -1);
+    REQUIRE(mixer.matrix()(4, Mixer::AX_ROLL) == -1);
+    REQUIRE(mixer.matrix()(7, Mixer::AX_YAW) == 0.5);
+}
+
+TEST_CASE("Mixer benchmark", "[.][benchmark]") {
+    Mixer mixer("TestMixerBench");
+    mixer.cnf({{"airframe", "twin"}, {"ch0_expo", 0.3}, {"ch1_expo", 0.3}});
+
+    Mixer::Demand  demand = {{0.1, -0.2, 0.3, 0.6}};
+    Mixer::Control control{};
+    BENCHMARK("mix") {
+        mixer.mix(demand, control);
+        return control.pwm[0];
+    };
+}
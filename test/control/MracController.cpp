@@ -0,0 +1,196 @@
+/**
+ * @file MracController.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the MracController class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <cmath>
+#include <string>
+
+#include "control/MracController.h"
+#include "control/PidBank.h"
+#include "Airframe.h"
+
+using namespace Dae;
+
+/// @brief Bandwidth of the reference model (1/s).
+static constexpr double BANDWIDTH = 10;
+
+/**
+ * @brief Closed loop of an airframe and a rate controller, following a
+ * square wave, scored against the ideal first order response.
+ */
+struct Loop {
+    Airframe airframe;
+    Vector3  ideal = Vector3::zero();
+    double   time  = 0;
+
+    /**
+     * @brief Fly for a time, returning the RMS error of each axis from the
+     * ideal response.
+     */
+    template <typename Controller>
+    Vector3 fly(Controller&& controller, double seconds) {
+        Vector3   error = Vector3::zero();
+        const int ticks = static_cast<int>(seconds * RATE);
+        for (int i = 0; i < ticks; i++) {
+            // A different period per axis, so the axes do not move together
+            const Vector3 setpoint = {{std::sin(2 * M_PI * time / 2.0) > 0
+                                           ? 1.0
+                                           : -1.0,
+                                       std::sin(2 * M_PI * time / 3.0) > 0
+                                           ? 0.5
+                                           : -0.5,
+                                       std::sin(2 * M_PI * time / 4.0) > 0
+                                           ? 0.3
+                                           : -0.3}};
+
+            airframe.step(controller(setpoint, airframe.rate));
+            ideal += (setpoint - ideal) * (BANDWIDTH / RATE);
+            time  += 1 / RATE;
+
+            for (size_t axis = 0; axis < 3; axis++) {
+                const double e  = airframe.rate[axis] - ideal[axis];
+                error[axis]    += e * e;
+            }
+        }
+        for (size_t axis = 0; axis < 3; axis++) {
+            error[axis] = std::sqrt(error[axis] / ticks);
+        }
+        return error;
+    }
+
+    /// @brief Lose most of the roll authority, and add a payload.
+    void damage(void) {
+        airframe.effectiveness[0] = 12;
+        airframe.damping          = {{-2, -1.5, -1}};
+        airframe.effectiveness[1] = 15;
+        airframe.bias             = {{3, -2, 0.5}};
+    }
+};
+
+// The PID gains are tuned per test, which a frozen build rejects
+#ifndef DAE_FROZEN_CONFIG
+TEST_CASE("MracController outperforms the PID bank after damage",
+          "[MracController]") {
+    MracController mrac("TestMrac");
+    mrac.cnf({{"roll_effectiveness", 40},
+              {"pitch_effectiveness", 25},
+              {"yaw_effectiveness", 8},
+              {"roll_bandwidth", BANDWIDTH},
+              {"pitch_bandwidth", BANDWIDTH},
+              {"yaw_bandwidth", BANDWIDTH}});
+
+    // Start from the ideal gains of the nominal airframe
+    mrac.reset();
+
+    // A PID loop per axis, tuned for the nominal airframe
+    PidBank                  bank;
+    static const char* const NAMES[3] = {"Roll", "Pitch", "Yaw"};
+    for (size_t axis = 0; axis < 3; axis++) {
+        const std::string key = std::string("TestMracPid") + NAMES[axis];
+        REQUIRE(bank.add(key) == PidBank::ST_GOOD);
+        bank.gains(axis).cnf({{"kp", 0.25}, {"ki", 2.0}});
+    }
+
+    auto adaptive = [&](const Vector3& setpoint, const Vector3& rate) {
+        return mrac.update(setpoint, rate, 1 / RATE);
+    };
+    auto pid = [&](const Vector3& setpoint, const Vector3& rate) {
+        for (size_t axis = 0; axis < 3; axis++) {
+            bank.setpoint(axis, setpoint[axis]);
+            bank.measure(axis, rate[axis]);
+        }
+        bank.evaluate(1 / RATE);
+        return Vector3{{bank.output(0), bank.output(1), bank.output(2)}};
+    };
+
+    Loop adaptiveLoop, pidLoop;
+    adaptiveLoop.fly(adaptive, 20);
+    pidLoop.fly(pid, 20);
+
+    adaptiveLoop.damage();
+    pidLoop.damage();
+    adaptiveLoop.fly(adaptive, 30);
+    pidLoop.fly(pid, 30);
+
+    const Vector3 adaptiveError = adaptiveLoop.fly(adaptive, 12);
+    const Vector3 pidError      = pidLoop.fly(pid, 12);
+    info("MRAC error %.4f %.4f %.4f, PID error %.4f %.4f %.4f",
+         adaptiveError[0], adaptiveError[1], adaptiveError[2], pidError[0],
+         pidError[1], pidError[2]);
+
+    for (size_t axis = 0; axis < 3; axis++) {
+        REQUIRE(adaptiveError[axis] < 0.5 * pidError[axis]);
+        REQUIRE(std::abs(mrac.rateGain()[axis]) <= 2.0);
+        REQUIRE(std::abs(mrac.setpointGain()[axis]) <= 2.0);
+        REQUIRE(std::abs(mrac.offset()[axis]) <= 2.0);
+    }
+}
+#endif
+
+TEST_CASE("MracController projects its gains onto the bounds",
+          "[MracController]") {
+    MracController mrac("TestMracProjection");
+    mrac.cnf({{"roll_gain_limit", 0.5}, {"roll_adaptation", 1000}});
+
+    // An output with no effect drives the gains as far as they can go
+    Vector3 rate = {{0.2, 0, 0}};
+    for (int i = 0; i < 4000; i++) {
+        rate[0] = i % 400 < 200 ? 0.2 : -0.2;
+        mrac.update({{0.1, 0, 0}}, rate, 1 / RATE);
+        REQUIRE(std::abs(mrac.rateGain()[0]) <= 0.5);
+        REQUIRE(std::abs(mrac.setpointGain()[0]) <= 0.5);
+        REQUIRE(std::abs(mrac.offset()[0]) <= 0.5);
+    }
+    REQUIRE(std::abs(mrac.output()[0]) <= 1.0);
+
+    mrac.reset();
+    REQUIRE(mrac.rateGain()[0] == -0.5);
+    REQUIRE(mrac.setpointGain()[0] == 0.5);
+    REQUIRE(mrac.offset()[0] == 0);
+}
+
+TEST_CASE("MracController keeps its adapted gains across a reconfigure",
+          "[MracController]") {
+    MracController mrac("TestMracReconfigure");
+
+    Vector3 rate = {{0.2, 0, 0}};
+    for (int i = 0; i < 400; i++) {
+        mrac.update({{0.5, 0, 0}}, rate, 1 / RATE);
+    }
+    const Vector3 kx = mrac.rateGain();
+    const Vector3 kr = mrac.setpointGain();
+    const Vector3 kc = mrac.offset();
+    REQUIRE(kc[0] != 0);
+
+    // Adaptation and bandwidth changes leave the gains where they are
+    mrac.cnf({{"roll_adaptation", 4.0}, {"roll_bandwidth", 12.0}});
+    for (size_t axis = 0; axis < 3; axis++) {
+        REQUIRE(mrac.rateGain()[axis] == kx[axis]);
+        REQUIRE(mrac.setpointGain()[axis] == kr[axis]);
+        REQUIRE(mrac.offset()[axis] == kc[axis]);
+    }
+
+    // A tighter limit projects them onto the new bounds
+    const double limit = std::abs(kc[0]) / 2;
+    mrac.cnf({{"roll_gain_limit", limit}});
+    REQUIRE(std::abs(mrac.rateGain()[0]) <= limit);
+    REQUIRE(std::abs(mrac.setpointGain()[0]) <= limit);
+    REQUIRE(std::abs(mrac.offset()[0]) == limit);
+}
+
+TEST_CASE("MracController benchmark", "[.][benchmark]") {
+    MracController mrac("TestMracBenchmark");
+    Vector3        setpoint = {{0.5, -0.2, 0.1}};
+    Vector3        rate     = {{0.1, 0.2, 0.3}};
+
+    BENCHMARK("update") {
+        rate[0] = -rate[0];
+        return mrac.update(setpoint, rate, 1 / RATE)[0];
+    };
+}
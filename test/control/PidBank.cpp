@@ -0,0 +1,248 @@
+/**
+ * @file PidBank.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the PidBank class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "control/PidBank.h"
+
+using namespace Dae;
+
+using Catch::Matchers::WithinAbs;
+
+/// @brief Controller rate (Hz).
+static constexpr double RATE = 400;
+
+/**
+ * @brief One PID loop, evaluated the plain way.
+ */
+struct Reference {
+    double kp, ki, kd, kff, kt, cutoff, iLimit, outMin, outMax;
+    double integral = 0, derivative = 0, previous = 0;
+    bool   fresh = true;
+
+    double evaluate(double r, double y, double dt) {
+        if (fresh) previous = y;
+        fresh = false;
+
+        const double tau  = cutoff > 0 ? 1 / (2 * M_PI * cutoff) : 0.0;
+        const double rate = -(y - previous) / dt;
+        derivative       += dt / (dt + tau) * (rate - derivative);
+        previous          = y;
+
+        const double e   = r - y;
+        const double u   = kp * e + integral + kd * derivative + kff * r;
+        const double out = std::clamp(u, outMin, outMax);
+        integral += (ki * e + kt * (out - u)) * dt;
+        integral  = std::clamp(integral, -iLimit, iLimit);
+        return out;
+    }
+};
+
+// The gains are tuned per test, which a frozen build rejects
+#ifndef DAE_FROZEN_CONFIG
+TEST_CASE("PidBank matches a scalar reference", "[PidBank]") {
+    // An odd number of loops covers the scalar tail
+    constexpr size_t LOOPS = 7;
+
+    PidBank   bank;
+    Reference reference[LOOPS];
+    for (size_t i = 0; i < LOOPS; i++) {
+        REQUIRE(bank.add("TestPidReference" + std::to_string(i)) ==
+                PidBank::ST_GOOD);
+
+        const double k = static_cast<double>(i);
+        reference[i]   = {0.8 + 0.1 * k, 0.5, 0.02 * k, 0.1, 2.0,
+                        i % 2 ? 20.0 : 0.0, 0.3, -1.0, 1.0};
+        bank.gains(i).cnf({{"kp", reference[i].kp},
+                           {"ki", reference[i].ki},
+                           {"kd", reference[i].kd},
+                           {"kff", reference[i].kff},
+                           {"kt", reference[i].kt},
+                           {"d_cutoff", reference[i].cutoff},
+                           {"i_limit", reference[i].iLimit}});
+    }
+
+    for (int step = 0; step < 2000; step++) {
+        const double time = step / RATE;
+        for (size_t i = 0; i < LOOPS; i++) {
+            const double k = static_cast<double>(i);
+            bank.setpoint(i, std::sin(time + k) * (1 + k));
+            bank.measure(i, std::cos(3 * time - k));
+        }
+        bank.evaluate(1 / RATE);
+
+        for (size_t i = 0; i < LOOPS; i++) {
+            const double k        = static_cast<double>(i);
+            const double expected = reference[i].evaluate(
+                std::sin(time + k) * (1 + k), std::cos(3 * time - k),
+                1 / RATE);
+            REQUIRE_THAT(bank.output(i), WithinAbs(expected, 1e-9));
+            REQUIRE_THAT(bank.integral(i),
+                         WithinAbs(reference[i].integral, 1e-9));
+        }
+    }
+}
+
+TEST_CASE("PidBank back-calculation limits overshoot", "[PidBank]") {
+    // A slow integrator plant driven to a far setpoint, with and without
+    // back-calculation
+    PidBank bank;
+    REQUIRE(bank.add("TestPidWindup") == PidBank::ST_GOOD);
+    REQUIRE(bank.add("TestPidUnwound") == PidBank::ST_GOOD);
+    bank.gains(0).cnf({{"kp", 2.0}, {"ki", 1.0}, {"kt", 0.0}});
+    bank.gains(1).cnf({{"kp", 2.0}, {"ki", 1.0}, {"kt", 4.0}});
+
+    double position[2]  = {0, 0};
+    double overshoot[2] = {0, 0};
+    for (int step = 0; step < 30 * RATE; step++) {
+        for (size_t i = 0; i < 2; i++) {
+            bank.setpoint(i, 5);
+            bank.measure(i, position[i]);
+        }
+        bank.evaluate(1 / RATE);
+
+        for (size_t i = 0; i < 2; i++) {
+            position[i] += bank.output(i) / RATE;
+            overshoot[i] = std::max(overshoot[i], position[i] - 5);
+        }
+    }
+
+    // Both settle, the clamp holds the integral of the first to its limit
+    REQUIRE_THAT(position[0], WithinAbs(5, 0.05));
+    REQUIRE_THAT(position[1], WithinAbs(5, 0.01));
+    REQUIRE(overshoot[1] < 0.1 * overshoot[0]);
+    REQUIRE(std::abs(bank.integral(0)) <= 1.0);
+}
+
+TEST_CASE("PidBank cascades loops and writes channels", "[PidBank]") {
+    PidBank bank;
+
+    // Angle to rate, rate to channel 2
+    REQUIRE(bank.add("TestPidAngle") == PidBank::ST_GOOD);
+    REQUIRE(bank.add("TestPidRate", 0, 2) == PidBank::ST_GOOD);
+    REQUIRE(bank.add("TestPidBadSource", 5) == PidBank::ST_BAD_SOURCE);
+    REQUIRE(bank.add("TestPidBadChannel", 0, 16) == PidBank::ST_BAD_CHANNEL);
+    REQUIRE(bank.add("TestPidThrottle", PidBank::NONE, 3) ==
+            PidBank::ST_BAD_SOURCE);
+    REQUIRE(bank.size() == 2);
+
+    bank.gains(0).cnf({{"kp", 4.0}, {"out_min", -2.0}, {"out_max", 2.0}});
+    bank.gains(1).cnf({{"kp", 0.5}});
+
+    bank.setpoint(0, 0.25);
+    bank.measure(0, 0.0);
+    bank.measure(1, 0.2);
+    bank.evaluate(1 / RATE);
+
+    REQUIRE_THAT(bank.output(0), WithinAbs(1.0, 1e-12));
+    REQUIRE_THAT(bank.output(1), WithinAbs(0.4, 1e-12));
+
+    PidBank::Control control{};
+    bank.write(control);
+    REQUIRE(control.pwm[2] == bank.output(1));
+    REQUIRE(control.pwm[0] == 0);
+
+    // Gain changes reach the next evaluation
+    bank.gains(1).cnf("kp", 1.0);
+    bank.evaluate(1 / RATE);
+    REQUIRE_THAT(bank.output(1), WithinAbs(0.8, 1e-12));
+
+    REQUIRE(bank.add("TestPidOuter") == PidBank::ST_BAD_SOURCE);
+    for (size_t i = bank.size(); i < PidBank::CAPACITY; i++) {
+        REQUIRE(bank.add("TestPidFill", 1) == PidBank::ST_GOOD);
+    }
+    REQUIRE(bank.add("TestPidFill", 1) == PidBank::ST_FULL);
+}
+
+TEST_CASE("PidBank gathers the setpoints of crossed cascades",
+          "[PidBank]") {
+    PidBank bank;
+
+    // The inner loops take their sources in the opposite order
+    REQUIRE(bank.add("TestPidOuterA") == PidBank::ST_GOOD);
+    REQUIRE(bank.add("TestPidOuterB") == PidBank::ST_GOOD);
+    REQUIRE(bank.add("TestPidInnerA", 1) == PidBank::ST_GOOD);
+    REQUIRE(bank.add("TestPidInnerB", 0) == PidBank::ST_GOOD);
+    for (size_t i = 0; i < bank.size(); i++) {
+        bank.gains(i).cnf({{"kp", 1.0}});
+        bank.measure(i, 0.0);
+    }
+
+    bank.setpoint(0, 0.2);
+    bank.setpoint(1, 0.6);
+    bank.evaluate(1 / RATE);
+
+    REQUIRE(bank.output(2) == bank.output(1));
+    REQUIRE(bank.output(3) == bank.output(0));
+    REQUIRE_THAT(bank.output(2), WithinAbs(0.6, 1e-12));
+    REQUIRE_THAT(bank.output(3), WithinAbs(0.2, 1e-12));
+}
+
+TEST_CASE("PidBank skips ticks without a time step", "[PidBank]") {
+    PidBank bank;
+    REQUIRE(bank.add("TestPidRepeated") == PidBank::ST_GOOD);
+    REQUIRE(bank.add("TestPidRepeatedPair") == PidBank::ST_GOOD);
+    for (size_t i = 0; i < bank.size(); i++) {
+        bank.gains(i).cnf({{"kp", 1.0}, {"ki", 0.5}});
+        bank.setpoint(i, 0.5);
+        bank.measure(i, 0.1);
+    }
+    bank.evaluate(1 / RATE);
+    const double output   = bank.output(0);
+    const double integral = bank.integral(0);
+
+    // A repeated timestamp keeps the last outputs
+    bank.evaluate(0);
+    REQUIRE(bank.output(0) == output);
+    REQUIRE(bank.integral(0) == integral);
+
+    bank.measure(0, 0.2);
+    bank.measure(1, 0.2);
+    bank.evaluate(1 / RATE);
+    for (size_t i = 0; i < bank.size(); i++) {
+        REQUIRE(std::isfinite(bank.output(i)));
+        REQUIRE(std::isfinite(bank.integral(i)));
+        REQUIRE_THAT(bank.output(i), WithinAbs(0.3 + integral, 1e-12));
+    }
+}
+#endif
+
+TEST_CASE("PidBank benchmark", "[.][benchmark]") {
+    // Altitude, speed, attitude and rate loops, 4 axes deep
+    constexpr size_t AXES = 4;
+
+    PidBank bank;
+    for (size_t layer = 0; layer < 4; layer++) {
+        for (size_t axis = 0; axis < AXES; axis++) {
+            const int source =
+                layer == 0 ? PidBank::NONE
+                           : static_cast<int>((layer - 1) * AXES + axis);
+            const int channel =
+                layer == 3 ? static_cast<int>(axis) : PidBank::NONE;
+            bank.add("TestPidBench" + std::to_string(layer), source, channel);
+        }
+    }
+    for (size_t i = 0; i < bank.size(); i++) {
+        bank.measure(i, 0.01 * static_cast<double>(i));
+    }
+    for (size_t axis = 0; axis < AXES; axis++) {
+        bank.setpoint(axis, 1);
+    }
+    bank.evaluate(1 / RATE);
+
+    PidBank::Control control{};
+    BENCHMARK("evaluate 16 loops") {
+        bank.evaluate(1 / RATE);
+        bank.write(control);
+        return control.pwm[0];
+    };
+}
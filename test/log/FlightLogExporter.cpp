@@ -0,0 +1,120 @@
+/**
+ * @file FlightLogExporter.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the FlightLogExporter class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "log/FlightLogExporter.h"
+#include "log/FlightRecorder.h"
+
+using namespace Dae;
+
+/// @brief Number of fields in a telemetry frame.
+static constexpr size_t FIELDS =
+    sizeof(PhysicsBackend::Telemetry) / sizeof(double);
+
+TEST_CASE("FlightLogExporter decodes compressed telemetry",
+          "[FlightLogExporter]") {
+    const std::string path = "flight_log_exporter_test.bin";
+
+    FlightRecorder recorder;
+    recorder.cnf("compress_telemetry", 1.0);
+    REQUIRE(recorder.open(path) == FlightRecorder::ST_GOOD);
+
+    // Not a whole number of blocks, so closing writes a partial one
+    std::vector<PhysicsBackend::Telemetry> frames(1000);
+    for (size_t i = 0; i < frames.size(); i++) {
+        PhysicsBackend::Telemetry& telem = frames[i];
+        const double               t     = static_cast<double>(i) * 0.0025;
+
+        telem               = {};
+        telem.timestamp     = t;
+        telem.gyro[1]       = std::cos(t) + 1e-3 * std::sin(41 * t);
+        telem.accel[2]      = -9.81 + 1e-2 * std::cos(53 * t);
+        telem.velocity[0]   = 2 + 1e-3 * std::sin(7 * t);
+        telem.quaternion[0] = 1.0;
+
+        recorder.writeTelemetry(static_cast<uint64_t>(i) * 2500, telem);
+    }
+    recorder.close();
+    REQUIRE(recorder.dropped() == 0);
+
+    const std::vector<std::string> labels = {
+        "T",  "GyrX", "GyrY", "GyrZ", "AccX", "AccY", "AccZ", "PN", "PE",
+        "PD", "VN",   "VE",   "VD",   "Q1",   "Q2",   "Q3",   "Q4"};
+    REQUIRE(labels.size() == FIELDS);
+
+    FlightLogExporter exporter;
+    REQUIRE(exporter.convert(path, ".", false) == FlightLogExporter::ST_GOOD);
+    REQUIRE(exporter.counts().at("TELZ") == frames.size());
+    REQUIRE(exporter.lostBlocks() == 0);
+    REQUIRE(exporter.skipped() == 0);
+
+    std::ifstream csv("TELZ.csv");
+    std::string   line;
+    REQUIRE(std::getline(csv, line).good());
+    REQUIRE(line == FlightLogExporter::TELEMETRY_LABELS);
+
+    // Doubles printed with 17 digits read back exactly
+    for (const PhysicsBackend::Telemetry& frame : frames) {
+        REQUIRE(std::getline(csv, line).good());
+
+        double      values[FIELDS];
+        const char* cursor = line.c_str();
+        for (size_t i = 0; i < FIELDS; i++) {
+            char* end = nullptr;
+            values[i] = strtod(cursor, &end);
+            REQUIRE(end != cursor);
+            cursor = *end == ',' ? end + 1 : end;
+        }
+        REQUIRE(memcmp(values, &frame, sizeof(frame)) == 0);
+    }
+    REQUIRE(!std::getline(csv, line));
+
+    remove("TELZ.csv");
+    remove("FMT.csv");
+
+    // The same frames, one file per field
+    REQUIRE(exporter.convert(path, ".", true) == FlightLogExporter::ST_GOOD);
+    REQUIRE(exporter.counts().at("TELZ") == frames.size());
+
+    for (size_t i = 0; i < FIELDS; i++) {
+        const std::string column = "TELZ." + labels[i] + ".f64";
+        std::ifstream     file(column, std::ios::binary);
+        REQUIRE(file.is_open());
+
+        std::vector<double> values(frames.size() + 1);
+        file.read(reinterpret_cast<char*>(values.data()),
+                  static_cast<std::streamsize>(values.size() * sizeof(double)));
+        REQUIRE(static_cast<size_t>(file.gcount()) ==
+                frames.size() * sizeof(double));
+
+        for (size_t f = 0; f < frames.size(); f++) {
+            double expected;
+            memcpy(&expected,
+                   reinterpret_cast<const double*>(&frames[f]) + i,
+                   sizeof(expected));
+            REQUIRE(memcmp(&values[f], &expected, sizeof(double)) == 0);
+        }
+
+        file.close();
+        remove(column.c_str());
+    }
+
+    remove("FMT.Type.f64");
+    remove("FMT.Length.f64");
+
+    remove(path.c_str());
+}
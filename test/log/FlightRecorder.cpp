@@ -0,0 +1,189 @@
+/**
+ * @file FlightRecorder.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the FlightRecorder and FlightLogReader classes.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "log/FlightLogReader.h"
+#include "log/FlightRecorder.h"
+
+using namespace Dae;
+
+TEST_CASE("FlightRecorder logs can be decoded by the FlightLogReader",
+          "[FlightRecorder]") {
+    const std::string path = "flight_recorder_test.bin";
+
+#pragma pack(push, 1)
+    struct Custom {
+        uint64_t timeUs;
+        int16_t  value;
+        char     tag[4];
+    };
+#pragma pack(pop)
+
+    FlightRecorder recorder;
+    recorder.cnf("buffer_size", 4096.0);
+    recorder.cnf("buffers", 4.0);
+    REQUIRE(recorder.define(FlightLog::MSG_USER, "CUST", "Qhn",
+                            "TimeUS,Val,Tag") == FlightRecorder::ST_GOOD);
+    REQUIRE(recorder.define(FlightLog::MSG_USER + 1, "BAD", "Qx", "A,B") ==
+            FlightRecorder::ST_BAD_FORMAT);
+    REQUIRE(recorder.open(path) == FlightRecorder::ST_GOOD);
+
+    const int frames = 500;
+    for (int i = 0; i < frames; i++) {
+        PhysicsBackend::Telemetry telem{};
+        telem.timestamp = i * 0.0025;
+        telem.gyro[2]   = i;
+        telem.quaternion[0] = 1.0;
+
+        PhysicsBackend::Control ctrl{};
+        ctrl.pwm[15] = -0.5;
+
+        recorder.writeTelemetry(static_cast<uint64_t>(i) * 2500, telem);
+        recorder.writeControl(static_cast<uint64_t>(i) * 2500, ctrl);
+        recorder.writeLoop({static_cast<uint64_t>(i) * 2500,
+                            static_cast<uint32_t>(i), 0.0025f, 0.0001f, 0});
+
+        if (i % 100 == 0) {
+            Custom custom{static_cast<uint64_t>(i), -42, {'a', 'b', 'c', 'd'}};
+            recorder.write(FlightLog::MSG_USER, custom);
+        }
+
+        // Give the writer a chance to keep up with the small buffers
+        if (i % 20 == 0) usleep(10000);
+    }
+    recorder.close();
+
+    REQUIRE(recorder.dropped() == 0);
+    REQUIRE(recorder.written() > 0);
+
+    FlightLogReader reader;
+    REQUIRE(reader.open(path) == FlightLogReader::ST_GOOD);
+
+    FlightLogReader::Record record;
+    int                     imu = 0, state = 0, high = 0, loop = 0, custom = 0;
+    while (reader.next(record)) {
+        const std::string& name = record.message->name;
+        if (name == "TELI") {
+            REQUIRE(record.values[1] == imu * 0.0025);
+            REQUIRE(record.values[4] == imu);
+            imu++;
+        } else if (name == "TELS") {
+            REQUIRE(record.message->labels[7] == "Q1");
+            REQUIRE(record.values[7] == 1.0);
+            state++;
+        } else if (name == "CTLH") {
+            REQUIRE(record.values[8] == -0.5);
+            high++;
+        } else if (name == "LOOP") {
+            REQUIRE(record.values[1] == loop);
+            loop++;
+        } else if (name == "CUST") {
+            REQUIRE(record.values[1] == -42);
+            REQUIRE(record.strings[2] == "abcd");
+            custom++;
+        }
+    }
+
+    REQUIRE(reader.skipped() == 0);
+    REQUIRE(imu == frames);
+    REQUIRE(state == frames);
+    REQUIRE(high == frames);
+    REQUIRE(loop == frames);
+    REQUIRE(custom == frames / 100);
+
+    remove(path.c_str());
+}
+
+// The write period is tuned per test, which a frozen build rejects
+#ifndef DAE_FROZEN_CONFIG
+TEST_CASE("FlightRecorder drops records instead of blocking",
+          "[FlightRecorder]") {
+    const std::string path = "flight_recorder_drop_test.bin";
+
+    FlightRecorder recorder;
+    recorder.cnf("buffer_size", 4096.0);
+    recorder.cnf("buffers", 2.0);
+    recorder.cnf("write_period", 1.0);
+    REQUIRE(recorder.open(path) == FlightRecorder::ST_GOOD);
+
+    // Resizing only applies to the next log, the open one keeps its buffers
+    recorder.cnf({{"buffer_size", 1 << 20}, {"buffers", 64}});
+
+    // Far more than two buffers worth, faster than the writer wakes up
+    PhysicsBackend::Telemetry telem{};
+    for (int i = 0; i < 1000; i++) {
+        recorder.writeTelemetry(0, telem);
+    }
+
+    REQUIRE(recorder.dropped() > 0);
+    recorder.close();
+
+    remove(path.c_str());
+}
+#endif
+
+TEST_CASE("FlightRecorder compresses telemetry losslessly",
+          "[FlightRecorder]") {
+    const std::string path = "flight_recorder_compress_test.bin";
+
+    FlightRecorder recorder;
+    recorder.cnf("compress_telemetry", 1.0);
+    REQUIRE(recorder.open(path) == FlightRecorder::ST_GOOD);
+
+    // Not a whole number of blocks, so closing writes a partial one
+    std::vector<PhysicsBackend::Telemetry> frames(1000);
+    for (size_t i = 0; i < frames.size(); i++) {
+        PhysicsBackend::Telemetry& telem = frames[i];
+        const double               t     = static_cast<double>(i) * 0.0025;
+
+        telem               = {};
+        telem.timestamp     = t;
+        telem.gyro[0]       = std::sin(t) + 1e-3 * std::sin(37 * t);
+        telem.accel[2]      = -9.81 + 1e-2 * std::cos(53 * t);
+        telem.position[0]   = t * 2;
+        telem.quaternion[0] = 1.0;
+
+        recorder.writeTelemetry(static_cast<uint64_t>(i) * 2500, telem);
+    }
+    recorder.close();
+
+    REQUIRE(recorder.dropped() == 0);
+
+    // Smaller than the TELI and TELS records would have been
+    const size_t raw = frames.size() * (sizeof(FlightLog::TelemImu) +
+                                        sizeof(FlightLog::TelemState));
+    INFO("Wrote " << recorder.written() << " bytes");
+    REQUIRE(recorder.written() < raw / 2);
+
+    FlightLogReader reader;
+    REQUIRE(reader.open(path) == FlightLogReader::ST_GOOD);
+
+    std::vector<PhysicsBackend::Telemetry> decoded;
+    REQUIRE(reader.telemetry(decoded) == 0);
+    REQUIRE(decoded.size() == frames.size());
+    for (size_t i = 0; i < frames.size(); i++) {
+        REQUIRE(memcmp(&decoded[i], &frames[i], sizeof(frames[i])) == 0);
+    }
+
+    // Telemetry is only written compressed
+    FlightLogReader::Record record;
+    while (reader.next(record)) {
+        REQUIRE(record.message->name != "TELI");
+        REQUIRE(record.message->name != "TELS");
+    }
+    REQUIRE(reader.skipped() == 0);
+
+    remove(path.c_str());
+}
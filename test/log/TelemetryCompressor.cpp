@@ -0,0 +1,245 @@
+/**
+ * @file TelemetryCompressor.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the TelemetryCompressor class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "log/TelemetryCompressor.h"
+
+using namespace Dae;
+
+using Telemetry = TelemetryCompressor::Telemetry;
+
+/**
+ * @brief Generate 400 Hz telemetry from quantised sensors, as the IMU and
+ * state estimate produce.
+ */
+static std::vector<Telemetry> sensorFrames(size_t count) {
+    std::vector<Telemetry> frames(count);
+    std::mt19937           rng(1);
+    std::normal_distribution<double> noise(0.0, 2.0);
+
+    for (size_t i = 0; i < count; i++) {
+        Telemetry& t = frames[i];
+        const double phase = static_cast<double>(i) * 0.01;
+
+        t.timestamp = static_cast<double>(i) * 0.0025;
+        for (int a = 0; a < 3; a++) {
+            // 16 bit ADC counts scaled by a power of two
+            t.gyro[a]  = std::round(300 * std::sin(phase + a) + noise(rng)) /
+                         1024.0;
+            t.accel[a] = std::round(2048 * std::cos(phase + a) + noise(rng)) /
+                         256.0;
+            t.position[a] = std::round(static_cast<double>(i) * (a + 1)) / 8;
+            t.velocity[a] = std::round(40 * std::sin(phase * 0.1 + a)) / 16;
+        }
+        t.quaternion[0] = 1;
+        t.quaternion[1] = 0;
+        t.quaternion[2] = 0;
+        t.quaternion[3] = 0;
+    }
+
+    return frames;
+}
+
+/**
+ * @brief Generate 400 Hz telemetry at full precision, as filtered and
+ * calibrated estimates are, with noise on every field.
+ */
+static std::vector<Telemetry> estimateFrames(size_t count) {
+    std::vector<Telemetry>           frames(count);
+    std::mt19937                     rng(3);
+    std::normal_distribution<double> noise(0.0, 0.01);
+
+    for (size_t i = 0; i < count; i++) {
+        Telemetry&   t     = frames[i];
+        const double phase = static_cast<double>(i) * 0.01;
+
+        t.timestamp = static_cast<double>(i) * 0.0025;
+        for (int a = 0; a < 3; a++) {
+            t.gyro[a]     = 0.3 * std::sin(phase + a) + noise(rng);
+            t.accel[a]    = 9.81 * std::cos(phase + a) + noise(rng);
+            t.position[a] = 0.01 * static_cast<double>(i) + noise(rng);
+            t.velocity[a] = 4 * std::sin(phase * 0.1 + a) + noise(rng);
+        }
+
+        double norm = 0;
+        for (int q = 0; q < 4; q++) {
+            t.quaternion[q] = std::cos(phase * 0.1 + q) + noise(rng);
+            norm += t.quaternion[q] * t.quaternion[q];
+        }
+        for (int q = 0; q < 4; q++) {
+            t.quaternion[q] /= std::sqrt(norm);
+        }
+    }
+
+    return frames;
+}
+
+/**
+ * @brief Generate telemetry where every field is full precision noise.
+ */
+static std::vector<Telemetry> noiseFrames(size_t count) {
+    std::vector<Telemetry>                 frames(count);
+    std::mt19937                           rng(2);
+    std::uniform_real_distribution<double> noise(-1.0, 1.0);
+
+    for (size_t i = 0; i < count; i++) {
+        double fields[TelemetryCompressor::FIELDS];
+        fields[0] = static_cast<double>(i) * 0.02;
+        for (size_t f = 1; f < TelemetryCompressor::FIELDS; f++) {
+            fields[f] = noise(rng);
+        }
+        memcpy(&frames[i], fields, sizeof(fields));
+    }
+
+    return frames;
+}
+
+/**
+ * @brief Check that two frames are bit identical.
+ */
+static bool same(const Telemetry& a, const Telemetry& b) {
+    return memcmp(&a, &b, sizeof(Telemetry)) == 0;
+}
+
+TEST_CASE("TelemetryCompressor round trips telemetry losslessly",
+          "[TelemetryCompressor]") {
+    TelemetryCompressor compressor(256);
+
+    std::vector<Telemetry> frames = noiseFrames(1000);
+
+    // Irregular timestamps, including ones that are not whole microseconds
+    frames[10].timestamp  = frames[9].timestamp + 1.234567891;
+    frames[11].timestamp  = frames[10].timestamp + 1e-9;
+    frames[300].timestamp = std::numeric_limits<double>::quiet_NaN();
+    frames[301].timestamp = 1e15;
+    frames[500].gyro[0]   = std::numeric_limits<double>::infinity();
+    frames[501].gyro[0]   = -0.0;
+
+    for (const Telemetry& t : frames) {
+        compressor.append(t);
+    }
+    REQUIRE(compressor.blocks() == 3);
+    compressor.flush();
+    REQUIRE(compressor.blocks() == 4);
+    REQUIRE(compressor.frames() == frames.size());
+
+    for (size_t i = 0; i < frames.size(); i++) {
+        Telemetry out;
+        REQUIRE(compressor.read(i, out));
+        REQUIRE(same(out, frames[i]));
+    }
+
+    Telemetry out;
+    REQUIRE_FALSE(compressor.read(frames.size(), out));
+}
+
+TEST_CASE("TelemetryCompressor blocks decode independently",
+          "[TelemetryCompressor]") {
+    TelemetryCompressor compressor(100);
+
+    const std::vector<Telemetry> frames = sensorFrames(1000);
+    for (const Telemetry& t : frames) {
+        compressor.append(t);
+    }
+    REQUIRE(compressor.blocks() == 10);
+
+    // Find by timestamp
+    REQUIRE(compressor.find(-1.0) == compressor.blocks());
+    REQUIRE(compressor.find(0.0) == 0);
+    REQUIRE(compressor.find(frames[550].timestamp) == 5);
+    REQUIRE(compressor.find(1e9) == 9);
+
+    // Copy a stored block out, as if read back from a file
+    size_t      size;
+    const void* data = compressor.blockData(7, size);
+
+    std::vector<uint64_t> copy(size / sizeof(uint64_t));
+    memcpy(copy.data(), data, size);
+
+    std::vector<Telemetry> decoded;
+    REQUIRE(TelemetryCompressor::decode(copy.data(), size, decoded) == size);
+    REQUIRE(decoded.size() == 100);
+    for (size_t i = 0; i < decoded.size(); i++) {
+        REQUIRE(same(decoded[i], frames[700 + i]));
+    }
+
+    // Truncated blocks are rejected
+    REQUIRE(TelemetryCompressor::decode(copy.data(), size - 8, decoded) == 0);
+}
+
+/**
+ * @brief Compress a series, and get the compression ratio.
+ */
+static double ratioOf(const std::vector<Telemetry>& frames) {
+    TelemetryCompressor compressor;
+    for (const Telemetry& t : frames) {
+        compressor.append(t);
+    }
+    compressor.flush();
+
+    const double raw = static_cast<double>(frames.size() * sizeof(Telemetry));
+    return raw / static_cast<double>(compressor.bytes());
+}
+
+TEST_CASE("TelemetryCompressor shrinks sensor data", "[TelemetryCompressor]") {
+    // Quantised readings share most of their bits from frame to frame
+    const double quantised = ratioOf(sensorFrames(40000));
+    INFO("Quantised compression ratio " << quantised);
+    REQUIRE(quantised > 5);
+
+    // Noisy full precision estimates only save their sign, exponent and
+    // timestamps, but must not grow
+    const double estimates = ratioOf(estimateFrames(40000));
+    INFO("Full precision compression ratio " << estimates);
+    REQUIRE(estimates > 1.05);
+    REQUIRE(estimates < quantised);
+}
+
+TEST_CASE("TelemetryCompressor throughput",
+          "[TelemetryCompressor][.][benchmark]") {
+    const std::vector<Telemetry> sensor = sensorFrames(4096);
+    const std::vector<Telemetry> noise  = noiseFrames(4096);
+
+    for (const auto* frames : {&sensor, &noise}) {
+        TelemetryCompressor compressor;
+        for (const Telemetry& t : *frames) {
+            compressor.append(t);
+        }
+
+        const char* name = frames == &sensor ? "sensor" : "noise";
+        const double raw = static_cast<double>(frames->size() *
+                                               sizeof(Telemetry));
+        WARN(name << " ratio " << raw / static_cast<double>(compressor.bytes())
+                  << ", " << raw / 1e6 << " MB per iteration");
+
+        BENCHMARK(std::string("encode ") + name) {
+            TelemetryCompressor c;
+            for (const Telemetry& t : *frames) {
+                c.append(t);
+            }
+            return c.bytes();
+        };
+
+        std::vector<Telemetry> out;
+        BENCHMARK(std::string("decode ") + name) {
+            size_t total = 0;
+            for (size_t b = 0; b < compressor.blocks(); b++) {
+                compressor.decodeBlock(b, out);
+                total += out.size();
+            }
+            return total;
+        };
+    }
+}
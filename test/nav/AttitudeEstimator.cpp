@@ -0,0 +1,131 @@
+/**
+ * @file AttitudeEstimator.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the AttitudeEstimator class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cmath>
+
+#include "nav/AttitudeEstimator.h"
+
+using namespace Dae;
+
+using Catch::Matchers::WithinAbs;
+
+/// @brief Gravity (m/s^2).
+static constexpr double G = 9.81;
+
+/**
+ * @brief Get the accelerometer reading at rest for an attitude.
+ */
+static Vector3 atRest(const Quaternion& attitude) {
+    return attitude.unrotate({{0, 0, -G}});
+}
+
+// The gains are tuned per test, which a frozen build rejects
+#ifndef DAE_FROZEN_CONFIG
+TEST_CASE("AttitudeEstimator levels to the accelerometer", "[Attitude]") {
+    AttitudeEstimator estimator("TestLevel");
+    estimator.cnf({{"kp", 1.0}, {"ki", 0.0}});
+
+    const Quaternion truth = Quaternion::fromEuler(0.3, -0.2, 0);
+    estimator.reset(atRest(truth));
+    REQUIRE(estimator.attitude().angleTo(truth) < 1e-12);
+
+    // Converges on a tilt it was not reset to
+    estimator.reset(atRest(Quaternion::identity()));
+    for (int i = 0; i < 5000; i++) {
+        estimator.update(Vector3::zero(), atRest(truth), 0.002);
+    }
+    const Vector3 euler = estimator.attitude().toEuler();
+    REQUIRE_THAT(euler[0], WithinAbs(0.3, 1e-3));
+    REQUIRE_THAT(euler[1], WithinAbs(-0.2, 1e-3));
+}
+#endif
+
+TEST_CASE("AttitudeEstimator integrates the gyro", "[Attitude]") {
+    AttitudeEstimator estimator("TestAttitude");
+
+    // Yaw is unobservable, so follows the gyro alone
+    PhysicsBackend::Telemetry t{};
+    Vector3::view(t.accel) = atRest(Quaternion::identity());
+    t.gyro[2]              = 0.5;
+    for (int i = 0; i <= 1000; i++) {
+        t.timestamp = i * 0.001;
+        estimator.update(t);
+    }
+    REQUIRE_THAT(estimator.attitude().toEuler()[2], WithinAbs(0.5, 1e-9));
+}
+
+// The gains are tuned per test, which a frozen build rejects
+#ifndef DAE_FROZEN_CONFIG
+TEST_CASE("AttitudeEstimator learns the gyro bias", "[Attitude]") {
+    AttitudeEstimator estimator("TestBias");
+    estimator.cnf({{"kp", 2.0}, {"ki", 0.5}});
+
+    const Vector3 bias = {{0.02, -0.01, 0}};
+    estimator.reset(atRest(Quaternion::identity()));
+    for (int i = 0; i < 20000; i++) {
+        estimator.update(bias, atRest(Quaternion::identity()), 0.002);
+    }
+
+    REQUIRE(estimator.attitude().angleTo(Quaternion::identity()) < 1e-3);
+    REQUIRE_THAT(estimator.bias()[0], WithinAbs(bias[0], 1e-4));
+    REQUIRE_THAT(estimator.bias()[1], WithinAbs(bias[1], 1e-4));
+}
+
+TEST_CASE("AttitudeEstimator tracks coning motion", "[Attitude]") {
+    AttitudeEstimator estimator("TestConing");
+    estimator.cnf({{"kp", 0.0}, {"ki", 0.0}});
+
+    // The body axis sweeps a cone of half angle BETA at RATE
+    constexpr double BETA = 0.2;
+    constexpr double RATE = 2 * M_PI * 5;
+    const auto       truth = [](double t) {
+        const double s = std::sin(BETA / 2);
+        return Quaternion{{std::cos(BETA / 2), s * std::cos(RATE * t),
+                           s * std::sin(RATE * t), 0}};
+    };
+    const auto gyro = [](double t) {
+        return Vector3{{-RATE * std::sin(BETA) * std::sin(RATE * t),
+                        RATE * std::sin(BETA) * std::cos(RATE * t),
+                        -2 * RATE * std::pow(std::sin(BETA / 2), 2)}};
+    };
+
+    // The body rate is the derivative of the truth
+    const double     h  = 1e-6;
+    const Quaternion dq = truth(0.3).conjugate() * truth(0.3 + h);
+    REQUIRE_THAT(dq[1] * 2 / h, WithinAbs(gyro(0.3)[0], 1e-4));
+    REQUIRE_THAT(dq[3] * 2 / h, WithinAbs(gyro(0.3)[2], 1e-4));
+
+    // Sampling the rate at either end of each step is accurate to second
+    // order, so the error stays within a fraction of the cone
+    constexpr double DT = 0.001;
+    estimator.reset(atRest(truth(0)), gyro(0));
+    REQUIRE(estimator.attitude().angleTo(truth(0)) < 1e-12);
+
+    double worst = 0;
+    for (int i = 1; i <= 5000; i++) {
+        estimator.update(gyro(i * DT), Vector3::zero(), DT);
+        worst = std::max(worst, estimator.attitude().angleTo(truth(i * DT)));
+    }
+    REQUIRE(worst < 1e-3);
+}
+#endif
+
+TEST_CASE("AttitudeEstimator benchmark", "[.][benchmark]") {
+    AttitudeEstimator estimator("TestAttitude");
+    const Vector3     gyro  = {{0.1, -0.2, 0.3}};
+    const Vector3     accel = atRest(Quaternion::fromEuler(0.1, 0.1, 0));
+    estimator.reset(accel);
+
+    BENCHMARK("update") {
+        estimator.update(gyro, accel, 0.001);
+        return estimator.attitude()[0];
+    };
+}
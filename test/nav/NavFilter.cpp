@@ -0,0 +1,155 @@
+/**
+ * @file NavFilter.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the NavFilter class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cmath>
+
+#include "nav/NavFilter.h"
+
+using namespace Dae;
+
+using Catch::Matchers::WithinAbs;
+
+/// @brief IMU rate (Hz).
+static constexpr double RATE = 400;
+
+/**
+ * @brief Make the telemetry of a vehicle with a known trajectory.
+ */
+static PhysicsBackend::Telemetry
+measure(double timestamp, const Vector3& position, const Vector3& velocity,
+        const Vector3& acceleration, const Quaternion& attitude,
+        const Vector3& rate) {
+    PhysicsBackend::Telemetry t{};
+    t.timestamp                    = timestamp;
+    Vector3::view(t.position)      = position;
+    Vector3::view(t.velocity)      = velocity;
+    Vector3::view(t.gyro)          = rate;
+    Vector3::view(t.accel) =
+        attitude.unrotate(acceleration - NavFilter::GRAVITY);
+    Quaternion::view(t.quaternion) = attitude;
+    return t;
+}
+
+TEST_CASE("NavFilter block propagation matches the dense product",
+          "[NavFilter]") {
+    NavFilter filter("TestNavFilter");
+
+    // Populate the cross covariances with a few steps and a fix
+    const Vector3 gyro  = {{0.1, -0.3, 0.2}};
+    const Vector3 accel = {{0.5, 0.2, -9.6}};
+    filter.reset(Vector3::zero(), Vector3::zero(), accel);
+    for (int i = 0; i < 50; i++) {
+        filter.predict(gyro, accel, 1 / RATE);
+    }
+    filter.fuseGps({{0.1, 0.2, -0.1}}, {{0.3, -0.1, 0.0}});
+    for (int i = 0; i < 10; i++) {
+        filter.predict(gyro, accel, 1 / RATE);
+    }
+
+    const NavFilter::Covariance before = filter.covariance();
+    const NavFilter::Covariance F      = filter.transition(accel, 1 / RATE);
+    const auto                  noise  = filter.processNoise(1 / RATE);
+    filter.predict(gyro, accel, 1 / RATE);
+
+    const NavFilter::Covariance expected =
+        F * before * F.transpose() + NavFilter::Covariance::diagonal(noise);
+    for (size_t i = 0; i < NavFilter::Covariance::SIZE; i++) {
+        REQUIRE_THAT(filter.covariance()[i], WithinAbs(expected[i], 1e-15));
+    }
+    for (size_t i = 0; i < NavFilter::STATES; i++) {
+        for (size_t j = 0; j < i; j++) {
+            REQUIRE(filter.covariance()(i, j) == filter.covariance()(j, i));
+        }
+    }
+}
+
+TEST_CASE("NavFilter estimates the IMU biases at rest", "[NavFilter]") {
+    NavFilter filter("TestNavFilter");
+
+    const Vector3 gyroBias  = {{0.005, -0.004, 0}};
+    const Vector3 accelBias = {{0, 0, 0.15}};
+    const Vector3 position  = {{10, -5, -2}};
+    const Vector3 rate      = Vector3::zero();
+
+    for (int i = 0; i <= 120 * RATE; i++) {
+        PhysicsBackend::Telemetry t =
+            measure(i / RATE, position, Vector3::zero(), Vector3::zero(),
+                    Quaternion::identity(), rate);
+        Vector3::view(t.gyro)  += gyroBias;
+        Vector3::view(t.accel) += accelBias;
+        filter.update(t);
+    }
+
+    REQUIRE((filter.position() - position).norm() < 0.05);
+    REQUIRE(filter.velocity().norm() < 0.01);
+    REQUIRE_THAT(filter.gyroBias()[0], WithinAbs(gyroBias[0], 5e-4));
+    REQUIRE_THAT(filter.gyroBias()[1], WithinAbs(gyroBias[1], 5e-4));
+    REQUIRE_THAT(filter.accelBias()[2], WithinAbs(accelBias[2], 0.01));
+}
+
+TEST_CASE("NavFilter tracks a turning vehicle", "[NavFilter]") {
+    NavFilter filter("TestNavFilter");
+
+    // Circling at RADIUS and TURN, facing along the circle
+    constexpr double RADIUS = 20;
+    constexpr double TURN   = 0.3;
+
+    const Vector3 gyroBias = {{0.002, 0.003, -0.004}};
+
+    double worst = 0;
+    for (int i = 0; i <= 90 * RATE; i++) {
+        const double  time = i / RATE;
+        const double  c    = std::cos(TURN * time);
+        const double  s    = std::sin(TURN * time);
+        const Vector3 position{{RADIUS * s, RADIUS * (1 - c), -10}};
+        const Vector3 velocity{{RADIUS * TURN * c, RADIUS * TURN * s, 0}};
+        const Vector3 acceleration{
+            {-RADIUS * TURN * TURN * s, RADIUS * TURN * TURN * c, 0}};
+        const Quaternion attitude =
+            Quaternion::fromAxisAngle({{0, 0, 1}}, TURN * time);
+
+        PhysicsBackend::Telemetry t =
+            measure(time, position, velocity, acceleration, attitude,
+                    {{0, 0, TURN}});
+        Vector3::view(t.gyro) += gyroBias;
+        filter.update(t);
+
+        // Yaw is only observed once the turn has run for a while
+        if (time > 30) {
+            worst = std::max(worst, filter.attitude().angleTo(attitude));
+        }
+    }
+
+    REQUIRE(worst < 0.02);
+    REQUIRE_THAT(filter.gyroBias()[2], WithinAbs(gyroBias[2], 1e-3));
+}
+
+TEST_CASE("NavFilter benchmark", "[.][benchmark]") {
+    NavFilter     filter("TestNavFilter");
+    const Vector3 gyro  = {{0.1, -0.3, 0.2}};
+    const Vector3 accel = {{0.5, 0.2, -9.6}};
+    filter.reset(Vector3::zero(), Vector3::zero(), accel);
+
+    BENCHMARK("predict") {
+        filter.predict(gyro, accel, 1 / RATE);
+        return filter.covariance()[0];
+    };
+
+    BENCHMARK("dense propagation") {
+        const NavFilter::Covariance F = filter.transition(accel, 1 / RATE);
+        return F * filter.covariance() * F.transpose();
+    };
+
+    BENCHMARK("fuse GPS") {
+        filter.fuseGps(Vector3::zero(), Vector3::zero());
+        return filter.covariance()[0];
+    };
+}
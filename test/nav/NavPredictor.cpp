@@ -0,0 +1,130 @@
+/**
+ * @file NavPredictor.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the NavPredictor class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cmath>
+
+#include "nav/NavPredictor.h"
+
+using namespace Dae;
+
+using Catch::Matchers::WithinAbs;
+
+/// @brief IMU rate (Hz).
+static constexpr double RATE = 400;
+
+/// @brief Radius of the circle flown (m).
+static constexpr double RADIUS = 20;
+
+/// @brief Turn rate around the circle (rad/s).
+static constexpr double TURN = 0.3;
+
+/**
+ * @brief State of a vehicle circling at RADIUS and TURN, facing along the
+ * circle.
+ */
+struct Truth {
+    Vector3    position;
+    Vector3    velocity;
+    Quaternion attitude;
+    Vector3    gyro;
+    Vector3    accel;
+
+    explicit Truth(double time) {
+        const double c = std::cos(TURN * time);
+        const double s = std::sin(TURN * time);
+        const double a = RADIUS * TURN * TURN;
+
+        position = {{RADIUS * s, RADIUS * (1 - c), -10}};
+        velocity = {{RADIUS * TURN * c, RADIUS * TURN * s, 0}};
+        attitude = Quaternion::fromAxisAngle({{0, 0, 1}}, TURN * time);
+        gyro     = {{0, 0, TURN}};
+        accel    = attitude.unrotate(Vector3{{-a * s, a * c, 0}} -
+                                     NavFilter::GRAVITY);
+    }
+};
+
+// The delay and time constant are tuned per test, which a frozen build rejects
+#ifndef DAE_FROZEN_CONFIG
+TEST_CASE("NavPredictor fuses late fixes at their timestamps",
+          "[NavPredictor]") {
+    constexpr double LATENCY = 0.12;
+
+    NavPredictor predictor("TestNavPredictor", "TestNavPredictorFilter");
+    predictor.cnf({{"delay", 0.15}, {"time_constant", 0.2}});
+
+    // The same filter, fusing the late fixes as if they were current
+    NavFilter naive("TestNavPredictorFilter");
+
+    const Truth start(0);
+    predictor.reset(0, start.position, start.velocity, start.accel);
+    naive.reset(start.position, start.velocity, start.accel);
+
+    double worst      = 0;
+    double worstNaive = 0;
+    for (int i = 1; i <= 60 * RATE; i++) {
+        const double time = i / RATE;
+        const Truth  now(time);
+
+        // A fix every 40 samples, arriving LATENCY after it was measured
+        if (i % 40 == 0 && time > LATENCY) {
+            const Truth fix(time - LATENCY);
+            REQUIRE(predictor.pushGps(time - LATENCY, fix.position,
+                                      fix.velocity));
+            naive.fuseGps(fix.position, fix.velocity);
+        }
+
+        predictor.pushImu(time, now.gyro, now.accel);
+        naive.predict(now.gyro, now.accel, 1 / RATE);
+
+        if (time > 20) {
+            worst = std::max(worst, (predictor.position() - now.position)
+                                        .norm());
+            worstNaive =
+                std::max(worstNaive, (naive.position() - now.position).norm());
+        }
+    }
+
+    REQUIRE_THAT(predictor.horizon(), WithinAbs(60 - 0.15, 1 / RATE));
+    REQUIRE(worst < 0.02);
+    REQUIRE(worstNaive > 10 * worst);
+}
+
+TEST_CASE("NavPredictor rejects fixes behind the horizon", "[NavPredictor]") {
+    NavPredictor predictor("TestNavPredictor", "TestNavPredictorFilter");
+    predictor.cnf({{"delay", 0.15}});
+
+    const Truth start(0);
+    predictor.reset(0, start.position, start.velocity, start.accel);
+    for (int i = 1; i <= RATE; i++) {
+        const Truth now(i / RATE);
+        predictor.pushImu(i / RATE, now.gyro, now.accel);
+    }
+
+    const Truth old(0.5);
+    REQUIRE_FALSE(predictor.pushGps(0.5, old.position, old.velocity));
+    REQUIRE(predictor.pushGps(0.9, old.position, old.velocity));
+}
+
+TEST_CASE("NavPredictor benchmark", "[.][benchmark]") {
+    NavPredictor predictor("TestNavPredictor", "TestNavPredictorFilter");
+    predictor.cnf({{"delay", 0.15}});
+
+    const Truth start(0);
+    predictor.reset(0, start.position, start.velocity, start.accel);
+
+    double time = 0;
+    BENCHMARK("push IMU") {
+        time += 1 / RATE;
+        predictor.pushImu(time, start.gyro, start.accel);
+        return predictor.position()[0];
+    };
+}
+#endif
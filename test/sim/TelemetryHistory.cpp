@@ -0,0 +1,147 @@
+/**
+ * @file TelemetryHistory.cpp
+ * @author rileyhorrix (riley@horrix.com)
+ * @brief Testing file for the TelemetryHistory class.
+ * @version 0.1
+ * @date 2025-09-24
+ *
+ * Copyright (c) Riley Horrix 2025
+ */
+#include <catch2/catch_all.hpp>
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "sim/TelemetryHistory.h"
+
+using namespace Dae;
+using Catch::Matchers::WithinAbs;
+
+using Telemetry = TelemetryHistory::Telemetry;
+
+/**
+ * @brief Make a sample at a time, yawed by `yaw` radians, moving along north
+ * at 1 m/s.
+ */
+static Telemetry sample(double timestamp, double yaw = 0) {
+    Telemetry t{};
+    t.timestamp     = timestamp;
+    t.position[0]   = timestamp;
+    t.velocity[0]   = 1;
+    t.quaternion[0] = std::cos(yaw / 2);
+    t.quaternion[3] = std::sin(yaw / 2);
+    return t;
+}
+
+TEST_CASE("TelemetryHistory interpolates between samples",
+          "[TelemetryHistory]") {
+    TelemetryHistory history(8);
+    Telemetry        out;
+    REQUIRE_FALSE(history.at(0, out));
+    REQUIRE_FALSE(history.latest(out));
+
+    REQUIRE(history.push(sample(1.0, 0)));
+    REQUIRE(history.push(sample(2.0, M_PI / 2)));
+    REQUIRE_FALSE(history.push(sample(1.5)));
+
+    REQUIRE(history.at(1.25, out));
+    REQUIRE_THAT(out.timestamp, WithinAbs(1.25, 1e-12));
+    REQUIRE_THAT(out.position[0], WithinAbs(1.25, 1e-12));
+    REQUIRE_THAT(out.velocity[0], WithinAbs(1.0, 1e-12));
+
+    // A quarter of the way through a quarter turn
+    REQUIRE_THAT(out.quaternion[0], WithinAbs(std::cos(M_PI / 16), 1e-12));
+    REQUIRE_THAT(out.quaternion[3], WithinAbs(std::sin(M_PI / 16), 1e-12));
+
+    // Exact samples, and times outside the history
+    REQUIRE(history.at(2.0, out));
+    REQUIRE(out.position[0] == 2.0);
+    REQUIRE(history.at(1.0, out));
+    REQUIRE(out.position[0] == 1.0);
+    REQUIRE_FALSE(history.at(0.5, out));
+    REQUIRE_FALSE(history.at(2.5, out));
+}
+
+TEST_CASE("TelemetryHistory slerps the short way round",
+          "[TelemetryHistory]") {
+    Telemetry a = sample(0, 0.1);
+    Telemetry b = sample(1, -0.1);
+    for (double& q : b.quaternion) {
+        q = -q;
+    }
+
+    Telemetry out;
+    TelemetryHistory::interpolate(a, b, 0.5, out);
+    REQUIRE_THAT(std::abs(out.quaternion[0]), WithinAbs(1.0, 1e-12));
+    REQUIRE_THAT(out.quaternion[3], WithinAbs(0.0, 1e-12));
+}
+
+TEST_CASE("TelemetryHistory keeps the newest samples", "[TelemetryHistory]") {
+    TelemetryHistory history(5);
+    REQUIRE(history.capacity() == 8);
+
+    for (int i = 0; i < 20; i++) {
+        history.push(sample(i));
+    }
+    REQUIRE(history.size() == 8);
+
+    std::vector<Telemetry> samples;
+    REQUIRE(history.snapshot(samples) == 8);
+    REQUIRE(samples.front().timestamp == 12);
+    REQUIRE(samples.back().timestamp == 19);
+    REQUIRE(history.snapshot(samples, 3) == 3);
+    REQUIRE(samples.front().timestamp == 17);
+
+    Telemetry out;
+    REQUIRE_FALSE(history.at(11.5, out));
+    REQUIRE(history.at(12.5, out));
+    REQUIRE(history.latest(out));
+    REQUIRE(out.timestamp == 19);
+}
+
+TEST_CASE("TelemetryHistory is read consistently while it is written",
+          "[TelemetryHistory]") {
+    TelemetryHistory history(64);
+
+    std::atomic<bool> running{true};
+    std::atomic<int>  bad{0};
+    std::atomic<int>  reads{0};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; i++) {
+        readers.emplace_back([&] {
+            std::vector<Telemetry> samples;
+            Telemetry              out;
+            while (running.load(std::memory_order_relaxed)) {
+                history.snapshot(samples);
+                for (size_t j = 0; j < samples.size(); j++) {
+                    if (samples[j].position[0] != samples[j].timestamp) bad++;
+                    if (j > 0 &&
+                        samples[j].timestamp <= samples[j - 1].timestamp) {
+                        bad++;
+                    }
+                }
+
+                if (!history.latest(out)) continue;
+                const double time = out.timestamp - 10.5;
+                if (history.at(time, out) &&
+                    std::abs(out.position[0] - time) > 1e-9) {
+                    bad++;
+                }
+                reads++;
+            }
+        });
+    }
+
+    for (int i = 0; i < 200000 || reads.load() < 1000; i++) {
+        history.push(sample(i));
+    }
+
+    running.store(false, std::memory_order_relaxed);
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    REQUIRE(bad.load() == 0);
+}